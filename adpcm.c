@@ -0,0 +1,160 @@
+#include <stddef.h>
+
+#include "adpcm.h"
+
+#define NIBBLE_SIGN 0x8
+#define NIBBLE_MAGNITUDE 0x7
+#define MAX_STEP_INDEX 88
+#define ADPCM_DECODE_CHUNK 64 // Samples decoded before converting.
+
+static const int16_t step_table[MAX_STEP_INDEX + 1] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+static const int8_t index_table[NIBBLE_MAGNITUDE + 1] = {-1, -1, -1, -1,
+                                                         2,  4,  6,  8};
+
+// Apply one nibble to the predictor and step index.  The encoder and decoder
+// share this so they track the same state.
+static void applyNibble(int32_t *predictor, int8_t *index, uint8_t nibble) {
+  int32_t step = step_table[*index];
+  int32_t difference = step >> 3;
+  if (nibble & 4)
+    difference += step;
+  if (nibble & 2)
+    difference += step >> 1;
+  if (nibble & 1)
+    difference += step >> 2;
+  *predictor += (nibble & NIBBLE_SIGN) ? -difference : difference;
+  if (*predictor > INT16_MAX)
+    *predictor = INT16_MAX;
+  else if (*predictor < INT16_MIN)
+    *predictor = INT16_MIN;
+  *index += index_table[nibble & NIBBLE_MAGNITUDE];
+  if (*index < 0)
+    *index = 0;
+  else if (*index > MAX_STEP_INDEX)
+    *index = MAX_STEP_INDEX;
+}
+
+// Pick the nibble that moves the predictor closest to sample.
+static uint8_t encodeNibble(int32_t predictor, int8_t index, int32_t sample) {
+  int32_t difference = sample - predictor;
+  int32_t step = step_table[index];
+  uint8_t nibble = 0;
+  if (difference < 0) {
+    nibble = NIBBLE_SIGN;
+    difference = -difference;
+  }
+  for (uint8_t bit = 4; bit; bit >>= 1, step >>= 1) {
+    if (difference >= step) {
+      nibble |= bit;
+      difference -= step;
+    }
+  }
+  return nibble;
+}
+
+// Bytes needed to store sample_count samples.
+uint32_t adpcm_encodedSize(uint32_t sample_count) {
+  uint32_t blocks =
+      (sample_count + ADPCM_SAMPLES_PER_BLOCK - 1) / ADPCM_SAMPLES_PER_BLOCK;
+  return blocks * ADPCM_BLOCK_SIZE;
+}
+
+// Encode sample_count samples into out, which must hold
+// adpcm_encodedSize(sample_count) bytes.  Returns the bytes written.
+uint32_t adpcm_encode(const int16_t *samples, uint32_t sample_count,
+                      uint8_t *out) {
+  uint32_t size = adpcm_encodedSize(sample_count);
+  int8_t index = 0;
+  for (uint32_t first = 0; first < sample_count;
+       first += ADPCM_SAMPLES_PER_BLOCK) {
+    uint8_t *block = out + (first / ADPCM_SAMPLES_PER_BLOCK) * ADPCM_BLOCK_SIZE;
+    int32_t predictor = samples[first];
+    block[0] = (uint16_t)predictor & 0xFF;
+    block[1] = (uint16_t)predictor >> 8;
+    block[2] = index;
+    block[3] = 0;
+    for (uint16_t i = 1; i < ADPCM_SAMPLES_PER_BLOCK; i++) {
+      uint8_t nibble = 0; // Padding after the last sample.
+      if (first + i < sample_count) {
+        nibble = encodeNibble(predictor, index, samples[first + i]);
+        applyNibble(&predictor, &index, nibble);
+      }
+      uint8_t *byte = &block[ADPCM_HEADER_SIZE + (i - 1) / 2];
+      if ((i - 1) % 2 == 0)
+        *byte = nibble;
+      else
+        *byte |= nibble << 4;
+    }
+  }
+  return size;
+}
+
+// Decode samples from the decoder's position into out, without clamping.
+// The state is kept in locals so the per-sample loop stays in registers.
+static void decodeSamples(adpcm_decoder_t *decoder, int32_t *out,
+                          uint32_t count) {
+  const uint8_t *block = decoder->block;
+  uint16_t sample = decoder->sample;
+  int32_t predictor = decoder->predictor;
+  int8_t index = decoder->index;
+  for (uint32_t i = 0; i < count; i++) {
+    if (sample == ADPCM_SAMPLES_PER_BLOCK) { // On to the next block.
+      block += ADPCM_BLOCK_SIZE;
+      sample = 0;
+    }
+    if (sample == 0) { // Block header.
+      predictor = (int16_t)(block[0] | (block[1] << 8));
+      index = block[2] > MAX_STEP_INDEX ? MAX_STEP_INDEX : block[2];
+    } else {
+      uint16_t n = sample - 1;
+      uint8_t byte = block[ADPCM_HEADER_SIZE + n / 2];
+      applyNibble(&predictor, &index, (n % 2) ? byte >> 4 : byte & 0xF);
+    }
+    sample++;
+    if (out)
+      out[i] = predictor;
+  }
+  decoder->block = block;
+  decoder->sample = sample;
+  decoder->predictor = predictor;
+  decoder->index = index;
+}
+
+// Start decoding data at sample first.
+void adpcm_decoderStart(adpcm_decoder_t *decoder, const uint8_t *data,
+                        uint32_t first) {
+  decoder->block = data + (first / ADPCM_SAMPLES_PER_BLOCK) * ADPCM_BLOCK_SIZE;
+  decoder->sample = 0;
+  decoder->predictor = 0;
+  decoder->index = 0;
+  // Nibbles only make sense from the start of their block.
+  decodeSamples(decoder, NULL, first % ADPCM_SAMPLES_PER_BLOCK);
+}
+
+// Decode the next count samples.  They are written offset-binary
+// (sample + INT16_MAX), the same as the PCM sound arrays.
+void adpcm_decode(adpcm_decoder_t *decoder, uint16_t *out, uint32_t count) {
+  int32_t decoded[ADPCM_DECODE_CHUNK];
+  while (count) {
+    uint32_t length = count < ADPCM_DECODE_CHUNK ? count : ADPCM_DECODE_CHUNK;
+    decodeSamples(decoder, decoded, length);
+    for (uint32_t i = 0; i < length; i++) {
+      int32_t sample = decoded[i];
+      if (sample < -INT16_MAX) // INT16_MIN has no offset-binary code.
+        sample = -INT16_MAX;
+      out[i] = (uint16_t)(sample + INT16_MAX);
+    }
+    out += length;
+    count -= length;
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef ADPCM
+#define ADPCM
+
+#include <stdint.h>
+
+// IMA-ADPCM, 4 bits per sample, in fixed-size mono blocks.  Each block starts
+// with the first sample stored exactly (little-endian int16) and the step
+// index, followed by two samples per byte, low nibble first.  A sound is a
+// run of blocks; the last one is padded.
+#define ADPCM_BLOCK_SIZE 256 // Bytes per block.
+#define ADPCM_HEADER_SIZE 4  // Bytes of block header.
+#define ADPCM_SAMPLES_PER_BLOCK (1 + (ADPCM_BLOCK_SIZE - ADPCM_HEADER_SIZE) * 2)
+
+// Streaming decoder for one sound.
+typedef struct {
+  const uint8_t *block; // Block being decoded.
+  uint16_t sample;      // Index of the next sample within the block.
+  int32_t predictor;    // Last decoded sample.
+  int8_t index;         // Current step index.
+} adpcm_decoder_t;
+
+// Bytes needed to store sample_count samples.
+uint32_t adpcm_encodedSize(uint32_t sample_count);
+
+// Encode sample_count samples into out, which must hold
+// adpcm_encodedSize(sample_count) bytes.  Returns the bytes written.
+uint32_t adpcm_encode(const int16_t *samples, uint32_t sample_count,
+                      uint8_t *out);
+
+// Start decoding data at sample first.
+void adpcm_decoderStart(adpcm_decoder_t *decoder, const uint8_t *data,
+                        uint32_t first);
+
+// Decode the next count samples.  They are written offset-binary
+// (sample + INT16_MAX), the same as the PCM sound arrays.
+void adpcm_decode(adpcm_decoder_t *decoder, uint16_t *out, uint32_t count);
+
+#endif /* ADPCM */
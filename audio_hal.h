@@ -0,0 +1,37 @@
+#ifndef AUDIO_HAL_H_
+#define AUDIO_HAL_H_
+
+// Audio output hardware: the SSM2603 CODEC and the I2S TX FIFO that feeds it.
+// audio_hal_xilinx.c drives the board; host/audio_hal_host.c emulates it.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Samples per second the CODEC plays.
+#define AUDIO_HAL_SAMPLE_RATE 48000
+
+// Start setting up the CODEC and the I2S controller. Returns false on
+// failure. Setup finishes in the background, from swtimer_real_e timers.
+bool audio_hal_init();
+
+// Returns true once the setup started by audio_hal_init() is done.
+bool audio_hal_isReady();
+
+// Returns true if the setup started by audio_hal_init() failed. The CODEC
+// will never be ready then, and the game carries on without sound.
+bool audio_hal_failed();
+
+// Empty the TX FIFO.
+void audio_hal_resetTx();
+
+// Start or stop sending the TX FIFO to the CODEC.
+void audio_hal_enableTx(bool enable);
+
+// Returns true if the TX FIFO has no room for another sample.
+bool audio_hal_txFull();
+
+// sampleValue is sent to both the left and right channels. It is an
+// offset-binary sample (sample + INT16_MAX) times the volume.
+void audio_hal_write(uint32_t sampleValue);
+
+#endif /* AUDIO_HAL_H_ */
@@ -0,0 +1,364 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+
+#include "audio_hal.h"
+#include "swtimer.h"
+#include "xiicps.h"
+#include "xil_io.h"
+#include "xil_printf.h"
+#include "xil_types.h"
+#include "xparameters.h"
+
+/***************************************************************
+ * Quite a bit of this code was obtained from digilent.com
+ * so it does not necessarily meet the coding standard.
+ ****************************************************************/
+
+/* I2S Register offsets */
+#define I2S_RESET_REG 0x00
+#define I2S_CTRL_REG 0x04
+#define I2S_CLK_CTRL_REG 0x08
+#define I2S_FIFO_STS_REG 0x20
+#define I2S_RX_FIFO_REG 0x28
+#define I2S_TX_FIFO_REG 0x2C
+
+/* IIC address of the SSM2603 device and the desired IIC clock speed */
+#define IIC_SLAVE_ADDR 0b0011010
+#define IIC_SCLK_RATE 100000
+
+/* Redefine the XPAR constants */
+#define IIC_DEVICE_ID XPAR_XIICPS_0_DEVICE_ID
+#define I2S_ADDRESS XPAR_AXI_I2S_ADI_0_BASEADDR
+#define TIMER_DEVICE_ID XPAR_SCUTIMER_DEVICE_ID
+#define AUDIO_IIC_ID XPAR_XIICPS_0_DEVICE_ID
+#define AUDIO_CTRL_BASEADDR 0x43C20000
+#define SCU_TIMER_ID XPAR_SCUTIMER_DEVICE_ID
+#define UART_BASEADDR XPAR_PS7_UART_1_BASEADDR
+
+#define I2S_FIFO_STS_TX_FULL 0b0010 // TX FIFO has no room.
+
+#define CODEC_SETTLE_US 75000 // Time the CODEC needs after reset and setup.
+
+// Declared below.
+static int AudioInitialize(u16 iicID, u32 i2sAddr);
+static void AudioConfigure(void *context);
+static void AudioActivate(void *context);
+
+// Runs the steps of the CODEC setup that have to wait for it to settle.
+static swtimer_t audio_hal_settleTimer;
+static int audio_hal_status;                // Status of the setup steps so far.
+static u32 audio_hal_i2sAddr;               // I2S controller being set up.
+static volatile bool audio_hal_ready;       // The last step is done.
+static volatile bool audio_hal_setupFailed; // A step failed.
+
+// Start setting up the CODEC and the I2S controller. Returns false on failure.
+bool audio_hal_init() {
+  audio_hal_ready = false;
+  audio_hal_setupFailed = false;
+  if (AudioInitialize(AUDIO_IIC_ID, AUDIO_CTRL_BASEADDR) != XST_SUCCESS) {
+    audio_hal_setupFailed = true;
+    return false;
+  }
+  return true;
+}
+
+// Returns true once the setup started by audio_hal_init() is done.
+bool audio_hal_isReady() { return audio_hal_ready; }
+
+// Returns true if the setup started by audio_hal_init() failed.
+bool audio_hal_failed() { return audio_hal_setupFailed; }
+
+// Empty the TX FIFO.
+void audio_hal_resetTx() {
+  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_RESET_REG, 0b010); // Reset TX Fifo
+}
+
+// Start or stop sending the TX FIFO to the CODEC.
+void audio_hal_enableTx(bool enable) {
+  if (enable)
+    Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_CTRL_REG,
+              0b001); // Enable TX Fifo, disable mute
+  else
+    Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_CTRL_REG, 0b00); // Disable TX FIFO.
+}
+
+// Returns true if the TX FIFO has no room for another sample.
+bool audio_hal_txFull() {
+  return Xil_In32(AUDIO_CTRL_BASEADDR + I2S_FIFO_STS_REG) &
+         I2S_FIFO_STS_TX_FULL;
+}
+
+// sampleValue is sent to both the left and right channels.
+void audio_hal_write(uint32_t sampleValue) {
+  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_TX_FIFO_REG,
+            sampleValue); // add to left Channel.
+  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_TX_FIFO_REG,
+            sampleValue); // add to right Channel.
+}
+
+/**********************************************************************************
+ * Note from BLH: Most of this code was re-purposed from the original Digilent
+ * demonstration code. The code initializes the IIC controller that is
+ * connected to the audio CODEC. It also provides functions to initialize the
+ * audio CODEC and to send/received to/from CODEC.
+ **********************************************************************************/
+
+#define SEND_BUFFER_SIZE 2
+
+static XIicPs Iic; /* Instance of the IIC Device */
+
+/***************************************************************************
+ * Procedural definitions from the original audio_demo files from Digilent.
+ ***************************************************************************/
+
+/***  AudioRegSet(XIicPs *IIcPtr, u8 regAddr, u16 regData)
+**
+**  Parameters:
+**    IIcPtr - Pointer to the initialized XIicPs struct
+**    regAddr - Register in the SSM2603 to write to
+**    regData - Data to write to the register (lower 9 bits are used)
+**
+**  Return Value: int
+**    XST_SUCCESS if successful
+**
+**  Errors:
+**
+**  Description:
+**    Writes a value to a register in the SSM2603 device over IIC.
+**
+*/
+static int AudioRegSet(XIicPs *IIcPtr, u8 regAddr, u16 regData) {
+  int Status;
+  //  u8 SendBuffer[2];
+  u8 SendBuffer[SEND_BUFFER_SIZE]; // We will send 2 bytes at a time.
+  // Register address is stored in bits 7 - 1.
+  SendBuffer[0] = regAddr << 1;
+  // Store data bit 9 in bit 7 of 0th word.
+  SendBuffer[0] = SendBuffer[0] | ((regData >> 8) & 0b1);
+  // Bits 7-0 of data are stored in 8 bits of 1th word.
+  SendBuffer[1] = regData & 0xFF;
+  // Send 2 bytes to the IIC controller attached to the audio CODEC.
+  Status = XIicPs_MasterSendPolled(IIcPtr, SendBuffer, 2, IIC_SLAVE_ADDR);
+  // Always check for success.
+  if (Status != XST_SUCCESS) {
+    printf("IIC send failed\n");
+    return XST_FAILURE;
+  }
+  // This function blocks until the IIC is idle.
+  /*
+   * Wait until bus is idle to start another transfer.
+   */
+  volatile int no_op;
+  while (1) {
+    no_op = XIicPs_BusIsBusy(IIcPtr);
+    if (!no_op)
+      break;
+  }
+
+  // while (XIicPs_BusIsBusy(IIcPtr)) {
+  //   /* NOP */
+  // }
+  return XST_SUCCESS;
+}
+
+/***  AudioInitialize(u16 iicID, u32 i2sAddr)
+**
+**  Parameters:
+**    iicID   - DEVICE_ID for the PS IIC controller connected to the SSM2603
+**    i2sAddr - Physical Base address of the I2S controller
+**
+**  Return Value: int
+**    XST_SUCCESS if successful
+**
+**  Errors:
+**
+**  Description:
+**    Initializes the Audio demo. Must be called once and only once before
+*calling
+**    AudioRunDemo
+**
+**    The CODEC needs time to settle after its reset and again after it is
+**    configured. Instead of blocking in TimerDelay() for those, the rest of
+**    the setup is done by AudioConfigure() and AudioActivate(), run from
+**    software timers on swtimer_real_e. audio_hal_isReady() says when they
+**    are done.
+*/
+static int AudioInitialize(u16 iicID, u32 i2sAddr) {
+  int Status;            // Return status value.
+  XIicPs_Config *Config; // Keep track of the config. value.
+
+  audio_hal_i2sAddr = i2sAddr;
+
+  /*
+   * Initialize the IIC driver so that it's ready to use
+   * Look up the configuration in the config table,
+   * then initialize it.
+   */
+  Config = XIicPs_LookupConfig(iicID);
+  if (NULL == Config) {
+    return XST_FAILURE;
+  }
+
+  Status = XIicPs_CfgInitialize(&Iic, Config, Config->BaseAddress);
+  if (Status != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+
+  /*
+   * Perform a self-test to ensure that the hardware was built correctly.
+   */
+  Status = XIicPs_SelfTest(&Iic);
+  if (Status != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+
+  /*
+   * Set the IIC serial clock rate.
+   */
+  Status = XIicPs_SetSClk(&Iic, IIC_SCLK_RATE);
+  if (Status != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+
+  /*
+   * Write to the SSM2603 audio codec registers to configure the device. Refer
+   * to the SSM2603 Audio Codec data sheet for information on what these writes
+   * do.
+   */
+
+  // Perform Reset
+  Status = AudioRegSet(&Iic, 15, 0b000000000);
+  if (Status)
+    printf("Status1:%d\n", Status);
+  audio_hal_status = Status;
+  swtimer_start(&audio_hal_settleTimer, swtimer_real_e, CODEC_SETTLE_US, 0,
+                AudioConfigure, NULL);
+  return Status;
+}
+
+// Second step of AudioInitialize(), once the CODEC has settled after its reset.
+static void AudioConfigure(void *context) {
+  int Status = audio_hal_status;
+  // Power up
+  Status |= AudioRegSet(&Iic, 6, 0b000110000);
+  if (Status)
+    printf("Status2:%d\n", Status);
+  // Left-channel ADC input volume.
+  Status |= AudioRegSet(&Iic, 0, 0b000010111);
+  if (Status)
+    printf("Status3:%d\n", Status);
+  // Right-channel ADC input volume.
+  AudioRegSet(&Iic, 1, 0b000010111);
+  // Left-channel DAC volume. Also set
+  Status |= AudioRegSet(&Iic, 2, 0b101111001);
+  if (Status)
+    printf("Status4:%d\n", Status);
+  // right volume to same value.
+  Status |= AudioRegSet(&Iic, 4, 0b000010000); // Analog audio path.
+  if (Status)
+    printf("Status5:%d\n", Status);
+  Status |= AudioRegSet(&Iic, 5, 0b000000000); // Digital audio path.
+  if (Status)
+    printf("Status6:%d\n", Status);
+  // Changed so Word length is 24  Status |= AudioRegSet(&Iic,
+  // 8, 0b000000000); //Changed so no CLKDIV2
+  Status |= AudioRegSet(&Iic, 7, 0b000001010);
+  if (Status)
+    printf("Status7:%d\n", Status);
+  // Changed so no CLKDIV2
+  Status |= AudioRegSet(&Iic, 8, 0b000000000);
+  if (Status)
+    printf("Status8:%d\n", Status);
+  audio_hal_status = Status;
+  // Wait for things to settle down.
+  swtimer_start(&audio_hal_settleTimer, swtimer_real_e, CODEC_SETTLE_US, 0,
+                AudioActivate, NULL);
+}
+
+// Last step of AudioInitialize(), once the configuration has settled.
+static void AudioActivate(void *context) {
+  int Status = audio_hal_status;
+  u32 i2sClkDiv; // Used to help compute the sampling frequency.
+  // Make things active.
+  Status |= AudioRegSet(&Iic, 9, 0b000000001);
+  if (Status)
+    printf("Status9:%d\n", Status);
+  // Power-up the ouput (OSC is left
+  // disabled as MCLK pin provides clock).
+  Status |= AudioRegSet(&Iic, 6, 0b000100000);
+  if (Status)
+    printf("Status10:%d\n", Status);
+
+  if (Status != XST_SUCCESS) {
+    printf("audio_hal: CODEC setup failed\n");
+    audio_hal_setupFailed = true;
+    return;
+  }
+
+  // BLH: This is the original value used by Digilent.
+  // i2sClkDiv = 1; // Set the BCLK to be MCLK / 4
+  // BLH: This value makes things sound correct.
+  // Not sure what the problem is, perhaps the DLL is not running at the correct
+  // frequency? or, there is a bug in the IP that drives the CODEC. In any case,
+  // the sampling rate is 48k.
+  i2sClkDiv = 3;
+  // Set the LRCLK's to be BCLK / 64
+  i2sClkDiv = i2sClkDiv | (31 << 16);
+  // Write clock div register
+  Xil_Out32(audio_hal_i2sAddr + I2S_CLK_CTRL_REG, i2sClkDiv);
+  audio_hal_ready = true;
+}
+
+/* ------------------------------------------------------------ */
+
+/***  I2SFifoWrite (u32 i2sBaseAddr, u32 audioData)
+**
+**  Parameters:
+**    i2sBaseAddr - Physical Base address of the I2S controller
+**    audioData - Audio data to be written to FIFO
+**
+**  Return Value: none
+**
+**  Errors:
+**
+**  Description:
+**    Blocks execution until space is available in the I2S TX fifo, then
+**    writes data to it.
+**
+*/
+static void I2SFifoWrite(u32 i2sBaseAddr, u32 audioData) {
+  while ((Xil_In32(i2sBaseAddr + I2S_FIFO_STS_REG)) & 0b0010) {
+  }
+  Xil_Out32(i2sBaseAddr + I2S_TX_FIFO_REG, audioData);
+}
+/* ------------------------------------------------------------ */
+
+/***  I2SFifoRead (u32 i2sBaseAddr)
+**
+**  Parameters:
+**    i2sBaseAddr - Physical Base address of the I2S controller
+**
+**  Return Value: u32
+**    Audio data from the I2S RX FIFO
+**
+**  Errors:
+**
+**  Description:
+**    Blocks execution until data is available in the I2S RX fifo, then
+**    reads it out.
+**
+*/
+static u32 I2SFifoRead(u32 i2sBaseAddr) {
+  while ((Xil_In32(i2sBaseAddr + I2S_FIFO_STS_REG)) & 0b0100) {
+  }
+  return Xil_In32(i2sBaseAddr + I2S_RX_FIFO_REG);
+}
+/* ------------------------------------------------------------ */
@@ -0,0 +1,232 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "autopilot.h"
+#include "config.h"
+#include "display.h"
+#include "missile.h"
+#include "touchscreen.h"
+
+#define SCREEN_WIDTH 320 //Display Width
+#define SCREEN_HEIGHT 240 //Display Height
+
+#define LOWEST_USEFUL_Y 225 //Intercepts below this land after the missile impacts
+#define HIGHEST_USEFUL_Y 12 //Stay below the stats line at the top
+
+#define INTERCEPT_ITERATIONS 4 //Refinements of the intercept time
+
+// Aim so the target is inside the explosion by the time it has grown halfway
+#define EXPLOSION_LEAD_US                                                      \
+  ((CONFIG_EXPLOSION_MAX_RADIUS / 2) * CONFIG_MICROSECONDS_PER_SECOND /        \
+   CONFIG_EXPLOSION_RADIUS_GROW_PER_SECOND)
+
+#define UFO_TARGET CONFIG_MAX_TOTAL_MISSILES //Slot in targeted[] for the UFO
+#define NO_TARGET -1
+
+static autopilot_config_t config;
+static bool enabled = false;
+
+// Targets that already have a shot on the way
+static bool targeted[CONFIG_MAX_TOTAL_MISSILES + 1];
+
+static bool touch_pending = false; //Target chosen, waiting out the reaction time
+static bool touch_released = false; //Touch is visible to gameControl
+static uint32_t reaction_left_us = 0;
+static uint32_t since_last_shot_us = 0;
+static display_point_t touch_location;
+
+static uint32_t random_state;
+
+//Own generator so the aim error does not disturb the game's rand() sequence
+static uint32_t nextRandom(){
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+//Returns a random offset within +/- the configured aim error
+static int16_t aimError(){
+    if(config.aim_error == 0){
+        return 0;
+    }
+    return (int16_t)(nextRandom() % (2 * config.aim_error + 1)) - config.aim_error;
+}
+
+//Clamp a coordinate onto the screen
+static double clamp(double value, double min, double max){
+    if(value < min){
+        return min;
+    }
+    if(value > max){
+        return max;
+    }
+    return value;
+}
+
+//Solve for the touch that makes a player missile meet a target at (x, y)
+//moving at (vx, vy) pixels per second. Returns false if there is no useful intercept.
+static bool solveIntercept(double x, double y, double vx, double vy, display_point_t *aim){
+    double lead_s = (double)(config.reaction_us + EXPLOSION_LEAD_US) / CONFIG_MICROSECONDS_PER_SECOND;
+    double t = lead_s;
+    double aim_x = x;
+    double aim_y = y;
+    //Flight time depends on the aim point and the aim point on flight time, so iterate
+    for(uint16_t i = 0; i < INTERCEPT_ITERATIONS; i++){
+        aim_x = x + (vx * t);
+        aim_y = y + (vy * t);
+        uint16_t site_x = getClosestLaunchSite(clamp(aim_x, 0, SCREEN_WIDTH - 1));
+        double flight = sqrt(pow(aim_x - site_x, 2) + pow(aim_y - SCREEN_HEIGHT, 2));
+        t = lead_s + (flight / CONFIG_PLAYER_MISSILE_DISTANCE_PER_SECOND);
+    }
+    if((aim_y > LOWEST_USEFUL_Y) || (aim_x < 0) || (aim_x >= SCREEN_WIDTH)){
+        return false;
+    }
+    aim->x = clamp(aim_x + aimError(), 0, SCREEN_WIDTH - 1);
+    aim->y = clamp(aim_y + aimError(), HIGHEST_USEFUL_Y, LOWEST_USEFUL_Y);
+    return true;
+}
+
+//Returns true if one of the player missile slots is free to fire
+static bool playerMissileAvailable(missile_t *missiles, uint16_t missile_count){
+    uint16_t busy = 0;
+    for(uint16_t i = 0; i < missile_count; i++){
+        if((missiles[i].type == MISSILE_TYPE_PLAYER) && !missile_is_dead(&missiles[i])){
+            busy++;
+        }
+    }
+    return busy < CONFIG_MAX_PLAYER_MISSILES;
+}
+
+//Pick the most urgent target that can still be intercepted and solve for it
+static int16_t chooseTarget(missile_t *missiles, uint16_t missile_count, display_point_t ufo,
+                            bool ufo_flying, display_point_t *aim){
+    if(config.target_ufo && ufo_flying && !targeted[UFO_TARGET]){
+        if(solveIntercept(ufo.x, ufo.y, -CONFIG_PLANE_DISTANCE_PER_SECOND, 0, aim)){
+            return UFO_TARGET;
+        }
+    }
+    int16_t target = NO_TARGET;
+    int16_t target_y = -1;
+    display_point_t candidate;
+    for(uint16_t i = 0; i < missile_count; i++){
+        missile_t *missile = &missiles[i];
+        if((missile->type == MISSILE_TYPE_PLAYER) || !missile_is_flying(missile) || targeted[i]){
+            continue;
+        }
+        if(missile->y_current <= target_y || missile->total_length == 0){ //Lowest missile is the most urgent
+            continue;
+        }
+        double scale = missile_get_speed(missile) / missile->total_length;
+        double vx = (missile->x_dest - missile->x_origin) * scale;
+        double vy = (missile->y_dest - missile->y_origin) * scale;
+        if(solveIntercept(missile->x_current, missile->y_current, vx, vy, &candidate)){
+            target = i;
+            target_y = missile->y_current;
+            *aim = candidate;
+        }
+    }
+    return target;
+}
+
+// Initialize the autopilot with the given model and clear any pending touch.
+// Passing NULL uses the defaults from config.h.
+void autopilot_init(const autopilot_config_t *new_config){
+    if(new_config){
+        config = *new_config;
+    }
+    else{
+        config.reaction_us = CONFIG_AUTOPILOT_REACTION_US;
+        config.shot_interval_us = CONFIG_AUTOPILOT_SHOT_INTERVAL_US;
+        config.aim_error = CONFIG_AUTOPILOT_AIM_ERROR;
+        config.target_ufo = false;
+        config.seed = CONFIG_AUTOPILOT_SEED;
+    }
+    random_state = config.seed ? config.seed : 1; //xorshift must not start at zero
+    for(uint16_t i = 0; i <= UFO_TARGET; i++){
+        targeted[i] = false;
+    }
+    touch_pending = false;
+    touch_released = false;
+    reaction_left_us = 0;
+    since_last_shot_us = config.shot_interval_us;
+}
+
+// Turn the autopilot on or off.
+void autopilot_enable(bool enable){
+    enabled = enable;
+}
+
+// Return whether the autopilot is providing the touches.
+bool autopilot_isEnabled(){
+    return enabled;
+}
+
+// Look at the flying enemy missiles and the UFO, pick a target and schedule a
+// touch on its intercept point.
+void autopilot_tick(missile_t *missiles, uint16_t missile_count,
+                    display_point_t ufo, bool ufo_flying, uint32_t elapsed_us){
+    if(!enabled){
+        return;
+    }
+    since_last_shot_us += elapsed_us;
+    //Forget targets that have been destroyed or have landed
+    for(uint16_t i = 0; i < missile_count && i < UFO_TARGET; i++){
+        if(!missile_is_flying(&missiles[i])){
+            targeted[i] = false;
+        }
+    }
+    if(!ufo_flying){
+        targeted[UFO_TARGET] = false;
+    }
+
+    if(touch_pending){ //Still reacting to the last target
+        if(reaction_left_us > elapsed_us){
+            reaction_left_us -= elapsed_us;
+            return;
+        }
+        touch_pending = false;
+        touch_released = true;
+        since_last_shot_us = 0;
+        return;
+    }
+    if(touch_released || (since_last_shot_us < config.shot_interval_us)){
+        return;
+    }
+    if(!playerMissileAvailable(missiles, missile_count)){
+        return;
+    }
+
+    int16_t target = chooseTarget(missiles, missile_count, ufo, ufo_flying, &touch_location);
+    if(target == NO_TARGET){
+        return;
+    }
+    targeted[target] = true;
+    if(config.reaction_us == 0){
+        touch_released = true;
+        since_last_shot_us = 0;
+    }
+    else{
+        touch_pending = true;
+        reaction_left_us = config.reaction_us;
+    }
+}
+
+// Same contract as touchscreen_get_status().
+touchscreen_status_t autopilot_get_status(){
+    if(enabled && touch_released){
+        return TOUCHSCREEN_RELEASED;
+    }
+    return TOUCHSCREEN_IDLE;
+}
+
+// Same contract as touchscreen_get_location().
+display_point_t autopilot_get_location(){
+    return touch_location;
+}
+
+// Same contract as touchscreen_ack_touch().
+void autopilot_ack_touch(){
+    touch_released = false;
+}
@@ -0,0 +1,50 @@
+#ifndef AUTOPILOT
+#define AUTOPILOT
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "display.h"
+#include "missile.h"
+#include "touchscreen.h"
+
+// Reaction-time and accuracy model for the autopilot player
+typedef struct {
+  // Game time between spotting a target and touching the screen
+  uint32_t reaction_us;
+  // Minimum game time between two touches
+  uint32_t shot_interval_us;
+  // Each touch lands up to this many pixels away from the solved intercept
+  uint16_t aim_error;
+  // Whether the autopilot should shoot at the UFO (shooting it ends the game)
+  bool target_ufo;
+  // Seed for the aim error so runs are repeatable
+  uint32_t seed;
+} autopilot_config_t;
+
+// Initialize the autopilot with the given model and clear any pending touch.
+// Passing NULL uses the defaults from config.h.
+void autopilot_init(const autopilot_config_t *config);
+
+// Turn the autopilot on or off.  While it is on, gameControl takes its touches
+// from the autopilot instead of the touchscreen.
+void autopilot_enable(bool enable);
+
+// Return whether the autopilot is providing the touches.
+bool autopilot_isEnabled();
+
+// Look at the flying enemy missiles and the UFO, pick a target and schedule a
+// touch on its intercept point.  elapsed_us is the game time since the last
+// call.
+void autopilot_tick(missile_t *missiles, uint16_t missile_count,
+                    display_point_t ufo, bool ufo_flying, uint32_t elapsed_us);
+
+// Same contract as touchscreen_get_status().
+touchscreen_status_t autopilot_get_status();
+
+// Same contract as touchscreen_get_location().
+display_point_t autopilot_get_location();
+
+// Same contract as touchscreen_ack_touch().
+void autopilot_ack_touch();
+
+#endif /* AUTOPILOT */
@@ -2,9 +2,70 @@
 #define CONFIG_H
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
 
 #define CONFIG_TOUCHSCREEN_TIMER_PERIOD 10.0E-3
 #define CONFIG_GAME_TIMER_PERIOD 45.0E-3
+// How often the audio FIFO is refilled. The FIFO holds about 10 ms of sound.
+#define CONFIG_AUDIO_TIMER_PERIOD 5.0E-3
+
+// All motion is driven by elapsed game time, measured in microseconds, so the
+// tick rate can change without changing how fast anything moves on screen.
+#define CONFIG_MICROSECONDS_PER_SECOND 1000000
+#define CONFIG_GAME_TIMER_PERIOD_US                                            \
+  ((uint32_t)(CONFIG_GAME_TIMER_PERIOD * CONFIG_MICROSECONDS_PER_SECOND))
+#define CONFIG_TOUCHSCREEN_TIMER_PERIOD_US                                     \
+  ((uint32_t)(CONFIG_TOUCHSCREEN_TIMER_PERIOD * CONFIG_MICROSECONDS_PER_SECOND))
+
+// The periods above are where the game starts. The tick rate can be changed
+// while it runs, see rate.h: typing 't' on the UART steps through
+// CONFIG_GAME_TICK_RATES_HZ, in ascending order. Periods outside the min and
+// max are refused.
+#define CONFIG_GAME_TICK_RATES_HZ {30, 60, 120}
+#define CONFIG_GAME_TIMER_MIN_PERIOD_US 2000
+#define CONFIG_GAME_TIMER_MAX_PERIOD_US 100000
+
+// Distance covered in elapsed_us at the given per-second rate
+#define CONFIG_DISTANCE_FOR_US(per_second, elapsed_us)                         \
+  (((double)(per_second) * (elapsed_us)) / CONFIG_MICROSECONDS_PER_SECOND)
+
+// What the main loop does when a game tick runs late and timer periods pile
+// up, see tick.h. CONFIG_TICK_MAX_CATCH_UP bounds the ticks run at once by
+// tick_catchUp_e so a slow stretch can't snowball.
+#define CONFIG_TICK_OVERRUN_POLICY tick_skip_e
+#define CONFIG_TICK_MAX_CATCH_UP 4
+
+// Time the sections of the game loop, see profile.h. Type 'p' on the UART to
+// print the profile and 'r' to clear it.
+#define CONFIG_PROFILE_ENABLED true
+
+// Record state machine changes in a ring of CONFIG_TRACE_RECORDS (a power of
+// two), see trace.h. Type 'd' on the UART to dump it. False compiles the
+// tracing out.
+#define CONFIG_TRACE_ENABLED true
+#define CONFIG_TRACE_RECORDS 256
+
+// Send a binary telemetry frame over the UART every
+// CONFIG_TELEMETRY_PERIOD_US, see telemetry.h. Decode a capture with
+// host/telemetrydecode. False leaves only the console text.
+#define CONFIG_TELEMETRY_ENABLED true
+#define CONFIG_TELEMETRY_PERIOD_US 250000
+
+// Draw the tick time, worst tick, dropped ticks and display operations in the
+// top right corner, see overlay.h. Type 'o' on the UART to show or hide it;
+// this is whether it starts out shown.
+#define CONFIG_OVERLAY_ENABLED false
+#define CONFIG_OVERLAY_COLOR DISPLAY_YELLOW
+
+// Optional drawing is shed when a game tick takes more than
+// CONFIG_QUALITY_SHED_PERCENT of the period, and restored after
+// CONFIG_QUALITY_RESTORE_TICKS ticks in a row under
+// CONFIG_QUALITY_RESTORE_PERCENT, see quality.h. A throttled HUD is redrawn
+// every CONFIG_QUALITY_HUD_INTERVAL ticks.
+#define CONFIG_QUALITY_SHED_PERCENT 80
+#define CONFIG_QUALITY_RESTORE_PERCENT 50
+#define CONFIG_QUALITY_RESTORE_TICKS 50
+#define CONFIG_QUALITY_HUD_INTERVAL 4
 
 #define CONFIG_MAX_ENEMY_MISSILES 7
 #define CONFIG_MAX_PLAYER_MISSILES 4
@@ -15,23 +76,21 @@
 
 // Speed of enemy missile
 #define CONFIG_ENEMY_MISSILE_DISTANCE_PER_SECOND 35
-#define CONFIG_ENEMY_MISSILE_DISTANCE_PER_TICK                                 \
-  (CONFIG_ENEMY_MISSILE_DISTANCE_PER_SECOND * CONFIG_GAME_TIMER_PERIOD)
+// Extra speed given to the faster enemy missiles
+#define CONFIG_ENEMY_MISSILE_BONUS_DISTANCE_PER_SECOND 22
 
 // Speed of player missile
 #define CONFIG_PLAYER_MISSILE_DISTANCE_PER_SECOND 350
-#define CONFIG_PLAYER_MISSILE_DISTANCE_PER_TICK                                \
-  (CONFIG_PLAYER_MISSILE_DISTANCE_PER_SECOND * CONFIG_GAME_TIMER_PERIOD)
+
+// Speed of plane missile
+#define CONFIG_PLANE_MISSILE_DISTANCE_PER_SECOND 35
 
 // How fast explosion radius increases/decreases per second
-#define CONFIG_EXPLOSION_RADIUS_CHANGE_PER_SECOND 30
-#define CONFIG_EXPLOSION_RADIUS_CHANGE_PER_TICK                                \
-  (CONFIG_EXPLOSION_RADIUS_CHANGE_PER_SECOND * CONFIG_GAME_TIMER_PERIOD)
+#define CONFIG_EXPLOSION_RADIUS_GROW_PER_SECOND 45
+#define CONFIG_EXPLOSION_RADIUS_SHRINK_PER_SECOND 30
 
 // Speed of plane
 #define CONFIG_PLANE_DISTANCE_PER_SECOND 210
-#define CONFIG_PLANE_DISTANCE_PER_TICK                                         \
-  (CONFIG_PLANE_DISTANCE_PER_SECOND * CONFIG_GAME_TIMER_PERIOD)
 
 #define CONFIG_COLOR_ENEMY DISPLAY_RED
 #define CONFIG_COLOR_PLAYER DISPLAY_GREEN
@@ -41,4 +100,35 @@
 
 #define CONFIG_EXPLOSION_MAX_RADIUS 25
 
+// Difficulty.  A header generated by host/tuner can override any of these by
+// being passed in as CONFIG_DIFFICULTY_HEADER.
+#ifdef CONFIG_DIFFICULTY_HEADER
+#include CONFIG_DIFFICULTY_HEADER
+#endif
+#ifndef CONFIG_ENEMY_MISSILE_COUNT
+#define CONFIG_ENEMY_MISSILE_COUNT CONFIG_MAX_ENEMY_MISSILES
+#endif
+#ifndef CONFIG_ENEMY_RESPAWN_DELAY_US
+#define CONFIG_ENEMY_RESPAWN_DELAY_US 0
+#endif
+#ifndef CONFIG_ENEMY_SPEED_MULTIPLIER_MAX
+#define CONFIG_ENEMY_SPEED_MULTIPLIER_MAX 1.5f
+#endif
+#ifndef CONFIG_UFO_RESPAWN_MIN_US
+#define CONFIG_UFO_RESPAWN_MIN_US 5000000
+#endif
+#ifndef CONFIG_UFO_RESPAWN_RANGE_SECONDS
+#define CONFIG_UFO_RESPAWN_RANGE_SECONDS 10
+#endif
+#ifndef CONFIG_GAME_OVER_IMPACTS
+#define CONFIG_GAME_OVER_IMPACTS 15
+#endif
+
+// Autopilot player used to generate repeatable benchmark workloads
+#define CONFIG_AUTOPILOT_ENABLED false
+#define CONFIG_AUTOPILOT_REACTION_US 250000 // Spotting a target to touching
+#define CONFIG_AUTOPILOT_SHOT_INTERVAL_US 150000 // Minimum time between touches
+#define CONFIG_AUTOPILOT_AIM_ERROR 4 // Max pixels each touch can be off by
+#define CONFIG_AUTOPILOT_SEED 330
+
 #endif /* CONFIG_H */
@@ -0,0 +1,13 @@
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+// Characters typed on the serial console, for debug commands.
+// console_xilinx.c reads the board's UART; host/console_host.c reads stdin.
+
+// Returned by console_readChar() when nothing was typed.
+#define CONSOLE_NO_CHAR -1
+
+// Returns the next character typed, or CONSOLE_NO_CHAR without waiting.
+int console_readChar();
+
+#endif /* CONSOLE_H_ */
@@ -0,0 +1,10 @@
+#include "console.h"
+#include "xparameters.h"
+#include "xuartps_hw.h"
+
+// Returns the next character typed, or CONSOLE_NO_CHAR without waiting.
+int console_readChar() {
+  if (!XUartPs_IsReceiveData(STDIN_BASEADDRESS))
+    return CONSOLE_NO_CHAR;
+  return XUartPs_RecvByte(STDIN_BASEADDRESS);
+}
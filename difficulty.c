@@ -0,0 +1,27 @@
+#include "difficulty.h"
+#include "config.h"
+
+// Compiled-in difficulty
+static const difficulty_t default_difficulty = {
+    .enemy_missile_count = CONFIG_ENEMY_MISSILE_COUNT,
+    .enemy_respawn_delay_us = CONFIG_ENEMY_RESPAWN_DELAY_US,
+    .enemy_speed_multiplier_max = CONFIG_ENEMY_SPEED_MULTIPLIER_MAX,
+    .ufo_respawn_min_us = CONFIG_UFO_RESPAWN_MIN_US,
+    .ufo_respawn_range_s = CONFIG_UFO_RESPAWN_RANGE_SECONDS,
+    .game_over_impacts = CONFIG_GAME_OVER_IMPACTS,
+};
+
+static difficulty_t current_difficulty = default_difficulty;
+
+// Return the difficulty currently in use.
+const difficulty_t *difficulty_get() { return &current_difficulty; }
+
+// Replace the difficulty currently in use.
+void difficulty_set(const difficulty_t *difficulty) {
+  current_difficulty = *difficulty;
+  if (current_difficulty.enemy_missile_count > CONFIG_MAX_ENEMY_MISSILES)
+    current_difficulty.enemy_missile_count = CONFIG_MAX_ENEMY_MISSILES;
+}
+
+// Go back to the compiled-in difficulty.
+void difficulty_reset() { current_difficulty = default_difficulty; }
@@ -0,0 +1,35 @@
+#ifndef DIFFICULTY
+#define DIFFICULTY
+
+#include <stdint.h>
+
+// The hand-tuned constants that decide how hard the game is.  They start out
+// with the values from config.h (or a tuned header generated by host/tuner)
+// and can be changed at runtime between games.
+typedef struct {
+  // Number of enemy missile slots that are relaunched (at most
+  // CONFIG_MAX_ENEMY_MISSILES)
+  uint16_t enemy_missile_count;
+  // Game time a dead enemy missile waits before it is relaunched
+  uint32_t enemy_respawn_delay_us;
+  // Enemy speed bonus is a random multiplier in [0, enemy_speed_multiplier_max)
+  float enemy_speed_multiplier_max;
+  // The UFO respawns between ufo_respawn_min_us and ufo_respawn_min_us +
+  // ufo_respawn_range_s seconds after it dies; a range of 0 respawns it after
+  // exactly ufo_respawn_min_us
+  uint32_t ufo_respawn_min_us;
+  uint16_t ufo_respawn_range_s;
+  // Number of enemy impacts that ends the game
+  uint16_t game_over_impacts;
+} difficulty_t;
+
+// Return the difficulty currently in use.
+const difficulty_t *difficulty_get();
+
+// Replace the difficulty currently in use.
+void difficulty_set(const difficulty_t *difficulty);
+
+// Go back to the compiled-in difficulty.
+void difficulty_reset();
+
+#endif /* DIFFICULTY */
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include "config.h"
 #include "display.h"
+#include "gameControl.h"
 #include "interrupts.h"
 #include "intervalTimer.h"
 #include "missile.h"
@@ -11,6 +12,12 @@
 #include <stdlib.h>
 #include "powerup.h"
 #include "sound.h"
+#include "autopilot.h"
+#include "difficulty.h"
+#include "profile.h"
+#include "swtimer.h"
+#include "quality.h"
+#include "overlay.h"
 
 missile_t missiles[CONFIG_MAX_TOTAL_MISSILES]; //Init missiles
 missile_t *enemy_missiles = &(missiles[0]); //Start of enemy missiles
@@ -31,12 +38,22 @@ missile_t *player_missiles = &(missiles[CONFIG_MAX_ENEMY_MISSILES]); //Start of
 #define IMPACTED_TEXT "Impacted: " //Impacted msg
 
 static bool first_half = true;
+// Each half of the missiles is only ticked every other call, so each half
+// collects the game time that passed since it was last ticked.
+static uint32_t first_half_elapsed_us = 0;
+static uint32_t second_half_elapsed_us = 0;
 
 static bool game_over = false;
 static bool game_win = false;
 
 static uint16_t number_player_missiles_shot = 0;
 static uint16_t number_enemy_missiles_impacted = 0;
+// The numbers on screen, which lag the counts while the HUD is throttled
+static uint16_t shown_player_missiles_shot = 0;
+static uint16_t shown_enemy_missiles_impacted = 0;
+
+// Game time each enemy missile slot has spent dead, used for the respawn delay
+static uint32_t enemy_dead_us[CONFIG_MAX_ENEMY_MISSILES];
 
 //Returns if the game is over or not
 bool getGameStatus() {
@@ -46,6 +63,22 @@ bool didYouWin(){
     return game_win;
 }
 
+//Returns the counters and how many missiles of each type are in the air
+gameControl_stats_t gameControl_getStats(){
+    gameControl_stats_t stats = {0};
+    stats.shots = number_player_missiles_shot;
+    stats.impacts = number_enemy_missiles_impacted;
+    for (uint16_t i = 0; i < CONFIG_MAX_TOTAL_MISSILES; i++){
+        if(missile_is_flying(&missiles[i])){
+            stats.flying[missiles[i].type]++;
+        }
+        else if(missile_is_exploding(&missiles[i])){
+            stats.exploding[missiles[i].type]++;
+        }
+    }
+    return stats;
+}
+
 //Draws all the buildings at the start of the game
 void drawBuildings(){
     display_fillRect(10, 180, 40, 60, DISPLAY_BLUE); //bldg 1
@@ -86,18 +119,48 @@ void drawBuildings(){
     display_fillRect(315, 215, 5, 5, DISPLAY_WHITE);
 }
 
-//Draw the stats at the top of the screen
+//Draw the stats at the top of the screen, erasing (black) erases the numbers last drawn
 void drawStats(uint16_t color){
+    if(color != DISPLAY_BLACK){
+        shown_player_missiles_shot = number_player_missiles_shot;
+        shown_enemy_missiles_impacted = number_enemy_missiles_impacted;
+    }
     display_setCursor(START_WIDTH, START_HEIGHT);
     display_setTextColor(color);
     display_setTextWrap(true);
     display_setTextSize(TEXT_SIZE);
     display_print(SHOT_TEXT);
-    display_printlnDecimalInt(number_player_missiles_shot);
+    display_printlnDecimalInt(shown_player_missiles_shot);
 
     display_setCursor(SECOND_WIDTH, START_HEIGHT);
     display_print(IMPACTED_TEXT);
-    display_printlnDecimalInt(number_enemy_missiles_impacted);
+    display_printlnDecimalInt(shown_enemy_missiles_impacted);
+}
+
+//Touches come from the autopilot while it is playing, otherwise from the touchscreen
+static touchscreen_status_t getTouchStatus(){
+    if(autopilot_isEnabled()){
+        return autopilot_get_status();
+    }
+    return touchscreen_get_status();
+}
+
+//Location of the last touch, from the same source as getTouchStatus()
+static display_point_t getTouchLocation(){
+    if(autopilot_isEnabled()){
+        return autopilot_get_location();
+    }
+    return touchscreen_get_location();
+}
+
+//Acknowledge the last touch, from the same source as getTouchStatus()
+static void ackTouch(){
+    if(autopilot_isEnabled()){
+        autopilot_ack_touch();
+    }
+    else{
+        touchscreen_ack_touch();
+    }
 }
 
 //Compute and return the total length between 2 points, can be used for double and total length
@@ -121,8 +184,23 @@ bool detectCollision(missile_t *enemy_missile, missile_t *any_missile){
 void gameControl_init(){
     // Initialize missiles to dead
   for (uint16_t i = 0; i < CONFIG_MAX_TOTAL_MISSILES; i++){
+    missiles[i].id = i;
     missile_init_dead(&missiles[i]);
   }
+  first_half = true;
+  first_half_elapsed_us = 0;
+  second_half_elapsed_us = 0;
+  for (uint16_t i = 0; i < CONFIG_MAX_ENEMY_MISSILES; i++){
+    enemy_dead_us[i] = 0;
+  }
+
+  game_over = false;
+  game_win = false;
+  number_player_missiles_shot = 0;
+  number_enemy_missiles_impacted = 0;
+  shown_player_missiles_shot = 0;
+  shown_enemy_missiles_impacted = 0;
+  quality_init(CONFIG_GAME_TIMER_PERIOD_US);
 
   #ifdef LAB8_M3
   plane_init(&missiles[PLANE_MISSILE]);//Init the plane
@@ -132,38 +210,56 @@ void gameControl_init(){
   //Set background color ---MAYBE needs to be taken out
   display_fillScreen(CONFIG_BACKGROUND_COLOR);
   drawBuildings();
+  overlay_init();
 }
 
 // Tick the game control logic
 //
 // This function should tick the missiles, handle screen touches, collisions,
 // and updating statistics.
-void gameControl_tick(){
+void gameControl_tick(uint32_t elapsed_us){
+    uint32_t tick_start = PROFILE_START();
+    uint32_t start = PROFILE_START();
+    quality_startTick();
+    bool hud_due = quality_hudDue(); //Erase and redraw together, or not at all
+    first_half_elapsed_us += elapsed_us;
+    second_half_elapsed_us += elapsed_us;
     if(first_half){
         //   Tick first half of enemy missiles
         for (uint16_t i = 0; i < FIRST_HALF_ENEMY_MISSILES; i++){
-            missile_tick(&missiles[i]);
+            missile_tick(&missiles[i], first_half_elapsed_us);
         } // Tick first half of player missiles
         for (uint16_t i = FIRST_HALF_PLAYER_MISSILES; i < SECOND_HALF_PLAYER_MISSILES; i++){
-            missile_tick(&missiles[i]);
+            missile_tick(&missiles[i], first_half_elapsed_us);
         }
+        first_half_elapsed_us = 0;
         first_half = false;
     }
     else{
         //   Tick second half of enemy missiles
         for (uint16_t i = FIRST_HALF_ENEMY_MISSILES; i < SECOND_HALF_ENEMY_MISSILES; i++){
-            missile_tick(&missiles[i]);
+            missile_tick(&missiles[i], second_half_elapsed_us);
         } //Tick second half of player missiles
         for (uint16_t i = SECOND_HALF_PLAYER_MISSILES; i < CONFIG_MAX_TOTAL_MISSILES; i++){
-            missile_tick(&missiles[i]);
+            missile_tick(&missiles[i], second_half_elapsed_us);
         }
+        second_half_elapsed_us = 0;
         first_half = true;
     }
+    PROFILE_RECORD(profile_missiles_e, start);
 
-    drawStats(DISPLAY_BLACK); //Draw stats on top of screen (Erase)
+    if(hud_due){
+        start = PROFILE_START();
+        drawStats(DISPLAY_BLACK); //Draw stats on top of screen (Erase)
+        PROFILE_RECORD(profile_statsErase_e, start);
+    }
     #ifdef LAB8_M3
-    plane_tick(); //Tick the plane
-    powerup_tick();
+    start = PROFILE_START();
+    plane_tick(elapsed_us); //Tick the plane
+    PROFILE_RECORD(profile_plane_e, start);
+    start = PROFILE_START();
+    powerup_tick(elapsed_us);
+    PROFILE_RECORD(profile_powerup_e, start);
     #endif
 
     //Read enemy missiles impacted
@@ -171,7 +267,7 @@ void gameControl_tick(){
         if(missiles[i].impacted){ //Only enemy and plane missiles are ever set to impacted, so I can count them
             missiles[i].impacted = false; //Reset this
             number_enemy_missiles_impacted++;
-            if(number_enemy_missiles_impacted == 15){
+            if(number_enemy_missiles_impacted == difficulty_get()->game_over_impacts){
                 game_over = true;
                 game_win = false;
                 sound_gameOver();
@@ -180,27 +276,46 @@ void gameControl_tick(){
         }
     }
 
-    // • If enemy missile is dead, relaunch it (call init again)
-    for (uint16_t i = 0; i < CONFIG_MAX_ENEMY_MISSILES; i++)
+    // • If enemy missile is dead, relaunch it (call init again) once its respawn delay is up
+    for (uint16_t i = 0; i < difficulty_get()->enemy_missile_count; i++){
         if (missile_is_dead(&enemy_missiles[i])) {
-        missile_init_enemy(&enemy_missiles[i]);
+            enemy_dead_us[i] += elapsed_us;
+            if (enemy_dead_us[i] >= difficulty_get()->enemy_respawn_delay_us) {
+                enemy_dead_us[i] = 0;
+                missile_init_enemy(&enemy_missiles[i]);
+            }
+        }
     }
 
+    // • Let the autopilot pick its targets before the touches are read
+    display_point_t ufoLocation = {0, 0};
+    bool ufoFlying = false;
+    #ifdef LAB8_M3
+    ufoLocation = plane_getXY();
+    ufoFlying = plane_isFlying();
+    #endif
+    start = PROFILE_START();
+    autopilot_tick(missiles, CONFIG_MAX_TOTAL_MISSILES, ufoLocation, ufoFlying, elapsed_us);
+    PROFILE_RECORD(profile_autopilot_e, start);
+
     // • If touchscreen touched, launch player missile (if one is available)
     // Check for dead player missiles and re-initialize
-    if(touchscreen_get_status() == TOUCHSCREEN_RELEASED){
+    start = PROFILE_START();
+    if(getTouchStatus() == TOUCHSCREEN_RELEASED){
         for (uint16_t i = 0; i < CONFIG_MAX_PLAYER_MISSILES; i++){
             if (missile_is_dead(&player_missiles[i])) {
-                missile_init_player(&player_missiles[i], touchscreen_get_location().x, touchscreen_get_location().y);
-                touchscreen_ack_touch();
+                missile_init_player(&player_missiles[i], getTouchLocation().x, getTouchLocation().y);
+                ackTouch();
                 number_player_missiles_shot++; //Increment our count
                 break; //Only do it for one missile
             }
         }
-        touchscreen_ack_touch();
+        ackTouch();
     }
+    PROFILE_RECORD(profile_touch_e, start);
 
     // • Detect collisions
+    start = PROFILE_START();
     // // Check if missile i should explode, caused by an exploding missile j
     for (uint16_t i = 0; i < CONFIG_MAX_ENEMY_MISSILES; i++){
         for (uint16_t j = 0; j < CONFIG_MAX_TOTAL_MISSILES; j++){
@@ -246,6 +361,18 @@ void gameControl_tick(){
         }
     }
     #endif
+    PROFILE_RECORD(profile_collision_e, start);
     //Stat Counter Section
-    drawStats(DISPLAY_WHITE); //Draw Stats
+    if(hud_due){
+        start = PROFILE_START();
+        drawStats(DISPLAY_WHITE); //Draw Stats
+        PROFILE_RECORD(profile_statsDraw_e, start);
+    }
+
+    //Game timers see the time this tick covered once it is done
+    swtimer_advance(swtimer_game_e, elapsed_us);
+    swtimer_runExpired(swtimer_game_e);
+    quality_endTick(); //Shed or restore drawing for the next tick
+    PROFILE_RECORD(profile_gameTick_e, tick_start);
+    overlay_tick(elapsed_us); //Performance overlay, drawn after the tick is timed
 }
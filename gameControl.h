@@ -2,6 +2,16 @@
 #define GAMECONTROL
 
 #include <stdbool.h>
+#include <stdint.h>
+#include "missile.h"
+
+// Counters reported by the telemetry stream
+typedef struct {
+  uint16_t shots;   // Player missiles launched
+  uint16_t impacts; // Enemy and plane missiles that reached the ground
+  uint8_t flying[MISSILE_TYPE_COUNT];    // Missiles flying, by missile_type_t
+  uint8_t exploding[MISSILE_TYPE_COUNT]; // Missiles exploding, by missile_type_t
+} gameControl_stats_t;
 
 // Initialize the game control logic
 // This function will initialize all missiles, stats, plane, etc.
@@ -10,12 +20,20 @@ void gameControl_init();
 // Tick the game control logic
 //
 // This function should tick the missiles, handle screen touches, collisions,
-// and updating statistics.
-void gameControl_tick();
+// and updating statistics.  elapsed_us is the game time, in microseconds, that
+// has passed since the previous call.
+void gameControl_tick(uint32_t elapsed_us);
+
+// Return whether enemy_missile is inside the explosion of any_missile
+bool detectCollision(missile_t *enemy_missile, missile_t *any_missile);
 
 //Returns a bool of whether or not the game is over
 bool getGameStatus();
 
 bool didYouWin();
 
+// Return the shot and impact counters and how many missiles of each type are
+// flying and exploding
+gameControl_stats_t gameControl_getStats();
+
 #endif /* GAMECONTROL */
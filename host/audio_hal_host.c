@@ -0,0 +1,211 @@
+// Host implementation of audio_hal.h: an emulated I2S TX FIFO feeding a null
+// sink or a WAV file.
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "audio_hal.h"
+#include "audio_hal_host.h"
+
+#define MAX_DEPTH 8192 // Largest FIFO that can be emulated.
+#define MICROSECONDS_PER_SECOND 1000000
+#define NANOSECONDS_PER_MICROSECOND 1000
+#define WAV_HEADER_SIZE 44
+#define WAV_CHUNK 256 // Samples converted at a time.
+
+static uint32_t fifo[MAX_DEPTH];
+static uint32_t depth = AUDIO_HAL_HOST_DEFAULT_DEPTH;
+static uint32_t head = 0; // Oldest sample.
+static uint32_t level = 0;
+static bool enabled = false;
+
+static uint32_t drainEveryPolls = 0;
+static uint32_t polls = 0;
+static uint32_t drainRate = AUDIO_HAL_SAMPLE_RATE;
+static uint64_t drainRemainder = 0; // Fraction of a sample owed, in us*rate.
+static bool realTime = false;
+static uint64_t lastPollUs = 0; // When real-time draining last drained.
+
+static audio_hal_host_stats_t stats = {.min_level = UINT32_MAX};
+
+static FILE *capture = NULL;
+static uint32_t captured = 0; // Samples written to the capture.
+
+////////// audio_hal.h //////////
+
+bool audio_hal_init() { return true; }
+
+bool audio_hal_isReady() { return true; }
+
+bool audio_hal_failed() { return false; }
+
+void audio_hal_resetTx() { level = 0; }
+
+void audio_hal_enableTx(bool enable) { enabled = enable; }
+
+static uint32_t removeSamples(uint32_t samples);
+static uint64_t nowUs();
+
+bool audio_hal_txFull() {
+  if (realTime) {
+    uint64_t now = nowUs();
+    audio_hal_host_advance(now - lastPollUs);
+    lastPollUs = now;
+  }
+  if (drainEveryPolls && ++polls >= drainEveryPolls) {
+    polls = 0;
+    removeSamples(1);
+  }
+  return level >= depth;
+}
+
+void audio_hal_write(uint32_t sampleValue) {
+  if (level < depth) {
+    fifo[(head + level) % MAX_DEPTH] = sampleValue;
+    level++;
+  }
+  stats.written++;
+}
+
+////////// Sink //////////
+
+static void putLittleEndian(FILE *fp, uint32_t value, uint8_t bytes) {
+  for (uint8_t i = 0; i < bytes; i++)
+    fputc((value >> (8 * i)) & 0xFF, fp);
+}
+
+// Header of a 16-bit mono WAV file holding samples samples.
+static void writeWavHeader(FILE *fp, uint32_t samples) {
+  uint32_t dataBytes = samples * sizeof(int16_t);
+  fwrite("RIFF", 1, 4, fp);
+  putLittleEndian(fp, WAV_HEADER_SIZE - 8 + dataBytes, 4);
+  fwrite("WAVEfmt ", 1, 8, fp);
+  putLittleEndian(fp, 16, 4);                              // fmt size.
+  putLittleEndian(fp, 1, 2);                               // PCM.
+  putLittleEndian(fp, 1, 2);                               // Mono.
+  putLittleEndian(fp, AUDIO_HAL_SAMPLE_RATE, 4);           // Sample rate.
+  putLittleEndian(fp, AUDIO_HAL_SAMPLE_RATE * 2, 4);       // Byte rate.
+  putLittleEndian(fp, sizeof(int16_t), 2);                 // Block align.
+  putLittleEndian(fp, 16, 2);                              // Bits.
+  fwrite("data", 1, 4, fp);
+  putLittleEndian(fp, dataBytes, 4);
+}
+
+// Send count samples starting at fifo[first] to the capture file.
+static void sink(uint32_t first, uint32_t count) {
+  if (!capture)
+    return;
+  int16_t out[WAV_CHUNK];
+  while (count) {
+    uint32_t length = count < WAV_CHUNK ? count : WAV_CHUNK;
+    for (uint32_t i = 0; i < length; i++) {
+      // Words are (sample + INT16_MAX) * volume; undo it for full volume.
+      int32_t sample =
+          (int32_t)(fifo[(first + i) % MAX_DEPTH] / INT16_MAX) - INT16_MAX;
+      out[i] = sample > INT16_MAX ? INT16_MAX : sample;
+    }
+    fwrite(out, sizeof(int16_t), length, capture);
+    captured += length;
+    first += length;
+    count -= length;
+  }
+}
+
+static uint64_t nowUs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * MICROSECONDS_PER_SECOND +
+         now.tv_nsec / NANOSECONDS_PER_MICROSECOND;
+}
+
+// Take up to samples out of the FIFO and play them.
+static uint32_t removeSamples(uint32_t samples) {
+  if (samples > level)
+    samples = level;
+  sink(head, samples);
+  head = (head + samples) % MAX_DEPTH;
+  level -= samples;
+  stats.played += samples;
+  return samples;
+}
+
+////////// Host hooks //////////
+
+void audio_hal_host_setDepth(uint32_t samples) {
+  depth = samples < MAX_DEPTH ? samples : MAX_DEPTH;
+}
+
+void audio_hal_host_setDrainEveryPolls(uint32_t pollCount) {
+  drainEveryPolls = pollCount;
+  polls = 0;
+}
+
+void audio_hal_host_setDrainRate(uint32_t samples_per_second) {
+  drainRate = samples_per_second;
+  drainRemainder = 0;
+}
+
+uint32_t audio_hal_host_drain(uint32_t samples) {
+  uint32_t played = removeSamples(samples);
+  if (!enabled)
+    return played;
+  if (played < samples) {
+    stats.underruns++;
+    stats.missing += samples - played;
+  }
+  // The level just after a drain is its low point, before the next refill.
+  stats.drains++;
+  stats.level_sum += level;
+  if (level > stats.max_level)
+    stats.max_level = level;
+  if (level < stats.min_level)
+    stats.min_level = level;
+  return played;
+}
+
+void audio_hal_host_advance(uint32_t microseconds) {
+  drainRemainder += (uint64_t)microseconds * drainRate;
+  uint32_t samples = drainRemainder / MICROSECONDS_PER_SECOND;
+  drainRemainder %= MICROSECONDS_PER_SECOND;
+  audio_hal_host_drain(samples);
+}
+
+void audio_hal_host_setRealTime(bool enable) {
+  realTime = enable;
+  lastPollUs = nowUs();
+}
+
+bool audio_hal_host_captureWav(const char *fileName) {
+  audio_hal_host_closeCapture();
+  capture = fopen(fileName, "wb");
+  if (!capture) {
+    fprintf(stderr, "Unable to open file: %s for writing.\n", fileName);
+    return false;
+  }
+  captured = 0;
+  writeWavHeader(capture, 0); // Sizes are filled in on close.
+  return true;
+}
+
+void audio_hal_host_closeCapture() {
+  if (!capture)
+    return;
+  fseek(capture, 0, SEEK_SET);
+  writeWavHeader(capture, captured);
+  fclose(capture);
+  capture = NULL;
+}
+
+audio_hal_host_stats_t audio_hal_host_getStats() {
+  audio_hal_host_stats_t current = stats;
+  current.level = level;
+  if (current.min_level == UINT32_MAX)
+    current.min_level = 0;
+  return current;
+}
+
+void audio_hal_host_resetStats() {
+  memset(&stats, 0, sizeof(stats));
+  stats.min_level = UINT32_MAX;
+}
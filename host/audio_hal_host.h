@@ -0,0 +1,65 @@
+#ifndef AUDIO_HAL_HOST_H_
+#define AUDIO_HAL_HOST_H_
+
+// Hooks into the emulated audio hardware behind audio_hal.h.  The TX FIFO
+// only drains when told to: by audio_hal_host_drain() or
+// audio_hal_host_advance(), which model the CODEC playing samples, or on
+// status polls after audio_hal_host_setDrainEveryPolls().  Played samples go
+// to a null sink unless a WAV capture is open.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define AUDIO_HAL_HOST_DEFAULT_DEPTH 512 // Stereo samples, like the board.
+
+typedef struct {
+  uint64_t written;    // Samples written to the FIFO.
+  uint64_t played;     // Samples drained from the FIFO.
+  uint64_t underruns;  // Drains that found too few samples while enabled.
+  uint64_t missing;    // Samples those drains were short by.
+  uint64_t drains;     // Number of drains while enabled, for the mean level.
+  uint64_t level_sum;  // Sum of the FIFO level left by each of those drains.
+  uint32_t level;      // Samples in the FIFO now.
+  uint32_t min_level;  // Lowest level left by a drain while enabled.
+  uint32_t max_level;  // Highest level left by a drain while enabled.
+} audio_hal_host_stats_t;
+
+// Set how many samples the TX FIFO holds before it reports full.
+void audio_hal_host_setDepth(uint32_t samples);
+
+// Drain one sample every polls polls of the FIFO status, 0 for never.  This
+// lets code that polls until there is room make progress without a CODEC.
+// Keep it above one or a fill loop never sees the FIFO full.
+void audio_hal_host_setDrainEveryPolls(uint32_t polls);
+
+// Set how many samples per second audio_hal_host_advance() drains.
+// AUDIO_HAL_SAMPLE_RATE by default.
+void audio_hal_host_setDrainRate(uint32_t samples_per_second);
+
+// Play up to samples from the FIFO, return how many were played.  Asking for
+// more than the FIFO holds while it is enabled counts as an underrun.
+uint32_t audio_hal_host_drain(uint32_t samples);
+
+// Play what the CODEC would in microseconds at the drain rate.
+void audio_hal_host_advance(uint32_t microseconds);
+
+// Drain in wall-clock time instead: every FIFO status poll plays what the
+// CODEC would have since the last one.  For the native game, where nothing
+// else plays the CODEC's part.
+void audio_hal_host_setRealTime(bool enable);
+
+// Write played samples to a 16-bit mono WAV file instead of the null sink.
+// Samples are converted as if played at sound_maximumVolume_e.  Returns false
+// if the file cannot be opened.
+bool audio_hal_host_captureWav(const char *fileName);
+
+// Finish the WAV file and go back to the null sink.
+void audio_hal_host_closeCapture();
+
+// Return the FIFO counters.
+audio_hal_host_stats_t audio_hal_host_getStats();
+
+// Clear the FIFO counters, except the level.
+void audio_hal_host_resetStats();
+
+#endif /* AUDIO_HAL_HOST_H_ */
@@ -0,0 +1,177 @@
+// Plays sounds through the real sound driver on the emulated audio hardware.
+//
+// Emulated time advances in steps of the driver period.  Each step the CODEC
+// drains a step's worth of samples at the drain rate, then the driver runs:
+// sound_isr() and sound_tick() like the board's audio interrupt and main loop,
+// or sound_tick() alone with -P.  At the end it reports the audio played, the
+// CPU time the driver spent per second of audio, underruns and the FIFO
+// level each drain left, one "name: value" per line.
+//
+// Usage: audioplay [-o capture.wav] [-n sound]... [-c copies] [-d seconds]
+//                  [-p period_us] [-r samples_per_second] [-f fifo_depth]
+//                  [-q nearest|linear] [-P]
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "audio_hal.h"
+#include "audio_hal_host.h"
+#include "config.h"
+#include "sound.h"
+
+#define NANOSECONDS_PER_SECOND 1000000000ULL
+#define USAGE                                                                  \
+  "Usage: audioplay [-o capture.wav] [-n sound]... [-c copies] [-d seconds]\n" \
+  "                 [-p period_us] [-r samples_per_second] [-f fifo_depth]\n"  \
+  "                 [-q nearest|linear] [-P]\n"
+
+typedef struct {
+  const char *name;
+  sound_sounds_t sound;
+} sound_name_t;
+
+static const sound_name_t soundNames[] = {
+    {"gameStart", sound_gameStart_e},
+    {"gunFire", sound_gunFire_e},
+    {"hit", sound_hit_e},
+    {"gunClick", sound_gunClick_e},
+    {"gunReload", sound_gunReload_e},
+    {"loseLife", sound_loseLife_e},
+    {"gameOver", sound_gameOver_e},
+    {"returnToBase", sound_returnToBase_e},
+    {"oneSecondSilence", sound_oneSecondSilence_e},
+    {"johnCena", sound_johnCena_e},
+    {"robloxOof", sound_robloxOof_e},
+    {"missionFailed", sound_missionFailed_e},
+};
+
+#define SOUND_NAME_COUNT (sizeof(soundNames) / sizeof(soundNames[0]))
+
+// Look a sound up by name, false if there is none.
+static bool findSound(const char *name, sound_sounds_t *sound) {
+  for (uint32_t i = 0; i < SOUND_NAME_COUNT; i++) {
+    if (!strcmp(soundNames[i].name, name)) {
+      *sound = soundNames[i].sound;
+      return true;
+    }
+  }
+  fprintf(stderr, "ERROR: no sound called %s. Sounds are:", name);
+  for (uint32_t i = 0; i < SOUND_NAME_COUNT; i++)
+    fprintf(stderr, " %s", soundNames[i].name);
+  fprintf(stderr, "\n");
+  return false;
+}
+
+static uint64_t cpuNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * NANOSECONDS_PER_SECOND + ts.tv_nsec;
+}
+
+int main(int argc, char *argv[]) {
+  const char *captureFile = NULL;
+  sound_sounds_t sounds[SOUND_VOICE_COUNT];
+  uint32_t soundCount = 0;
+  uint32_t copies = 1;
+  double seconds = 0; // 0 plays until every sound is done.
+  uint32_t periodUs =
+      (uint32_t)(CONFIG_AUDIO_TIMER_PERIOD * CONFIG_MICROSECONDS_PER_SECOND);
+  uint32_t rate = AUDIO_HAL_SAMPLE_RATE;
+  uint32_t depth = AUDIO_HAL_HOST_DEFAULT_DEPTH;
+  sound_resample_t quality = sound_linearResample_e;
+  bool interruptDriven = true;
+  int opt;
+  while ((opt = getopt(argc, argv, "o:n:c:d:p:r:f:q:P")) != -1) {
+    switch (opt) {
+    case 'o':
+      captureFile = optarg;
+      break;
+    case 'n':
+      if (soundCount == SOUND_VOICE_COUNT || !findSound(optarg, &sounds[soundCount]))
+        return -1;
+      soundCount++;
+      break;
+    case 'c':
+      copies = atoi(optarg);
+      break;
+    case 'd':
+      seconds = atof(optarg);
+      break;
+    case 'p':
+      periodUs = atoi(optarg);
+      break;
+    case 'r':
+      rate = atoi(optarg);
+      break;
+    case 'f':
+      depth = atoi(optarg);
+      break;
+    case 'q':
+      quality = strcmp(optarg, "nearest") ? sound_linearResample_e
+                                          : sound_nearestResample_e;
+      break;
+    case 'P':
+      interruptDriven = false;
+      break;
+    default:
+      fprintf(stderr, USAGE);
+      return -1;
+    }
+  }
+  if (soundCount == 0)
+    sounds[soundCount++] = sound_gameOver_e;
+  if (periodUs == 0 || copies == 0) {
+    fprintf(stderr, USAGE);
+    return -1;
+  }
+  if (captureFile && !audio_hal_host_captureWav(captureFile))
+    return -1;
+  audio_hal_host_setDepth(depth);
+  audio_hal_host_setDrainRate(rate);
+
+  sound_init();
+  sound_tick(); // init -> wait
+  sound_setVolume(sound_maximumVolume_e);
+  sound_setResampleQuality(quality);
+  sound_setInterruptDriven(interruptDriven);
+  // With a duration the sounds loop until it is up.
+  uint32_t voices = soundCount * copies;
+  for (uint32_t c = 0; c < copies; c++)
+    for (uint32_t i = 0; i < soundCount; i++)
+      sound_playVoice(sounds[i], SOUND_GAIN_UNITY / voices, seconds > 0);
+
+  uint64_t cpu = 0;
+  uint64_t steps = 0;
+  uint64_t maxSteps = seconds * CONFIG_MICROSECONDS_PER_SECOND / periodUs;
+  audio_hal_host_resetStats();
+  while (seconds > 0 ? steps < maxSteps : sound_isBusy()) {
+    audio_hal_host_advance(periodUs);
+    uint64_t start = cpuNs();
+    if (interruptDriven)
+      sound_isr();
+    sound_tick();
+    cpu += cpuNs() - start;
+    steps++;
+  }
+  sound_stopSound();
+  audio_hal_host_closeCapture();
+
+  audio_hal_host_stats_t stats = audio_hal_host_getStats();
+  double audioSeconds = (double)stats.played / AUDIO_HAL_SAMPLE_RATE;
+  printf("audio_seconds: %.3f\n", audioSeconds);
+  printf("cpu_ms_per_audio_second: %.4f\n",
+         audioSeconds > 0 ? cpu / 1e6 / audioSeconds : 0);
+  printf("underruns: %llu\n", (unsigned long long)stats.underruns);
+  printf("missing_samples: %llu\n", (unsigned long long)stats.missing);
+  printf("fifo_depth: %u\n", depth);
+  printf("fifo_min: %u\n", stats.min_level);
+  printf("fifo_mean: %.1f\n",
+         stats.drains ? (double)stats.level_sum / stats.drains : 0);
+  printf("fifo_max: %u\n", stats.max_level);
+  return 0;
+}
@@ -0,0 +1,440 @@
+// Microbenchmarks for the game hot paths.
+//
+// Each benchmark is run for a growing number of iterations until it takes at
+// least the minimum time, then reported as one JSON object per line:
+//   {"benchmark": ..., "iterations": ..., "ns_per_op": ...,
+//    "allocs_per_op": ..., "display_ops_per_op": ...}
+// Setup work is excluded by stopping the clock around it.  Allocations are
+// counted by wrapping malloc/calloc/realloc at link time, display operations
+// by the host display stand-in.  A benchmark of something that draws fails,
+// and bench exits non-zero, if it made no display operations at all: it would
+// be timing a state that does nothing.
+//
+// The real sound driver runs on the emulated I2S FIFO.  For the game
+// benchmarks the FIFO drains a sample every other status poll, so a blocking
+// sound started by the game costs the CPU time of writing it out rather than
+// the wall time of playing it.
+//
+// -s plays the sounds from a sound blob mapped from disk instead of the one
+// linked into the program.  -r runs the game and sound ticks at another tick
+// rate, to find the fastest rate a tick and its audio still fit into.
+//
+// Usage: bench [-m min_seconds] [-f filter_substring] [-s sounds.bin]
+//              [-r tick_hz]
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "audio_hal.h"
+#include "audio_hal_host.h"
+#include "autopilot.h"
+#include "config.h"
+#include "difficulty.h"
+#include "display.h"
+#include "display_host.h"
+#include "gameControl.h"
+#include "missile.h"
+#include "plane.h"
+#include "powerup.h"
+#include "sound.h"
+#include "sound_assets_host.h"
+#include "swtimer.h"
+
+#define DEFAULT_MIN_SECONDS 0.25
+#define MAX_ITERATIONS (1ULL << 32)
+#define MISSILE_BATCH 256
+// Samples drained by the CODEC between two audio interrupts.
+#define SAMPLES_PER_ISR                                                        \
+  ((uint32_t)(AUDIO_HAL_SAMPLE_RATE * CONFIG_AUDIO_TIMER_PERIOD))
+
+// Game time covered by one game tick, set by -r.
+static uint32_t tick_us = CONFIG_GAME_TIMER_PERIOD_US;
+
+// Samples the CODEC drains from the FIFO during one game tick.
+static uint32_t samplesPerTick() {
+  return (uint64_t)AUDIO_HAL_SAMPLE_RATE * tick_us /
+         CONFIG_MICROSECONDS_PER_SECOND;
+}
+
+// Audio interrupts per game tick, at least one.
+static uint32_t audioIsrsPerTick() {
+  uint32_t isrs = (uint32_t)((double)tick_us / CONFIG_MICROSECONDS_PER_SECOND /
+                                 CONFIG_AUDIO_TIMER_PERIOD +
+                             0.5);
+  return isrs ? isrs : 1;
+}
+
+////////// Allocation counting //////////
+static uint64_t allocations = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+  allocations++;
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  allocations++;
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  allocations++;
+  return __real_realloc(ptr, size);
+}
+
+////////// Benchmark timer //////////
+// Only the time, allocations and display operations between benchStart() and
+// benchStop() are counted.
+static bool running = false;
+static uint64_t start_ns, elapsed_ns;
+static uint64_t start_allocs, counted_allocs;
+static uint64_t start_ops, counted_ops;
+
+static uint64_t nowNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void benchStart() {
+  if (running)
+    return;
+  running = true;
+  start_allocs = allocations;
+  start_ops = display_host_getStats().ops;
+  start_ns = nowNs();
+}
+
+static void benchStop() {
+  if (!running)
+    return;
+  elapsed_ns += nowNs() - start_ns;
+  counted_allocs += allocations - start_allocs;
+  counted_ops += display_host_getStats().ops - start_ops;
+  running = false;
+}
+
+static void benchReset() {
+  running = false;
+  elapsed_ns = counted_allocs = counted_ops = 0;
+}
+
+// Keeps results alive so the compiler cannot drop the work.
+static volatile double sink;
+
+////////// Benchmarks //////////
+// Every benchmark runs n iterations of its operation.  The clock is running on
+// entry; setup is bracketed with benchStop()/benchStart().
+
+static void startGame(uint16_t enemies) {
+  difficulty_t difficulty = *difficulty_get();
+  difficulty.enemy_missile_count = enemies;
+  difficulty_set(&difficulty);
+  srand(CONFIG_AUTOPILOT_SEED);
+  display_init();
+  gameControl_init();
+  autopilot_init(NULL);
+  autopilot_enable(true);
+}
+
+// Bring a batch of enemy missiles into the state reached by prepare, then tick
+// each of them once per iteration.
+static void missileTickBench(uint64_t n, void (*prepare)(missile_t *)) {
+  static missile_t batch[MISSILE_BATCH];
+  for (uint64_t done = 0; done < n;) {
+    benchStop();
+    for (uint16_t i = 0; i < MISSILE_BATCH; i++)
+      prepare(&batch[i]);
+    benchStart();
+    for (uint16_t i = 0; i < MISSILE_BATCH && done < n; i++, done++)
+      missile_tick(&batch[i], tick_us);
+  }
+}
+
+static void prepareInit(missile_t *missile) { missile_init_enemy(missile); }
+
+static void prepareMove(missile_t *missile) {
+  missile_init_enemy(missile);
+  missile_tick(missile, 0); // init -> move
+}
+
+static void prepareGrow(missile_t *missile) {
+  prepareMove(missile);
+  missile_trigger_explosion(missile);
+  missile_tick(missile, 0); // move -> grow
+}
+
+static void prepareShrink(missile_t *missile) {
+  prepareGrow(missile);
+  missile_tick(missile, CONFIG_MICROSECONDS_PER_SECOND); // past max radius
+  missile_tick(missile, 0);                              // grow -> shrink
+}
+
+static void prepareDead(missile_t *missile) { missile_init_dead(missile); }
+
+static void benchMissileInit(uint64_t n) { missileTickBench(n, prepareInit); }
+static void benchMissileMove(uint64_t n) { missileTickBench(n, prepareMove); }
+static void benchMissileGrow(uint64_t n) { missileTickBench(n, prepareGrow); }
+static void benchMissileShrink(uint64_t n) {
+  missileTickBench(n, prepareShrink);
+}
+static void benchMissileDead(uint64_t n) { missileTickBench(n, prepareDead); }
+
+static void benchComputeLength(uint64_t n) {
+  double total = 0;
+  for (uint64_t i = 0; i < n; i++)
+    total += computeLength(i % 320, i % 240, (i * 7) % 320, (i * 13) % 240);
+  sink = total;
+}
+
+static void benchDetectCollision(uint64_t n) {
+  missile_t enemy, explosion;
+  benchStop();
+  prepareMove(&enemy);
+  prepareGrow(&explosion);
+  benchStart();
+  uint64_t hits = 0;
+  for (uint64_t i = 0; i < n; i++) {
+    enemy.x_current = i % 320;
+    enemy.y_current = (i >> 3) % 240;
+    hits += detectCollision(&enemy, &explosion);
+  }
+  sink = hits;
+}
+
+static void gameControlBench(uint64_t n, uint16_t enemies) {
+  benchStop();
+  startGame(enemies);
+  benchStart();
+  for (uint64_t i = 0; i < n; i++) {
+    if (getGameStatus()) { // Keep playing until enough ticks are measured.
+      benchStop();
+      startGame(enemies);
+      benchStart();
+    }
+    gameControl_tick(tick_us);
+  }
+}
+
+static void benchGameControl1(uint64_t n) { gameControlBench(n, 1); }
+static void benchGameControl3(uint64_t n) { gameControlBench(n, 3); }
+static void benchGameControl7(uint64_t n) {
+  gameControlBench(n, CONFIG_MAX_ENEMY_MISSILES);
+}
+
+// Advance game time the way gameControl_tick() does, so the respawn timers
+// bring the plane and powerup back after they die.
+static void gameTime(uint32_t elapsed_us) {
+  swtimer_advance(swtimer_game_e, elapsed_us);
+  swtimer_runExpired(swtimer_game_e);
+}
+
+static void benchPlaneTick(uint64_t n) {
+  static missile_t planeMissile;
+  benchStop();
+  srand(CONFIG_AUTOPILOT_SEED);
+  missile_init_dead(&planeMissile);
+  plane_init(&planeMissile);
+  benchStart();
+  for (uint64_t i = 0; i < n; i++) {
+    plane_tick(tick_us);
+    gameTime(tick_us);
+  }
+}
+
+static void benchPowerupTick(uint64_t n) {
+  benchStop();
+  srand(CONFIG_AUTOPILOT_SEED);
+  powerup_init();
+  benchStart();
+  for (uint64_t i = 0; i < n; i++) {
+    powerup_tick(tick_us);
+    gameTime(tick_us);
+  }
+}
+
+// One sound_tick after the CODEC has drained a game tick's worth of samples,
+// with the given number of looping voices of sound mixed together.
+static void soundTickBench(uint64_t n, sound_sounds_t sound, uint8_t voices,
+                           sound_resample_t quality) {
+  benchStop();
+  audio_hal_host_setDrainEveryPolls(0);
+  sound_stopSound();
+  sound_setResampleQuality(quality);
+  for (uint8_t v = 0; v < voices; v++)
+    sound_playVoice(sound, SOUND_GAIN_UNITY / voices, true);
+  benchStart();
+  for (uint64_t i = 0; i < n; i++) {
+    audio_hal_host_drain(samplesPerTick());
+    sound_tick();
+  }
+  benchStop();
+  sound_stopSound();
+  sound_setResampleQuality(sound_linearResample_e);
+  audio_hal_host_setDrainEveryPolls(2);
+}
+
+// sound_gameOver_e is recorded at 48 kHz, sound_johnCena_e at 22.05 kHz and
+// sound_gunFire_e is synthesized.
+static void benchSoundTick1(uint64_t n) {
+  soundTickBench(n, sound_gameOver_e, 1, sound_linearResample_e);
+}
+static void benchSoundTick8(uint64_t n) {
+  soundTickBench(n, sound_gameOver_e, SOUND_VOICE_COUNT,
+                 sound_linearResample_e);
+}
+static void benchSoundTickNearest(uint64_t n) {
+  soundTickBench(n, sound_johnCena_e, 1, sound_nearestResample_e);
+}
+static void benchSoundTickLinear(uint64_t n) {
+  soundTickBench(n, sound_johnCena_e, 1, sound_linearResample_e);
+}
+static void benchSoundTickSynth(uint64_t n) {
+  soundTickBench(n, sound_gunFire_e, 1, sound_linearResample_e);
+}
+
+// One game tick of interrupt-driven playback: the audio interrupt refills the
+// FIFO every CONFIG_AUDIO_TIMER_PERIOD and the main loop mixes in between.
+// An underrun means the FIFO ran dry before the interrupt came.
+static void benchSoundIsr(uint64_t n) {
+  benchStop();
+  audio_hal_host_setDrainEveryPolls(0);
+  sound_stopSound();
+  sound_setInterruptDriven(true);
+  for (uint8_t v = 0; v < SOUND_VOICE_COUNT; v++)
+    sound_playVoice(sound_gameOver_e, SOUND_GAIN_UNITY / SOUND_VOICE_COUNT,
+                    true);
+  sound_tick(); // wait -> play, mixes the first buffer.
+  sound_isr();
+  uint64_t underruns = audio_hal_host_getStats().underruns;
+  benchStart();
+  for (uint64_t i = 0; i < n; i++) {
+    for (uint32_t isr = 0; isr < audioIsrsPerTick(); isr++) {
+      audio_hal_host_drain(SAMPLES_PER_ISR);
+      sound_isr();
+      sound_tick();
+    }
+  }
+  benchStop();
+  underruns = audio_hal_host_getStats().underruns - underruns;
+  if (underruns)
+    fprintf(stderr, "sound_isr: %llu underruns in %llu ticks\n",
+            (unsigned long long)underruns, (unsigned long long)n);
+  sound_stopSound();
+  sound_setInterruptDriven(false);
+  audio_hal_host_setDrainEveryPolls(2);
+}
+
+typedef struct {
+  const char *name;
+  void (*run)(uint64_t n);
+  bool draws; // Must make display operations, or it is measuring nothing.
+} benchmark_t;
+
+static const benchmark_t benchmarks[] = {
+    {"missile_tick/init", benchMissileInit, true},
+    {"missile_tick/move", benchMissileMove, true},
+    {"missile_tick/explode_grow", benchMissileGrow, true},
+    {"missile_tick/explode_shrink", benchMissileShrink, true},
+    {"missile_tick/dead", benchMissileDead},
+    {"computeLength", benchComputeLength},
+    {"detectCollision", benchDetectCollision},
+    {"gameControl_tick/enemies=1", benchGameControl1, true},
+    {"gameControl_tick/enemies=3", benchGameControl3, true},
+    {"gameControl_tick/enemies=7", benchGameControl7, true},
+    {"plane_tick", benchPlaneTick, true},
+    {"powerup_tick", benchPowerupTick, true},
+    {"sound_tick/voices=1", benchSoundTick1},
+    {"sound_tick/voices=8", benchSoundTick8},
+    {"sound_tick/resample=nearest", benchSoundTickNearest},
+    {"sound_tick/resample=linear", benchSoundTickLinear},
+    {"sound_tick/synth", benchSoundTickSynth},
+    {"sound_isr/voices=8", benchSoundIsr},
+};
+
+#define BENCHMARK_COUNT (sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+// Run one benchmark with a growing iteration count until it takes min_ns.
+// Returns false if a benchmark that should draw made no display operations.
+static bool runBenchmark(FILE *out, const benchmark_t *benchmark,
+                         uint64_t min_ns) {
+  uint64_t n = 1;
+  while (true) {
+    benchReset();
+    benchStart();
+    benchmark->run(n);
+    benchStop();
+    if (elapsed_ns >= min_ns || n >= MAX_ITERATIONS)
+      break;
+    // Aim for the minimum time with some headroom, growing at most 100x.
+    uint64_t next = elapsed_ns ? n * min_ns * 6 / 5 / elapsed_ns : n * 100;
+    if (next > n * 100)
+      next = n * 100;
+    n = next > n ? next : n + 1;
+  }
+  fprintf(out,
+          "{\"benchmark\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.2f, "
+          "\"allocs_per_op\": %.4f, \"display_ops_per_op\": %.4f}\n",
+          benchmark->name, (unsigned long long)n, (double)elapsed_ns / n,
+          (double)counted_allocs / n, (double)counted_ops / n);
+  fflush(out);
+  if (benchmark->draws && counted_ops == 0) {
+    fprintf(stderr, "%s: no display operations, the state it measures never "
+                    "draws\n",
+            benchmark->name);
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  double minSeconds = DEFAULT_MIN_SECONDS;
+  const char *filter = NULL;
+  const char *soundFile = NULL;
+  int opt;
+  while ((opt = getopt(argc, argv, "m:f:s:r:")) != -1) {
+    switch (opt) {
+    case 'm':
+      minSeconds = atof(optarg);
+      break;
+    case 'f':
+      filter = optarg;
+      break;
+    case 's':
+      soundFile = optarg;
+      break;
+    case 'r':
+      if (atoi(optarg) <= 0) {
+        fprintf(stderr, "The tick rate must be positive.\n");
+        return -1;
+      }
+      tick_us = CONFIG_MICROSECONDS_PER_SECOND / atoi(optarg);
+      break;
+    default:
+      fprintf(stderr, "Usage: bench [-m min_seconds] [-f filter_substring] "
+                      "[-s sounds.bin] [-r tick_hz]\n");
+      return -1;
+    }
+  }
+  if (soundFile && !sound_assets_host_mapFile(soundFile))
+    return -1;
+  FILE *out = stdout;
+  sound_init();
+  sound_tick(); // init -> wait
+  audio_hal_host_setDrainEveryPolls(2);
+
+  bool ok = true;
+  for (uint32_t i = 0; i < BENCHMARK_COUNT; i++)
+    if (!filter || strstr(benchmarks[i].name, filter))
+      ok &= runBenchmark(out, &benchmarks[i], (uint64_t)(minSeconds * 1e9));
+  return ok ? 0 : -1;
+}
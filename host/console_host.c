@@ -0,0 +1,13 @@
+#include <poll.h>
+#include <unistd.h>
+
+#include "console.h"
+
+// Returns the next character typed, or CONSOLE_NO_CHAR without waiting.
+int console_readChar() {
+  struct pollfd input = {.fd = STDIN_FILENO, .events = POLLIN};
+  unsigned char c;
+  if (poll(&input, 1, 0) <= 0 || read(STDIN_FILENO, &c, 1) != 1)
+    return CONSOLE_NO_CHAR;
+  return c;
+}
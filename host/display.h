@@ -0,0 +1,56 @@
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+// Host stand-in for the ECEn 330 display driver.  Only the part of the API the
+// game uses is provided.  Drawing goes to an in-memory framebuffer, see
+// display_host.h.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DISPLAY_WIDTH 320
+#define DISPLAY_HEIGHT 240
+
+// RGB565 colors, same values as the board driver.
+#define DISPLAY_BLACK 0x0000
+#define DISPLAY_BLUE 0x001F
+#define DISPLAY_RED 0xF800
+#define DISPLAY_GREEN 0x07E0
+#define DISPLAY_CYAN 0x07FF
+#define DISPLAY_MAGENTA 0xF81F
+#define DISPLAY_YELLOW 0xFFE0
+#define DISPLAY_WHITE 0xFFFF
+#define DISPLAY_DARK_BLUE 0x000F
+#define DISPLAY_DARK_GREEN 0x03E0
+#define DISPLAY_DARK_CYAN 0x03EF
+#define DISPLAY_DARK_RED 0x7800
+#define DISPLAY_DARK_MAGENTA 0x780F
+#define DISPLAY_DARK_YELLOW 0x7BE0
+#define DISPLAY_LIGHT_GRAY 0xC618
+#define DISPLAY_DARK_GRAY 0x7BEF
+
+typedef struct {
+  int16_t x;
+  int16_t y;
+} display_point_t;
+
+void display_init();
+void display_fillScreen(uint16_t color);
+void display_drawPixel(int16_t x, int16_t y, uint16_t color);
+void display_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                      uint16_t color);
+void display_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint16_t color);
+void display_fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+void display_fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                          int16_t x2, int16_t y2, uint16_t color);
+void display_drawChar(int16_t x, int16_t y, char c, uint16_t color,
+                      uint16_t bg, uint8_t size);
+void display_setCursor(int16_t x, int16_t y);
+void display_setTextColor(uint16_t color);
+void display_setTextSize(uint8_t size);
+void display_setTextWrap(bool wrap);
+void display_print(const char *str);
+void display_printlnDecimalInt(int32_t value);
+
+#endif /* DISPLAY_H_ */
@@ -0,0 +1,353 @@
+// Host stand-in for the ECEn 330 display driver.
+//
+// Draws into an in-memory RGB565 framebuffer and counts every drawing call and
+// every pixel written, so rendering changes can be checked for both output and
+// cost.  The primitives follow the Adafruit GFX algorithms the board driver is
+// built on.  There is no font ROM; each character is drawn as a 5x7 pattern
+// derived from its code, which is enough to make text show up in the hash and
+// in the pixel counts.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "display.h"
+#include "display_host.h"
+
+#define CHAR_WIDTH 6 // 5 pixel glyph plus one column of spacing.
+#define CHAR_HEIGHT 8
+#define GLYPH_COLUMNS 5
+#define GLYPH_ROWS 7
+
+#define PPM_MAX_VALUE 255
+
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+static uint16_t framebuffer[DISPLAY_HEIGHT * DISPLAY_WIDTH];
+static display_host_stats_t stats;
+static bool raster = true;
+
+static int16_t cursor_x, cursor_y;
+static uint16_t text_color = DISPLAY_WHITE;
+static uint8_t text_size = 1;
+static bool text_wrap = true;
+
+// Write one pixel, clipped to the screen.
+static void writePixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT)
+    return;
+  framebuffer[y * DISPLAY_WIDTH + x] = color;
+  stats.pixels++;
+}
+
+// Clipped solid rectangle.
+static void writeRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint16_t color) {
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  if (h < 0) {
+    y += h + 1;
+    h = -h;
+  }
+  int16_t x0 = x < 0 ? 0 : x;
+  int16_t y0 = y < 0 ? 0 : y;
+  int16_t x1 = x + w > DISPLAY_WIDTH ? DISPLAY_WIDTH : x + w;
+  int16_t y1 = y + h > DISPLAY_HEIGHT ? DISPLAY_HEIGHT : y + h;
+  for (int16_t row = y0; row < y1; row++)
+    for (int16_t col = x0; col < x1; col++)
+      framebuffer[row * DISPLAY_WIDTH + col] = color;
+  if (x1 > x0 && y1 > y0)
+    stats.pixels += (uint64_t)(x1 - x0) * (y1 - y0);
+}
+
+static void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  writeRect(x, y, 1, h, color);
+}
+
+static void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  writeRect(x, y, w, 1, color);
+}
+
+// Bresenham line.
+static void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                      uint16_t color) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  int16_t t;
+  if (steep) {
+    t = x0, x0 = y0, y0 = t;
+    t = x1, x1 = y1, y1 = t;
+  }
+  if (x0 > x1) {
+    t = x0, x0 = x1, x1 = t;
+    t = y0, y0 = y1, y1 = t;
+  }
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = y0 < y1 ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep)
+      writePixel(y0, x0, color);
+    else
+      writePixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+// Quarter-circle fill helper, corners is a mask of the halves to fill.
+static void fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
+                             uint8_t corners, int16_t delta, uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+  delta++;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < (y + 1)) {
+      if (corners & 1)
+        writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if (corners & 2)
+        writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if (y != py) {
+      if (corners & 1)
+        writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if (corners & 2)
+        writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+// Draw one character cell at (x, y).  Transparent when bg == color.
+static void writeChar(int16_t x, int16_t y, char c, uint16_t color,
+                      uint16_t bg, uint8_t size) {
+  for (int8_t col = 0; col < GLYPH_COLUMNS; col++) {
+    // Stand-in glyph: a fixed 7-bit pattern per column, blank for spaces.
+    uint32_t pattern = 0;
+    if (c != ' ') {
+      pattern = ((uint8_t)c * 2654435761u) >> (col * 5);
+      pattern = (pattern ^ (pattern >> 11)) & 0x7F;
+    }
+    for (int8_t row = 0; row < CHAR_HEIGHT; row++) {
+      bool on = row < GLYPH_ROWS && ((pattern >> row) & 1);
+      if (!on && bg == color)
+        continue;
+      writeRect(x + col * size, y + row * size, size, size, on ? color : bg);
+    }
+  }
+  if (bg != color) // Spacing column.
+    writeRect(x + GLYPH_COLUMNS * size, y, size, CHAR_HEIGHT * size, bg);
+}
+
+void display_init() {
+  display_host_resetStats();
+  cursor_x = cursor_y = 0;
+  text_color = DISPLAY_WHITE;
+  text_size = 1;
+  text_wrap = true;
+}
+
+void display_fillScreen(uint16_t color) {
+  stats.ops++;
+  if (raster)
+    writeRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, color);
+}
+
+void display_drawPixel(int16_t x, int16_t y, uint16_t color) {
+  stats.ops++;
+  if (raster)
+    writePixel(x, y, color);
+}
+
+void display_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                      uint16_t color) {
+  stats.ops++;
+  if (raster)
+    writeLine(x0, y0, x1, y1, color);
+}
+
+void display_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint16_t color) {
+  stats.ops++;
+  if (raster)
+    writeRect(x, y, w, h, color);
+}
+
+void display_fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  stats.ops++;
+  if (!raster)
+    return;
+  writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void display_fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                          int16_t x2, int16_t y2, uint16_t color) {
+  stats.ops++;
+  if (!raster)
+    return;
+  int16_t a, b, y, last, t;
+  // Sort coordinates by y order (y2 >= y1 >= y0).
+  if (y0 > y1) {
+    t = y0, y0 = y1, y1 = t;
+    t = x0, x0 = x1, x1 = t;
+  }
+  if (y1 > y2) {
+    t = y2, y2 = y1, y1 = t;
+    t = x2, x2 = x1, x1 = t;
+  }
+  if (y0 > y1) {
+    t = y0, y0 = y1, y1 = t;
+    t = x0, x0 = x1, x1 = t;
+  }
+  if (y0 == y2) { // All on the same line.
+    a = b = x0;
+    if (x1 < a)
+      a = x1;
+    else if (x1 > b)
+      b = x1;
+    if (x2 < a)
+      a = x2;
+    else if (x2 > b)
+      b = x2;
+    writeFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+  int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
+          dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+  // Upper part, include scanline y1 only if it is flat-bottomed.
+  last = (y1 == y2) ? y1 : y1 - 1;
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b)
+      t = a, a = b, b = t;
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+  // Lower part.
+  sa = dx12 * (y - y1);
+  sb = dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b)
+      t = a, a = b, b = t;
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+void display_drawChar(int16_t x, int16_t y, char c, uint16_t color,
+                      uint16_t bg, uint8_t size) {
+  stats.ops++;
+  if (raster)
+    writeChar(x, y, c, color, bg, size);
+}
+
+void display_setCursor(int16_t x, int16_t y) {
+  cursor_x = x;
+  cursor_y = y;
+}
+
+void display_setTextColor(uint16_t color) { text_color = color; }
+
+void display_setTextSize(uint8_t size) { text_size = size > 0 ? size : 1; }
+
+void display_setTextWrap(bool wrap) { text_wrap = wrap; }
+
+void display_print(const char *str) {
+  stats.ops++;
+  for (; *str; str++) {
+    if (*str == '\n') {
+      cursor_x = 0;
+      cursor_y += CHAR_HEIGHT * text_size;
+      continue;
+    }
+    if (*str == '\r')
+      continue;
+    if (text_wrap && cursor_x + CHAR_WIDTH * text_size > DISPLAY_WIDTH) {
+      cursor_x = 0;
+      cursor_y += CHAR_HEIGHT * text_size;
+    }
+    if (raster)
+      writeChar(cursor_x, cursor_y, *str, text_color, text_color, text_size);
+    cursor_x += CHAR_WIDTH * text_size;
+  }
+}
+
+void display_printlnDecimalInt(int32_t value) {
+  char str[16];
+  char *p = str + sizeof(str);
+  *--p = '\0';
+  *--p = '\n';
+  uint32_t magnitude = value < 0 ? -(uint32_t)value : (uint32_t)value;
+  do {
+    *--p = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude);
+  if (value < 0)
+    *--p = '-';
+  display_print(p);
+}
+
+const uint16_t *display_host_getFramebuffer() { return framebuffer; }
+
+bool display_host_writePpm(const char *fileName) {
+  FILE *fp = fopen(fileName, "wb");
+  if (!fp) {
+    fprintf(stderr, "Unable to open file: %s for writing.\n", fileName);
+    return false;
+  }
+  fprintf(fp, "P6\n%d %d\n%d\n", DISPLAY_WIDTH, DISPLAY_HEIGHT, PPM_MAX_VALUE);
+  for (size_t i = 0; i < DISPLAY_WIDTH * DISPLAY_HEIGHT; i++) {
+    uint16_t color = framebuffer[i];
+    // Widen the 5, 6 and 5 bit channels to 8 bits.
+    uint8_t rgb[3] = {(color >> 11) * PPM_MAX_VALUE / 0x1F,
+                      ((color >> 5) & 0x3F) * PPM_MAX_VALUE / 0x3F,
+                      (color & 0x1F) * PPM_MAX_VALUE / 0x1F};
+    fwrite(rgb, sizeof(rgb), 1, fp);
+  }
+  return fclose(fp) == 0;
+}
+
+uint64_t display_host_hashFramebuffer() {
+  uint64_t hash = FNV_OFFSET_BASIS;
+  const uint8_t *bytes = (const uint8_t *)framebuffer;
+  for (size_t i = 0; i < sizeof(framebuffer); i++) {
+    hash ^= bytes[i];
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+display_host_stats_t display_host_getStats() { return stats; }
+
+void display_host_resetStats() {
+  stats.ops = 0;
+  stats.pixels = 0;
+}
+
+void display_host_setRaster(bool enable) { raster = enable; }
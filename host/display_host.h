@@ -0,0 +1,35 @@
+#ifndef DISPLAY_HOST_H_
+#define DISPLAY_HOST_H_
+
+// Extra hooks of the host display stand-in, used by the host tools.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Drawing cost since the last display_host_resetStats().
+typedef struct {
+  uint64_t ops;    // Number of display_* drawing calls.
+  uint64_t pixels; // Number of on-screen pixels written.
+} display_host_stats_t;
+
+// Return the DISPLAY_WIDTH x DISPLAY_HEIGHT RGB565 framebuffer, row major.
+const uint16_t *display_host_getFramebuffer();
+
+// Write the framebuffer to a binary (P6) PPM file.  Returns false if the
+// file cannot be written.
+bool display_host_writePpm(const char *fileName);
+
+// Return a 64-bit FNV-1a hash of the framebuffer.
+uint64_t display_host_hashFramebuffer();
+
+// Return the drawing cost counters.
+display_host_stats_t display_host_getStats();
+
+// Clear the drawing cost counters.
+void display_host_resetStats();
+
+// Turn rasterizing on or off.  Operations are still counted while it is off
+// but pixels are not, which keeps headless simulation fast.  On by default.
+void display_host_setRaster(bool enable);
+
+#endif /* DISPLAY_HOST_H_ */
@@ -0,0 +1,242 @@
+// Golden-frame regression harness.
+//
+// Plays seeded autopilot games into the host framebuffer.  At each checkpoint
+// tick it hashes the framebuffer and records how many display operations and
+// pixels were drawn since the previous checkpoint, plus the most operations
+// drawn in any single tick.  The results are compared with golden_frames.txt:
+// a different hash means the output changed, a higher count means drawing got
+// more expensive.  Either one fails the run.  Lower counts with the same hash
+// pass and are reported so the goldens can be refreshed with -u.
+//
+// Usage: golden [-u] [-f goldens] [-c per_tick.csv]
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "autopilot.h"
+#include "config.h"
+#include "difficulty.h"
+#include "display.h"
+#include "display_host.h"
+#include "gameControl.h"
+
+#ifndef GOLDEN_FILE
+#define GOLDEN_FILE "golden_frames.txt"
+#endif
+
+#define MAX_CHECKPOINTS 64
+
+// Games that are played, and the ticks at which each one is checked.  These
+// seeds all run for more than 650 ticks with the default difficulty.
+static const uint32_t seeds[] = {6, 10, 16, 34};
+static const uint32_t checkpoints[] = {1, 2, 25, 100, 250, 500, 650};
+
+#define SEED_COUNT (sizeof(seeds) / sizeof(seeds[0]))
+#define CHECKPOINT_COUNT (sizeof(checkpoints) / sizeof(checkpoints[0]))
+
+typedef struct {
+  uint32_t seed;
+  uint32_t tick;
+  uint64_t hash;
+  uint64_t ops;          // Operations drawn since the previous checkpoint.
+  uint64_t pixels;       // Pixels drawn since the previous checkpoint.
+  uint64_t max_tick_ops; // Most operations drawn in one tick in that window.
+} golden_t;
+
+// Play one game and fill in a record per checkpoint.  Returns the number of
+// records; a game that ends early stops producing checkpoints.
+static uint32_t playGame(uint32_t seed, golden_t *results, FILE *csv) {
+  autopilot_config_t pilot = {
+      .reaction_us = CONFIG_AUTOPILOT_REACTION_US,
+      .shot_interval_us = CONFIG_AUTOPILOT_SHOT_INTERVAL_US,
+      .aim_error = CONFIG_AUTOPILOT_AIM_ERROR,
+      .target_ufo = false, // Keep the game, and the drawing, going.
+      .seed = seed,
+  };
+  srand(seed);
+  difficulty_reset();
+  display_init();
+  gameControl_init();
+  autopilot_init(&pilot);
+  autopilot_enable(true);
+
+  uint32_t count = 0;
+  display_host_stats_t window = display_host_getStats();
+  uint64_t maxTickOps = 0;
+  uint32_t lastTick = checkpoints[CHECKPOINT_COUNT - 1];
+  for (uint32_t tick = 1; tick <= lastTick && !getGameStatus(); tick++) {
+    display_host_stats_t before = display_host_getStats();
+    gameControl_tick(CONFIG_GAME_TIMER_PERIOD_US);
+    display_host_stats_t after = display_host_getStats();
+    uint64_t tickOps = after.ops - before.ops;
+    if (tickOps > maxTickOps)
+      maxTickOps = tickOps;
+    if (csv)
+      fprintf(csv, "%u,%u,%" PRIu64 ",%" PRIu64 "\n", seed, tick, tickOps,
+              after.pixels - before.pixels);
+    if (count < CHECKPOINT_COUNT && tick == checkpoints[count]) {
+      golden_t *result = &results[count++];
+      result->seed = seed;
+      result->tick = tick;
+      result->hash = display_host_hashFramebuffer();
+      result->ops = after.ops - window.ops;
+      result->pixels = after.pixels - window.pixels;
+      result->max_tick_ops = maxTickOps;
+      window = after;
+      maxTickOps = 0;
+    }
+  }
+  return count;
+}
+
+// Read every record from the golden file, return how many were read.
+static uint32_t readGoldens(const char *fileName, golden_t *goldens,
+                            uint32_t max) {
+  FILE *fp = fopen(fileName, "r");
+  if (!fp)
+    return 0;
+  char line[256];
+  uint32_t count = 0;
+  while (count < max && fgets(line, sizeof(line), fp)) {
+    golden_t *g = &goldens[count];
+    if (line[0] == '#')
+      continue;
+    if (sscanf(line, "%u %u %" SCNx64 " %" SCNu64 " %" SCNu64 " %" SCNu64,
+               &g->seed, &g->tick, &g->hash, &g->ops, &g->pixels,
+               &g->max_tick_ops) == 6)
+      count++;
+  }
+  fclose(fp);
+  return count;
+}
+
+static bool writeGoldens(const char *fileName, const golden_t *results,
+                         uint32_t count) {
+  FILE *fp = fopen(fileName, "w");
+  if (!fp) {
+    fprintf(stderr, "Unable to open file: %s for writing.\n", fileName);
+    return false;
+  }
+  fprintf(fp, "# Generated by golden -u. Columns: seed tick framebuffer_hash "
+              "ops pixels max_tick_ops\n");
+  for (uint32_t i = 0; i < count; i++)
+    fprintf(fp, "%u %u %016" PRIx64 " %" PRIu64 " %" PRIu64 " %" PRIu64 "\n",
+            results[i].seed, results[i].tick, results[i].hash, results[i].ops,
+            results[i].pixels, results[i].max_tick_ops);
+  fclose(fp);
+  return true;
+}
+
+// Look up the golden for seed/tick, NULL if there is none.
+static const golden_t *findGolden(const golden_t *goldens, uint32_t count,
+                                  uint32_t seed, uint32_t tick) {
+  for (uint32_t i = 0; i < count; i++)
+    if (goldens[i].seed == seed && goldens[i].tick == tick)
+      return &goldens[i];
+  return NULL;
+}
+
+// Compare one cost counter, returns false on a regression.
+static bool checkCost(const golden_t *r, const char *name, uint64_t actual,
+                      uint64_t golden, bool *improved) {
+  if (actual > golden) {
+    fprintf(stderr, "FAIL seed %u tick %u: %s went up from %" PRIu64
+                    " to %" PRIu64 "\n",
+            r->seed, r->tick, name, golden, actual);
+    return false;
+  }
+  if (actual < golden) {
+    fprintf(stderr, "note seed %u tick %u: %s went down from %" PRIu64
+                    " to %" PRIu64 "\n",
+            r->seed, r->tick, name, golden, actual);
+    *improved = true;
+  }
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  const char *goldenFile = GOLDEN_FILE;
+  const char *csvFile = NULL;
+  bool update = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "uf:c:")) != -1) {
+    switch (opt) {
+    case 'u':
+      update = true;
+      break;
+    case 'f':
+      goldenFile = optarg;
+      break;
+    case 'c':
+      csvFile = optarg;
+      break;
+    default:
+      fprintf(stderr, "Usage: golden [-u] [-f goldens] [-c per_tick.csv]\n");
+      return -1;
+    }
+  }
+  FILE *csv = NULL;
+  if (csvFile) {
+    csv = fopen(csvFile, "w");
+    if (!csv) {
+      fprintf(stderr, "Unable to open file: %s for writing.\n", csvFile);
+      return -1;
+    }
+    fprintf(csv, "seed,tick,ops,pixels\n");
+  }
+
+  golden_t results[MAX_CHECKPOINTS];
+  uint32_t resultCount = 0;
+  for (uint32_t s = 0; s < SEED_COUNT; s++)
+    resultCount += playGame(seeds[s], &results[resultCount], csv);
+  if (csv)
+    fclose(csv);
+
+  if (update) {
+    if (!writeGoldens(goldenFile, results, resultCount))
+      return -1;
+    fprintf(stderr, "wrote %u goldens to %s\n", resultCount, goldenFile);
+    return 0;
+  }
+
+  golden_t goldens[MAX_CHECKPOINTS];
+  uint32_t goldenCount = readGoldens(goldenFile, goldens, MAX_CHECKPOINTS);
+  if (goldenCount == 0) {
+    fprintf(stderr, "ERROR: no goldens in %s, run golden -u first.\n",
+            goldenFile);
+    return -1;
+  }
+  bool pass = (goldenCount == resultCount);
+  bool improved = false;
+  if (!pass)
+    fprintf(stderr, "FAIL: %u checkpoints reached, %u expected\n", resultCount,
+            goldenCount);
+  for (uint32_t i = 0; i < resultCount; i++) {
+    const golden_t *r = &results[i];
+    const golden_t *g = findGolden(goldens, goldenCount, r->seed, r->tick);
+    if (!g) {
+      fprintf(stderr, "FAIL seed %u tick %u: no golden\n", r->seed, r->tick);
+      pass = false;
+      continue;
+    }
+    if (r->hash != g->hash) {
+      fprintf(stderr, "FAIL seed %u tick %u: framebuffer hash %016" PRIx64
+                      " expected %016" PRIx64 "\n",
+              r->seed, r->tick, r->hash, g->hash);
+      pass = false;
+    }
+    pass &= checkCost(r, "ops", r->ops, g->ops, &improved);
+    pass &= checkCost(r, "pixels", r->pixels, g->pixels, &improved);
+    pass &= checkCost(r, "max ops per tick", r->max_tick_ops, g->max_tick_ops,
+                      &improved);
+  }
+  if (pass && improved)
+    fprintf(stderr, "drawing got cheaper, refresh the goldens with golden -u\n");
+  fprintf(stderr, "%s: %u checkpoints\n", pass ? "PASS" : "FAIL", resultCount);
+  return pass ? 0 : 1;
+}
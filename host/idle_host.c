@@ -0,0 +1,38 @@
+#include <pthread.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "idle.h"
+#include "idle_host.h"
+
+#define IDLE_HOST_NANOSECONDS_PER_MICROSECOND 1000
+#define IDLE_HOST_MICROSECONDS_PER_SECOND 1000000
+
+static pthread_mutex_t idle_host_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t idle_host_interrupted = PTHREAD_COND_INITIALIZER;
+static bool idle_host_pending = false; // An interrupt nobody has woken for.
+
+uint64_t idle_hal_nowUs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * IDLE_HOST_MICROSECONDS_PER_SECOND +
+         now.tv_nsec / IDLE_HOST_NANOSECONDS_PER_MICROSECOND;
+}
+
+// Like WFI, an interrupt taken between the caller's last look at *wake and
+// the wait is not lost: it leaves idle_host_pending set.
+void idle_hal_waitForInterrupt(volatile bool *wake) {
+  pthread_mutex_lock(&idle_host_mutex);
+  while (!idle_host_pending && !*wake)
+    pthread_cond_wait(&idle_host_interrupted, &idle_host_mutex);
+  idle_host_pending = false;
+  pthread_mutex_unlock(&idle_host_mutex);
+}
+
+// Wakes the thread sleeping in idle_sleep(), or the next one to sleep.
+void idle_host_interrupt() {
+  pthread_mutex_lock(&idle_host_mutex);
+  idle_host_pending = true;
+  pthread_cond_signal(&idle_host_interrupted);
+  pthread_mutex_unlock(&idle_host_mutex);
+}
@@ -0,0 +1,10 @@
+#ifndef IDLE_HOST_H_
+#define IDLE_HOST_H_
+
+// Hooks into the host side of idle.h. Whatever emulates an interrupt calls
+// idle_host_interrupt() after running the handler, which wakes idle_sleep().
+
+// Wakes the thread sleeping in idle_sleep(), or the next one to sleep.
+void idle_host_interrupt();
+
+#endif /* IDLE_HOST_H_ */
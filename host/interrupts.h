@@ -0,0 +1,20 @@
+#ifndef INTERRUPTS_H_
+#define INTERRUPTS_H_
+
+// Host stand-in for the ECEn 330 interrupt driver, implemented by
+// interrupts_host.c for the native game.  The simulation tools drive ticks
+// directly.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define INTERVAL_TIMER_0_INTERRUPT_IRQ 0
+#define INTERVAL_TIMER_1_INTERRUPT_IRQ 1
+#define INTERVAL_TIMER_2_INTERRUPT_IRQ 2
+
+void interrupts_init();
+void interrupts_register(uint8_t irq, void (*fcn)());
+void interrupts_irq_enable(uint8_t irq);
+void interrupts_irq_disable(uint8_t irq);
+
+#endif /* INTERRUPTS_H_ */
@@ -0,0 +1,148 @@
+// Host stand-in for the ECEn 330 interrupt and interval timer drivers.
+//
+// Each interval timer is a timerfd and raises the interrupt with the same
+// number.  A thread plays the interrupt controller: it waits for the timers,
+// runs the registered handlers one at a time, as the single-core board would,
+// and wakes idle_sleep() with idle_host_interrupt().  The handlers run
+// alongside the main thread rather than stopping it, so thread sanitizer
+// reports the sharing the board gets away with by having one core.
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "idle_host.h"
+#include "interrupts.h"
+#include "intervalTimer.h"
+
+#define TIMER_COUNT 3
+#define NANOSECONDS_PER_SECOND 1000000000L
+
+typedef struct {
+  int fd;
+  struct timespec period;
+  volatile bool interruptEnabled; // intervalTimer_enableInterrupt().
+} emulatedTimer_t;
+
+static emulatedTimer_t timers[TIMER_COUNT] = {{-1}, {-1}, {-1}};
+
+static void (*handlers[TIMER_COUNT])();
+static volatile bool irqEnabled[TIMER_COUNT];
+static bool started = false;
+
+// The timer's timerfd, created on first use.
+static int timerFd(uint32_t timerNumber) {
+  emulatedTimer_t *timer = &timers[timerNumber];
+  if (timer->fd < 0) {
+    timer->fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+    if (timer->fd < 0) {
+      perror("timerfd_create");
+      exit(EXIT_FAILURE);
+    }
+  }
+  return timer->fd;
+}
+
+static void arm(uint32_t timerNumber, const struct timespec *period) {
+  struct itimerspec spec = {.it_interval = *period, .it_value = *period};
+  timerfd_settime(timerFd(timerNumber), 0, &spec, NULL);
+}
+
+// Waits for the timers and runs the handlers of the ones that expired.
+// Expirations that pile up while a handler runs are taken as one interrupt,
+// like a level-triggered interrupt that was not acknowledged in time.
+static void *interruptThread(void *unused) {
+  struct pollfd fds[TIMER_COUNT];
+  for (uint32_t i = 0; i < TIMER_COUNT; i++)
+    fds[i] = (struct pollfd){.fd = timerFd(i), .events = POLLIN};
+  while (true) {
+    if (poll(fds, TIMER_COUNT, -1) < 0) {
+      if (errno == EINTR)
+        continue;
+      perror("poll");
+      exit(EXIT_FAILURE);
+    }
+    for (uint32_t i = 0; i < TIMER_COUNT; i++) {
+      uint64_t expirations;
+      if (!(fds[i].revents & POLLIN) ||
+          read(fds[i].fd, &expirations, sizeof(expirations)) !=
+              sizeof(expirations))
+        continue;
+      if (timers[i].interruptEnabled && irqEnabled[i] && handlers[i]) {
+        handlers[i]();
+        idle_host_interrupt();
+      }
+    }
+  }
+  return NULL;
+}
+
+////////// interrupts.h //////////
+
+void interrupts_init() {
+  if (started)
+    return;
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, interruptThread, NULL) != 0) {
+    fprintf(stderr, "Unable to start the interrupt thread.\n");
+    exit(EXIT_FAILURE);
+  }
+  pthread_detach(thread);
+  started = true;
+}
+
+void interrupts_register(uint8_t irq, void (*fcn)()) {
+  if (irq < TIMER_COUNT)
+    handlers[irq] = fcn;
+}
+
+void interrupts_irq_enable(uint8_t irq) {
+  if (irq < TIMER_COUNT)
+    irqEnabled[irq] = true;
+}
+
+void interrupts_irq_disable(uint8_t irq) {
+  if (irq < TIMER_COUNT)
+    irqEnabled[irq] = false;
+}
+
+////////// intervalTimer.h //////////
+
+void intervalTimer_initCountDown(uint32_t timerNumber, double period) {
+  if (timerNumber >= TIMER_COUNT)
+    return;
+  intervalTimer_stop(timerNumber);
+  long nanoseconds = period * NANOSECONDS_PER_SECOND;
+  timers[timerNumber].period =
+      (struct timespec){.tv_sec = nanoseconds / NANOSECONDS_PER_SECOND,
+                        .tv_nsec = nanoseconds % NANOSECONDS_PER_SECOND};
+}
+
+void intervalTimer_start(uint32_t timerNumber) {
+  if (timerNumber < TIMER_COUNT)
+    arm(timerNumber, &timers[timerNumber].period);
+}
+
+void intervalTimer_stop(uint32_t timerNumber) {
+  static const struct timespec stopped = {0, 0};
+  if (timerNumber < TIMER_COUNT)
+    arm(timerNumber, &stopped);
+}
+
+void intervalTimer_enableInterrupt(uint8_t timerNumber) {
+  if (timerNumber < TIMER_COUNT)
+    timers[timerNumber].interruptEnabled = true;
+}
+
+void intervalTimer_disableInterrupt(uint8_t timerNumber) {
+  if (timerNumber < TIMER_COUNT)
+    timers[timerNumber].interruptEnabled = false;
+}
+
+// The interrupt thread already consumed the expiration.
+void intervalTimer_ackInterrupt(uint8_t timerNumber) {}
@@ -0,0 +1,22 @@
+#ifndef INTERVALTIMER_H_
+#define INTERVALTIMER_H_
+
+// Host stand-in for the ECEn 330 interval timer driver, implemented with
+// timerfd by interrupts_host.c for the native game.  The simulation tools
+// drive ticks directly.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define INTERVAL_TIMER_0 0
+#define INTERVAL_TIMER_1 1
+#define INTERVAL_TIMER_2 2
+
+void intervalTimer_initCountDown(uint32_t timerNumber, double period);
+void intervalTimer_start(uint32_t timerNumber);
+void intervalTimer_stop(uint32_t timerNumber);
+void intervalTimer_enableInterrupt(uint8_t timerNumber);
+void intervalTimer_disableInterrupt(uint8_t timerNumber);
+void intervalTimer_ackInterrupt(uint8_t timerNumber);
+
+#endif /* INTERVALTIMER_H_ */
@@ -0,0 +1,62 @@
+// The whole game, main_m3.c included, running natively on Linux.
+//
+// main_m3.c is built with its main() renamed to lab9_main() and runs
+// unchanged on the host stand-ins: the game and touchscreen timers and the
+// audio interrupt are timerfds (interrupts_host.c), the display draws into
+// memory, the CODEC plays in wall-clock time, and UART commands are read from
+// stdin.  Build with -DSANITIZE=address,undefined for sanitizers, or profile
+// it with perf.
+//
+// Usage: lab9 [-t touches.txt] [-p last_frame.ppm] [-w audio.wav]
+//             [-T telemetry.bin]
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "audio_hal_host.h"
+#include "display_host.h"
+#include "telemetry_host.h"
+#include "touchscreen_host.h"
+
+int lab9_main();
+
+int main(int argc, char *argv[]) {
+  const char *ppmFile = NULL;
+  int opt;
+  while ((opt = getopt(argc, argv, "t:p:w:T:")) != -1) {
+    switch (opt) {
+    case 't':
+      if (!touchscreen_host_loadScript(optarg))
+        return -1;
+      break;
+    case 'p':
+      ppmFile = optarg;
+      break;
+    case 'w':
+      if (!audio_hal_host_captureWav(optarg))
+        return -1;
+      break;
+    case 'T':
+      if (!telemetry_host_capture(optarg))
+        return -1;
+      break;
+    default:
+      fprintf(stderr, "Usage: lab9 [-t touches.txt] [-p last_frame.ppm] "
+                      "[-w audio.wav] [-T telemetry.bin]\n");
+      return -1;
+    }
+  }
+  audio_hal_host_setRealTime(true);
+
+  lab9_main();
+
+  audio_hal_host_closeCapture();
+  telemetry_host_closeCapture();
+  audio_hal_host_stats_t audio = audio_hal_host_getStats();
+  printf("audio: %llu samples played, %llu underruns\n",
+         (unsigned long long)audio.played, (unsigned long long)audio.underruns);
+  if (ppmFile && !display_host_writePpm(ppmFile))
+    return -1;
+  return 0;
+}
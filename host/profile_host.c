@@ -0,0 +1,18 @@
+#include <time.h>
+
+#include "profile.h"
+
+#define PROFILE_HOST_NANOSECONDS_PER_SECOND 1000000000
+
+// CLOCK_MONOTONIC in nanoseconds, the low 32 bits.
+uint32_t profile_hal_now() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)now.tv_sec * PROFILE_HOST_NANOSECONDS_PER_SECOND +
+         now.tv_nsec;
+}
+
+// How fast the counter counts.
+uint32_t profile_hal_countsPerSecond() {
+  return PROFILE_HOST_NANOSECONDS_PER_SECOND;
+}
@@ -0,0 +1,33 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "sound_assets_host.h"
+#include "sounds/sound_assets.h"
+
+// Map a sound blob written by wav2c -b into memory and play it in place of the
+// linked-in one.  Returns false, and keeps the linked-in sounds, on error.
+bool sound_assets_host_mapFile(const char *fileName) {
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0) {
+    fprintf(stderr, "Unable to open file: %s\n", fileName);
+    return false;
+  }
+  struct stat st;
+  void *blob = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+    blob = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // The mapping outlives the descriptor.
+  if (blob == MAP_FAILED) {
+    fprintf(stderr, "Unable to map file: %s\n", fileName);
+    return false;
+  }
+  if (!sound_assets_use(blob, st.st_size)) {
+    fprintf(stderr, "ERROR: %s is not a sound blob.\n", fileName);
+    munmap(blob, st.st_size);
+    return false;
+  }
+  return true;
+}
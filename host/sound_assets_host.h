@@ -0,0 +1,12 @@
+#ifndef SOUND_ASSETS_HOST_H_
+#define SOUND_ASSETS_HOST_H_
+
+// Host-only hook of the sound blob, used by the host tools.
+
+#include <stdbool.h>
+
+// Map a sound blob written by wav2c -b into memory and play it in place of the
+// linked-in one.  Returns false, and keeps the linked-in sounds, on error.
+bool sound_assets_host_mapFile(const char *fileName);
+
+#endif /* SOUND_ASSETS_HOST_H_ */
@@ -0,0 +1,30 @@
+// Silent stand-in for sound.c so the game can be simulated without the audio
+// CODEC.
+
+#include "sound.h"
+
+sound_status_t sound_init() { return SOUND_STATUS_OK; }
+void sound_tick() {}
+void sound_isr() {}
+void sound_setInterruptDriven(bool enable) {}
+void sound_playSound(sound_sounds_t sound) {}
+bool sound_isBusy() { return false; }
+bool sound_isSoundComplete() { return true; }
+uint32_t sound_getQueuedSamples() { return 0; }
+void sound_setSound(sound_sounds_t sound) {}
+void sound_setVolume(sound_volume_t volume) {}
+void sound_setResampleQuality(sound_resample_t quality) {}
+void sound_startSound() {}
+void sound_stopSound() {}
+int8_t sound_playVoice(sound_sounds_t sound, uint16_t gain, bool loop) {
+  return SOUND_NO_VOICE;
+}
+void sound_stopVoice(int8_t voice) {}
+bool sound_isVoiceBusy(int8_t voice) { return false; }
+void sound_runTest() {}
+void sound_initialize() {}
+void sound_introSong() {}
+void sound_ufo() {}
+void sound_gameOver() {}
+void sound_powerup() {}
+void sound_missionFailed() {}
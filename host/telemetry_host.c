@@ -0,0 +1,29 @@
+#include <stdio.h>
+
+#include "telemetry.h"
+#include "telemetry_host.h"
+
+static FILE *captureFile;
+
+// Write the telemetry frames to fileName.
+bool telemetry_host_capture(const char *fileName) {
+  captureFile = fopen(fileName, "wb");
+  if (!captureFile) {
+    fprintf(stderr, "Unable to create file: %s\n", fileName);
+    return false;
+  }
+  return true;
+}
+
+// Flush and close the capture file.
+void telemetry_host_closeCapture() {
+  if (captureFile)
+    fclose(captureFile);
+  captureFile = NULL;
+}
+
+// Appends the frame to the capture file, if there is one.
+void telemetry_hal_write(const uint8_t *bytes, uint32_t length) {
+  if (captureFile)
+    fwrite(bytes, 1, length, captureFile);
+}
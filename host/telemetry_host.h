@@ -0,0 +1,17 @@
+#ifndef TELEMETRY_HOST_H_
+#define TELEMETRY_HOST_H_
+
+// Extra hooks of the host telemetry backend.  Without a capture file the
+// frames are dropped, so they don't get mixed into the console text on
+// stdout.
+
+#include <stdbool.h>
+
+// Write the telemetry frames to fileName.  Returns false if it cannot be
+// created.
+bool telemetry_host_capture(const char *fileName);
+
+// Flush and close the capture file.
+void telemetry_host_closeCapture();
+
+#endif /* TELEMETRY_HOST_H_ */
@@ -0,0 +1,118 @@
+// Decodes the telemetry frames sent by telemetry.h into CSV.
+//
+// Reads a capture, from a file or stdin: the raw bytes of the board's UART,
+// console text included, or a lab9 -T file.  Prints a header of the field
+// names and one row per frame.  Chunks that are not frames, or were
+// damaged, are skipped and counted on stderr.
+//
+// Usage: telemetrydecode [capture.bin]
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "telemetry.h"
+
+#define VARINT_MORE 0x80
+#define VARINT_BITS 7
+
+#define FIELD_NAME(name, comment) #name,
+static const char *const fieldNames[telemetry_fieldCount_e] = {
+    TELEMETRY_FIELDS(FIELD_NAME)};
+#undef FIELD_NAME
+
+// Undo the COBS encoding of length bytes in place.  Returns the decoded
+// length, or -1 if the chunk is not valid COBS.
+static int32_t cobsDecode(uint8_t *chunk, uint32_t length) {
+  uint32_t read = 0, written = 0;
+  while (read < length) {
+    uint8_t code = chunk[read++];
+    if (code == 0 || read + code - 1 > length)
+      return -1;
+    for (uint8_t i = 1; i < code; i++)
+      chunk[written++] = chunk[read++];
+    // A run shorter than the longest one stood in for a zero, unless it was
+    // the last.
+    if (code != 0xFF && read < length)
+      chunk[written++] = 0;
+  }
+  return written;
+}
+
+// Read a varint at *position.  Returns false if it runs past the end.
+static bool readVarint(const uint8_t *payload, uint32_t length,
+                       uint32_t *position, uint32_t *value) {
+  *value = 0;
+  for (uint32_t shift = 0; *position < length && shift < 32;
+       shift += VARINT_BITS) {
+    uint8_t byte = payload[(*position)++];
+    *value |= (uint32_t)(byte & (VARINT_MORE - 1)) << shift;
+    if (!(byte & VARINT_MORE))
+      return true;
+  }
+  return false;
+}
+
+// Print the chunk as a CSV row if it is a valid frame.
+static bool decodeChunk(uint8_t *chunk, uint32_t length) {
+  int32_t decoded = cobsDecode(chunk, length);
+  if (decoded < 2 || chunk[0] != TELEMETRY_VERSION ||
+      telemetry_crc8(chunk, decoded - 1) != chunk[decoded - 1])
+    return false;
+  uint32_t fields[telemetry_fieldCount_e];
+  uint32_t position = 1;
+  for (uint32_t i = 0; i < telemetry_fieldCount_e; i++)
+    if (!readVarint(chunk, decoded - 1, &position, &fields[i]))
+      return false;
+  if (position != (uint32_t)decoded - 1)
+    return false;
+  for (uint32_t i = 0; i < telemetry_fieldCount_e; i++)
+    printf("%s%u", i ? "," : "", fields[i]);
+  printf("\n");
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  FILE *fp = stdin;
+  if (argc > 2) {
+    fprintf(stderr, "Usage: telemetrydecode [capture.bin]\n");
+    return -1;
+  }
+  if (argc == 2 && !(fp = fopen(argv[1], "rb"))) {
+    fprintf(stderr, "Unable to open file: %s\n", argv[1]);
+    return -1;
+  }
+  for (uint32_t i = 0; i < telemetry_fieldCount_e; i++)
+    printf("%s%s", i ? "," : "", fieldNames[i]);
+  printf("\n");
+
+  // Frames are at most TELEMETRY_FRAME_MAX bytes; longer chunks are text.
+  uint8_t chunk[TELEMETRY_FRAME_MAX];
+  uint32_t length = 0;
+  bool tooLong = false;
+  unsigned long frames = 0, skipped = 0;
+  int c;
+  while ((c = getc(fp)) != EOF) {
+    if (c != 0) {
+      if (length < sizeof(chunk))
+        chunk[length++] = c;
+      else
+        tooLong = true;
+      continue;
+    }
+    if (length || tooLong) {
+      if (!tooLong && decodeChunk(chunk, length))
+        frames++;
+      else
+        skipped++;
+    }
+    length = 0;
+    tooLong = false;
+  }
+  if (length || tooLong)
+    skipped++; // Cut off at the end of the capture.
+  if (fp != stdin)
+    fclose(fp);
+  fprintf(stderr, "%lu frames, %lu other chunks skipped\n", frames, skipped);
+  return 0;
+}
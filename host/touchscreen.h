@@ -0,0 +1,20 @@
+#ifndef TOUCHSCREEN_H_
+#define TOUCHSCREEN_H_
+
+// Host stand-in for the ECEn 330 touchscreen driver.
+
+#include "display.h"
+
+typedef enum {
+  TOUCHSCREEN_IDLE,
+  TOUCHSCREEN_PRESSED,
+  TOUCHSCREEN_RELEASED
+} touchscreen_status_t;
+
+void touchscreen_init(double period_seconds);
+void touchscreen_tick();
+touchscreen_status_t touchscreen_get_status();
+display_point_t touchscreen_get_location();
+void touchscreen_ack_touch();
+
+#endif /* TOUCHSCREEN_H_ */
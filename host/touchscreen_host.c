@@ -0,0 +1,74 @@
+// Host stand-in for the ECEn 330 touchscreen driver.  Nobody touches the
+// screen unless a touch script is loaded; otherwise use the autopilot to play.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "touchscreen.h"
+#include "touchscreen_host.h"
+
+#define MAX_TAPS 1024
+#define MICROSECONDS_PER_SECOND 1000000
+#define MICROSECONDS_PER_MILLISECOND 1000
+
+typedef struct {
+  uint64_t at_us;
+  display_point_t location;
+} tap_t;
+
+static tap_t taps[MAX_TAPS];
+static uint32_t tapCount = 0;
+static uint32_t nextTap = 0;
+
+static uint32_t period_us = 0;
+static uint64_t now_us = 0; // Time counted by touchscreen_tick().
+static touchscreen_status_t status = TOUCHSCREEN_IDLE;
+static display_point_t location = {0, 0};
+
+void touchscreen_init(double period_seconds) {
+  period_us = period_seconds * MICROSECONDS_PER_SECOND;
+  status = TOUCHSCREEN_IDLE;
+}
+
+void touchscreen_tick() {
+  now_us += period_us;
+  if (status == TOUCHSCREEN_PRESSED) {
+    status = TOUCHSCREEN_RELEASED;
+  } else if (status == TOUCHSCREEN_IDLE && nextTap < tapCount &&
+             taps[nextTap].at_us <= now_us) {
+    location = taps[nextTap++].location;
+    status = TOUCHSCREEN_PRESSED;
+  }
+}
+
+touchscreen_status_t touchscreen_get_status() { return status; }
+
+display_point_t touchscreen_get_location() { return location; }
+
+void touchscreen_ack_touch() {
+  if (status == TOUCHSCREEN_RELEASED)
+    status = TOUCHSCREEN_IDLE;
+}
+
+bool touchscreen_host_loadScript(const char *fileName) {
+  FILE *fp = fopen(fileName, "r");
+  if (!fp) {
+    fprintf(stderr, "Unable to open file: %s\n", fileName);
+    return false;
+  }
+  char line[128];
+  tapCount = 0;
+  while (tapCount < MAX_TAPS && fgets(line, sizeof(line), fp)) {
+    unsigned ms;
+    int x, y;
+    if (line[0] == '#' || sscanf(line, "%u %d %d", &ms, &x, &y) != 3)
+      continue;
+    taps[tapCount].at_us = (uint64_t)ms * MICROSECONDS_PER_MILLISECOND;
+    taps[tapCount].location = (display_point_t){x, y};
+    tapCount++;
+  }
+  fclose(fp);
+  nextTap = 0;
+  now_us = 0;
+  return true;
+}
@@ -0,0 +1,17 @@
+#ifndef TOUCHSCREEN_HOST_H_
+#define TOUCHSCREEN_HOST_H_
+
+// Extra hooks of the host touchscreen stand-in.  Without a script nobody
+// touches the screen.
+
+#include <stdbool.h>
+
+// Load a touch script.  Each line is "milliseconds x y", in time order: a
+// tap at x,y that many milliseconds after the script was loaded, counted in
+// touchscreen_tick() periods, so a new touchscreen_init() period does not
+// restart it.  A tap reads as pressed for one tick, then released until it
+// is acknowledged.  Lines starting with '#' are comments.  Returns false if
+// the file cannot be read.
+bool touchscreen_host_loadScript(const char *fileName);
+
+#endif /* TOUCHSCREEN_HOST_H_ */
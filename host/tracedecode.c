@@ -0,0 +1,130 @@
+// Decodes the state-change traces printed by trace_dump() (trace.h).
+//
+// Reads a console log, from a file or stdin, skips everything that is not
+// part of a dump and prints each record as
+//   <microseconds> <entity>[<index>] <old state> -> <new state>
+// with times relative to the oldest record of its dump.
+//
+// Usage: tracedecode [console.log]
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "sound.h"
+#include "trace.h"
+
+#define MICROSECONDS_PER_SECOND 1000000
+
+// State names, in the order of the state enums of missile.c, plane.c,
+// powerup.c and sound.c. A quality level is named after the last item shed.
+static const char *const missileStates[] = {"init", "move", "explode_grow",
+                                            "explode_shrink", "dead"};
+static const char *const flyerStates[] = {"init", "move", "dead"};
+static const char *const soundStates[] = {"init", "wait", "play"};
+static const char *const voiceStates[] = {"free", "cut_off"};
+// Quality levels, in the order of quality_item_t.
+static const char *const qualityLevels[] = {"full", "hud", "powerupColor",
+                                            "trails"};
+static const char *const sounds[] = {
+    [sound_gameStart_e] = "gameStart",
+    [sound_gunFire_e] = "gunFire",
+    [sound_hit_e] = "hit",
+    [sound_gunClick_e] = "gunClick",
+    [sound_gunReload_e] = "gunReload",
+    [sound_loseLife_e] = "loseLife",
+    [sound_gameOver_e] = "gameOver",
+    [sound_returnToBase_e] = "returnToBase",
+    [sound_oneSecondSilence_e] = "oneSecondSilence",
+    [sound_johnCena_e] = "johnCena",
+    [sound_robloxOof_e] = "robloxOof",
+    [sound_missionFailed_e] = "missionFailed",
+};
+
+#define COUNT(array) (sizeof(array) / sizeof(array[0]))
+
+typedef struct {
+  const char *name;
+  const char *const *oldStates;
+  uint32_t oldCount;
+  const char *const *newStates;
+  uint32_t newCount;
+} entity_t;
+
+static const entity_t entities[trace_entityCount_e] = {
+    [trace_missile_e] = {"missile", missileStates, COUNT(missileStates),
+                         missileStates, COUNT(missileStates)},
+    [trace_plane_e] = {"plane", flyerStates, COUNT(flyerStates), flyerStates,
+                       COUNT(flyerStates)},
+    [trace_powerup_e] = {"powerup", flyerStates, COUNT(flyerStates),
+                         flyerStates, COUNT(flyerStates)},
+    [trace_sound_e] = {"sound", soundStates, COUNT(soundStates), soundStates,
+                       COUNT(soundStates)},
+    [trace_voice_e] = {"voice", voiceStates, COUNT(voiceStates), sounds,
+                       COUNT(sounds)},
+    [trace_quality_e] = {"quality", qualityLevels, COUNT(qualityLevels),
+                         qualityLevels, COUNT(qualityLevels)},
+};
+
+// Print a state by name, or by number if it has none.
+static void printState(const char *const *names, uint32_t count,
+                       unsigned state) {
+  if (state < count && names[state])
+    printf("%s", names[state]);
+  else
+    printf("%u", state);
+}
+
+int main(int argc, char *argv[]) {
+  FILE *fp = stdin;
+  if (argc > 2) {
+    fprintf(stderr, "Usage: tracedecode [console.log]\n");
+    return -1;
+  }
+  if (argc == 2 && !(fp = fopen(argv[1], "r"))) {
+    fprintf(stderr, "Unable to open file: %s\n", argv[1]);
+    return -1;
+  }
+  char line[256];
+  bool inDump = false;
+  unsigned long countsPerSecond = 0, lost = 0;
+  uint32_t previous = 0;
+  uint64_t elapsed = 0; // Counts since the first record, across wraps.
+  uint32_t records = 0;
+  while (fgets(line, sizeof(line), fp)) {
+    unsigned long timestamp;
+    unsigned entity, index, oldState, newState;
+    if (sscanf(line, "trace begin %lx %lx", &countsPerSecond, &lost) == 2) {
+      inDump = countsPerSecond != 0;
+      records = 0;
+      printf("# dump: %lu older records were overwritten\n", lost);
+    } else if (strncmp(line, "trace end", 9) == 0) {
+      inDump = false;
+    } else if (inDump && sscanf(line, "trace %lx %x %x %x %x", &timestamp,
+                                &entity, &index, &oldState, &newState) == 5) {
+      if (records++ == 0) {
+        previous = timestamp;
+        elapsed = 0;
+      }
+      elapsed += (uint32_t)(timestamp - previous); // The counter wraps.
+      previous = timestamp;
+      printf("%10llu ", (unsigned long long)(elapsed *
+                                              MICROSECONDS_PER_SECOND /
+                                              countsPerSecond));
+      if (entity >= trace_entityCount_e) {
+        printf("entity%u[%u] %u -> %u\n", entity, index, oldState, newState);
+        continue;
+      }
+      const entity_t *e = &entities[entity];
+      printf("%s[%u] ", e->name, index);
+      printState(e->oldStates, e->oldCount, oldState);
+      printf(" -> ");
+      printState(e->newStates, e->newCount, newState);
+      printf("\n");
+    }
+  }
+  if (fp != stdin)
+    fclose(fp);
+  return 0;
+}
@@ -0,0 +1,315 @@
+// Difficulty auto-tuner.
+//
+// Plays autopilot games headless across all cores and searches for the
+// difficulty that gives the requested win rate, then writes it out as a header
+// that config.h picks up through CONFIG_DIFFICULTY_HEADER.
+//
+// The difficulty constants are all mapped onto a single level between 0 (easy)
+// and 1 (hard).  Each round evaluates one candidate level per worker, spaced
+// across the current bracket, and narrows the bracket to the pair of candidates
+// that straddle the target.  Every candidate plays the same seeds so the
+// comparison between them is not swamped by noise.
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "autopilot.h"
+#include "config.h"
+#include "difficulty.h"
+#include "display_host.h"
+#include "gameControl.h"
+
+#define GAME_SECONDS 240 // Same limit as main_m3.c
+#define GAME_TICKS ((uint32_t)(GAME_SECONDS / CONFIG_GAME_TIMER_PERIOD))
+
+#define MAX_CANDIDATES 64
+#define DEFAULT_TARGET 0.5
+#define DEFAULT_GAMES 2000
+#define DEFAULT_ROUNDS 5
+#define DEFAULT_SEED 330
+#define DEFAULT_OUTPUT "difficulty_tuned.h"
+
+// Easy and hard ends of each difficulty constant.
+static const difficulty_t easiest = {
+    .enemy_missile_count = 3,
+    .enemy_respawn_delay_us = 2000000,
+    .enemy_speed_multiplier_max = 1.0f,
+    .ufo_respawn_min_us = 3000000,
+    .ufo_respawn_range_s = 5,
+    .game_over_impacts = 30,
+};
+static const difficulty_t hardest = {
+    .enemy_missile_count = CONFIG_MAX_ENEMY_MISSILES,
+    .enemy_respawn_delay_us = 0,
+    .enemy_speed_multiplier_max = 3.0f,
+    .ufo_respawn_min_us = 10000000,
+    .ufo_respawn_range_s = 15,
+    .game_over_impacts = 8,
+};
+
+typedef struct {
+  double target;
+  uint32_t games;
+  uint32_t rounds;
+  uint32_t workers;
+  uint32_t seed;
+  const char *output;
+} tuner_options_t;
+
+// Linear interpolation between the easy and hard value of one constant.
+static double lerp(double easy, double hard, double level) {
+  return easy + (hard - easy) * level;
+}
+
+// Map a level between 0 and 1 onto every difficulty constant.
+static void difficultyForLevel(double level, difficulty_t *difficulty) {
+  difficulty->enemy_missile_count = (uint16_t)lround(
+      lerp(easiest.enemy_missile_count, hardest.enemy_missile_count, level));
+  difficulty->enemy_respawn_delay_us = (uint32_t)lerp(
+      easiest.enemy_respawn_delay_us, hardest.enemy_respawn_delay_us, level);
+  difficulty->enemy_speed_multiplier_max =
+      (float)lerp(easiest.enemy_speed_multiplier_max,
+                  hardest.enemy_speed_multiplier_max, level);
+  difficulty->ufo_respawn_min_us = (uint32_t)lerp(
+      easiest.ufo_respawn_min_us, hardest.ufo_respawn_min_us, level);
+  difficulty->ufo_respawn_range_s = (uint16_t)lround(
+      lerp(easiest.ufo_respawn_range_s, hardest.ufo_respawn_range_s, level));
+  difficulty->game_over_impacts = (uint16_t)lround(
+      lerp(easiest.game_over_impacts, hardest.game_over_impacts, level));
+}
+
+// Play one headless autopilot game, return true if it was won.
+static bool playGame(uint32_t seed, const difficulty_t *difficulty) {
+  autopilot_config_t pilot = {
+      .reaction_us = CONFIG_AUTOPILOT_REACTION_US,
+      .shot_interval_us = CONFIG_AUTOPILOT_SHOT_INTERVAL_US,
+      .aim_error = CONFIG_AUTOPILOT_AIM_ERROR,
+      .target_ufo = true,
+      .seed = seed,
+  };
+  srand(seed);
+  difficulty_set(difficulty);
+  gameControl_init();
+  autopilot_init(&pilot);
+  autopilot_enable(true);
+  for (uint32_t tick = 0; tick < GAME_TICKS && !getGameStatus(); tick++)
+    gameControl_tick(CONFIG_GAME_TIMER_PERIOD_US);
+  return didYouWin();
+}
+
+// Worker body: play every games-th game starting at first for each candidate
+// and write the per-candidate win counts to fd.
+static void runWorker(int fd, const double *levels, uint32_t candidates,
+                      uint32_t first, const tuner_options_t *options) {
+  uint32_t wins[MAX_CANDIDATES] = {0};
+  for (uint32_t c = 0; c < candidates; c++) {
+    difficulty_t difficulty;
+    difficultyForLevel(levels[c], &difficulty);
+    for (uint32_t g = first; g < options->games; g += options->workers)
+      wins[c] += playGame(options->seed + g, &difficulty);
+  }
+  if (write(fd, wins, sizeof(wins[0]) * candidates) < 0)
+    _exit(1);
+  _exit(0);
+}
+
+// Evaluate the win rate of every candidate level in parallel.
+static bool evaluate(const double *levels, uint32_t candidates,
+                     const tuner_options_t *options, double *winRates) {
+  int fds[options->workers];
+  pid_t pids[options->workers];
+  for (uint32_t w = 0; w < options->workers; w++) {
+    int pipeFds[2];
+    if (pipe(pipeFds) < 0) {
+      perror("pipe");
+      return false;
+    }
+    pids[w] = fork();
+    if (pids[w] < 0) {
+      perror("fork");
+      return false;
+    }
+    if (pids[w] == 0) {
+      close(pipeFds[0]);
+      runWorker(pipeFds[1], levels, candidates, w, options);
+    }
+    close(pipeFds[1]);
+    fds[w] = pipeFds[0];
+  }
+
+  uint32_t totalWins[MAX_CANDIDATES] = {0};
+  bool ok = true;
+  for (uint32_t w = 0; w < options->workers; w++) {
+    uint32_t wins[MAX_CANDIDATES];
+    size_t size = sizeof(wins[0]) * candidates;
+    if (read(fds[w], wins, size) != (ssize_t)size)
+      ok = false;
+    else
+      for (uint32_t c = 0; c < candidates; c++)
+        totalWins[c] += wins[c];
+    close(fds[w]);
+    int status;
+    waitpid(pids[w], &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+      ok = false;
+  }
+  for (uint32_t c = 0; c < candidates; c++)
+    winRates[c] = (double)totalWins[c] / options->games;
+  return ok;
+}
+
+// Write the tuned difficulty as a header config.h can include.
+static bool writeHeader(const char *fileName, const difficulty_t *difficulty,
+                        double level, double winRate,
+                        const tuner_options_t *options) {
+  FILE *fp = fopen(fileName, "w");
+  if (!fp) {
+    fprintf(stderr, "Unable to open file: %s for writing.\n", fileName);
+    return false;
+  }
+  // Every option that changes the search: the worker count sets how many
+  // candidates each round tries.
+  fprintf(fp, "// This file was generated by executing this statement: tuner "
+              "-t %.3f -g %u -r %u -j %u -s %u\n",
+          options->target, options->games, options->rounds, options->workers,
+          options->seed);
+  fprintf(fp, "// Level %.4f won %.1f%% of %u autopilot games.\n", level,
+          winRate * 100, options->games);
+  fprintf(fp, "#define CONFIG_ENEMY_MISSILE_COUNT %u\n",
+          difficulty->enemy_missile_count);
+  fprintf(fp, "#define CONFIG_ENEMY_RESPAWN_DELAY_US %u\n",
+          difficulty->enemy_respawn_delay_us);
+  fprintf(fp, "#define CONFIG_ENEMY_SPEED_MULTIPLIER_MAX %.3ff\n",
+          difficulty->enemy_speed_multiplier_max);
+  fprintf(fp, "#define CONFIG_UFO_RESPAWN_MIN_US %u\n",
+          difficulty->ufo_respawn_min_us);
+  fprintf(fp, "#define CONFIG_UFO_RESPAWN_RANGE_SECONDS %u\n",
+          difficulty->ufo_respawn_range_s);
+  fprintf(fp, "#define CONFIG_GAME_OVER_IMPACTS %u\n",
+          difficulty->game_over_impacts);
+  fclose(fp);
+  return true;
+}
+
+static double nowSeconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void usage() {
+  fprintf(stderr, "Usage: tuner [-t target_win_rate] [-g games_per_candidate] "
+                  "[-r rounds] [-j workers] [-s seed] [-o output.h]\n");
+  exit(-1);
+}
+
+int main(int argc, char *argv[]) {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  tuner_options_t options = {
+      .target = DEFAULT_TARGET,
+      .games = DEFAULT_GAMES,
+      .rounds = DEFAULT_ROUNDS,
+      .workers = cores > 0 ? (uint32_t)cores : 1,
+      .seed = DEFAULT_SEED,
+      .output = DEFAULT_OUTPUT,
+  };
+  int opt;
+  while ((opt = getopt(argc, argv, "t:g:r:j:s:o:")) != -1) {
+    switch (opt) {
+    case 't':
+      options.target = atof(optarg);
+      break;
+    case 'g':
+      options.games = strtoul(optarg, NULL, 0);
+      break;
+    case 'r':
+      options.rounds = strtoul(optarg, NULL, 0);
+      break;
+    case 'j':
+      options.workers = strtoul(optarg, NULL, 0);
+      break;
+    case 's':
+      options.seed = strtoul(optarg, NULL, 0);
+      break;
+    case 'o':
+      options.output = optarg;
+      break;
+    default:
+      usage();
+    }
+  }
+  if (options.games == 0 || options.workers == 0 || options.target < 0 ||
+      options.target > 1)
+    usage();
+  display_host_setRaster(false); // Nobody looks at the screen.
+
+  // At least 3 candidates per round so the bracket keeps shrinking.
+  uint32_t candidates = options.workers < 3 ? 3 : options.workers;
+  if (candidates > MAX_CANDIDATES)
+    candidates = MAX_CANDIDATES;
+
+  double lo = 0, hi = 1;
+  double bestLevel = 0, bestWinRate = 0, bestError = 2;
+  uint64_t gamesPlayed = 0;
+  double start = nowSeconds();
+  for (uint32_t round = 0; round < options.rounds; round++) {
+    double levels[MAX_CANDIDATES];
+    double winRates[MAX_CANDIDATES];
+    for (uint32_t c = 0; c < candidates; c++)
+      levels[c] = lo + (hi - lo) * c / (candidates - 1);
+    if (!evaluate(levels, candidates, &options, winRates)) {
+      fprintf(stderr, "ERROR: a worker failed.\n");
+      return -1;
+    }
+    gamesPlayed += (uint64_t)candidates * options.games;
+
+    uint32_t closest = 0;
+    for (uint32_t c = 0; c < candidates; c++) {
+      fprintf(stderr, "round %u level %.4f win rate %.3f\n", round, levels[c],
+              winRates[c]);
+      double error = fabs(winRates[c] - options.target);
+      if (error < fabs(winRates[closest] - options.target))
+        closest = c;
+      if (error < bestError) {
+        bestError = error;
+        bestLevel = levels[c];
+        bestWinRate = winRates[c];
+      }
+    }
+    // Harder levels win less, so look for the pair that straddles the target.
+    uint32_t c = 0;
+    while (c + 1 < candidates &&
+           !(winRates[c] >= options.target &&
+             winRates[c + 1] <= options.target))
+      c++;
+    if (c + 1 < candidates) {
+      lo = levels[c];
+      hi = levels[c + 1];
+    } else {
+      // No crossing (noise or target out of reach), zoom in on the closest.
+      uint32_t left = closest > 0 ? closest - 1 : 0;
+      uint32_t right = closest + 1 < candidates ? closest + 1 : closest;
+      lo = levels[left];
+      hi = levels[right];
+    }
+  }
+  double elapsed = nowSeconds() - start;
+  fprintf(stderr, "%llu games in %.1f s (%.0f games/minute)\n",
+          (unsigned long long)gamesPlayed, elapsed,
+          gamesPlayed / elapsed * 60);
+
+  difficulty_t best;
+  difficultyForLevel(bestLevel, &best);
+  fprintf(stderr, "best level %.4f win rate %.3f (target %.3f)\n", bestLevel,
+          bestWinRate, options.target);
+  if (!writeHeader(options.output, &best, bestLevel, bestWinRate, &options))
+    return -1;
+  return 0;
+}
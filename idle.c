@@ -0,0 +1,66 @@
+#include <stdio.h>
+
+#include "idle.h"
+
+#define IDLE_PERCENT 100
+
+static idle_stats_t idle_stats;
+static uint64_t idle_tickStartUs; // When the current tick started.
+static uint64_t idle_tickIdleUs;  // Time asleep so far this tick.
+
+// Starts the clock. Call once before the first tick.
+void idle_init() {
+  idle_resetStats();
+  idle_tickStartUs = idle_hal_nowUs();
+  idle_tickIdleUs = 0;
+}
+
+// Sleeps until the next interrupt, unless *wake is already set. Checking
+// *wake and sleeping can't race with an interrupt setting it.
+void idle_sleep(volatile bool *wake) {
+  uint64_t start = idle_hal_nowUs();
+  idle_hal_waitForInterrupt(wake);
+  idle_tickIdleUs += idle_hal_nowUs() - start;
+}
+
+// Ends the current tick's duty-cycle record and starts the next.
+void idle_endTick() {
+  uint64_t now = idle_hal_nowUs();
+  uint32_t idle = idle_tickIdleUs;
+  uint32_t busy = now - idle_tickStartUs - idle;
+  idle_tickStartUs = now;
+  idle_tickIdleUs = 0;
+
+  idle_stats.ticks++;
+  idle_stats.busy_us += busy;
+  idle_stats.idle_us += idle;
+  idle_stats.last_busy_us = busy;
+  idle_stats.last_idle_us = idle;
+  if (busy > idle_stats.max_busy_us)
+    idle_stats.max_busy_us = busy;
+  if (idle < idle_stats.min_idle_us)
+    idle_stats.min_idle_us = idle;
+}
+
+// Returns the duty-cycle statistics.
+idle_stats_t idle_getStats() { return idle_stats; }
+
+// Clears the statistics.
+void idle_resetStats() {
+  idle_stats = (idle_stats_t){.min_idle_us = UINT32_MAX};
+}
+
+// Prints the statistics.
+void idle_printStats() {
+  uint64_t total = idle_stats.busy_us + idle_stats.idle_us;
+  if (idle_stats.ticks == 0 || total == 0)
+    return;
+  printf("duty cycle: %lu%% busy over %lu ticks, mean %lu us busy and %lu us "
+         "idle per tick, max %lu us busy, min %lu us idle\n",
+         (unsigned long)(idle_stats.busy_us * IDLE_PERCENT / total),
+         (unsigned long)idle_stats.ticks,
+         (unsigned long)(idle_stats.busy_us / idle_stats.ticks),
+         (unsigned long)(idle_stats.idle_us / idle_stats.ticks),
+         (unsigned long)idle_stats.max_busy_us,
+         (unsigned long)idle_stats.min_idle_us);
+}
@@ -0,0 +1,49 @@
+#ifndef IDLE_H_
+#define IDLE_H_
+
+// Sleeps the CPU between interrupts instead of spinning, and keeps duty-cycle
+// statistics: how much of each game tick was spent working and how much
+// asleep. idle_xilinx.c sleeps with WFI; host/idle_host.c waits on a
+// condition variable that the emulated interrupts signal.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+  uint32_t ticks;         // Ticks ended by idle_endTick().
+  uint64_t busy_us;       // Time awake, over every tick.
+  uint64_t idle_us;       // Time asleep, over every tick.
+  uint32_t last_busy_us;  // Time awake during the last tick.
+  uint32_t last_idle_us;  // Time asleep during the last tick.
+  uint32_t max_busy_us;   // Most time awake during one tick.
+  uint32_t min_idle_us;   // Least time asleep during one tick.
+} idle_stats_t;
+
+// Starts the clock. Call once before the first tick.
+void idle_init();
+
+// Sleeps until the next interrupt, unless *wake is already set. Checking
+// *wake and sleeping can't race with an interrupt setting it.
+void idle_sleep(volatile bool *wake);
+
+// Ends the current tick's duty-cycle record and starts the next.
+void idle_endTick();
+
+// Returns the duty-cycle statistics.
+idle_stats_t idle_getStats();
+
+// Clears the statistics.
+void idle_resetStats();
+
+// Prints the statistics.
+void idle_printStats();
+
+// Implemented by the platform.
+
+// Microseconds since some fixed point.
+uint64_t idle_hal_nowUs();
+
+// Sleeps until an interrupt has been taken, unless *wake is set.
+void idle_hal_waitForInterrupt(volatile bool *wake);
+
+#endif /* IDLE_H_ */
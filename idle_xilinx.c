@@ -0,0 +1,25 @@
+#include "idle.h"
+#include "xil_exception.h"
+#include "xtime_l.h"
+
+#define IDLE_MICROSECONDS_PER_SECOND 1000000
+
+// Microseconds since some fixed point. Uses the Cortex-A9 global timer, which
+// keeps counting while the core sleeps; the SCU private timer belongs to
+// TimerDelay().
+uint64_t idle_hal_nowUs() {
+  XTime now;
+  XTime_GetTime(&now);
+  return now / (COUNTS_PER_SECOND / IDLE_MICROSECONDS_PER_SECOND);
+}
+
+// Sleeps until an interrupt has been taken, unless *wake is set. IRQs are
+// masked around the check so an interrupt that sets *wake just after it can't
+// be slept through: WFI still wakes on an IRQ that is pending but masked, and
+// the handler runs as soon as they are unmasked again.
+void idle_hal_waitForInterrupt(volatile bool *wake) {
+  Xil_ExceptionDisable();
+  if (!*wake)
+    __asm__ volatile("wfi" ::: "memory");
+  Xil_ExceptionEnable();
+}
@@ -29,7 +29,7 @@ void isr() {
 
   // Tick all missiles
   for (uint16_t i = 0; i < CONFIG_MAX_TOTAL_MISSILES; i++) {
-    missile_tick(&missiles[i]);
+    missile_tick(&missiles[i], CONFIG_GAME_TIMER_PERIOD_US);
   }
 }
 
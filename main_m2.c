@@ -55,6 +55,10 @@ int main() {
   intervalTimer_start(INTERVAL_TIMER_0);
   intervalTimer_start(INTERVAL_TIMER_1);
 
+  // Game time is advanced by every timer period that has passed, including any
+  // that expired while the previous tick was still running.
+  uint32_t last_triggered_count = 0;
+
   // Main game loop
   while (isr_triggered_count < RUNTIME_TICKS) {
     while (!interrupt_flag)
@@ -62,7 +66,10 @@ int main() {
     interrupt_flag = false;
     isr_handled_count++;
 
-    gameControl_tick();
+    uint32_t triggered_count = isr_triggered_count;
+    gameControl_tick((triggered_count - last_triggered_count) *
+                     CONFIG_GAME_TIMER_PERIOD_US);
+    last_triggered_count = triggered_count;
   }
   printf("Handled %d of %d interrupts\n", isr_handled_count,
          isr_triggered_count);
@@ -9,9 +9,20 @@
 #include "touchscreen.h"
 #include "sound.h"
 #include "display.h"
+#include "autopilot.h"
+#include "console.h"
+#include "idle.h"
+#include "overlay.h"
+#include "profile.h"
+#include "quality.h"
+#include "rate.h"
+#include "swtimer.h"
+#include "telemetry.h"
+#include "tick.h"
+#include "trace.h"
 
 #define RUNTIME_S 240
-#define RUNTIME_TICKS ((int)(RUNTIME_S / CONFIG_GAME_TIMER_PERIOD))
+#define RUNTIME_US ((uint64_t)RUNTIME_S * CONFIG_MICROSECONDS_PER_SECOND)
 
 #define START_HEIGHT 80 //Start text height
 #define START_WIDTH 40 //Start text width
@@ -19,23 +30,38 @@
 #define SECOND_WIDTH 160 //Second Width for stats
 #define TEXT_SIZE 5 //Text size
 
-volatile bool interrupt_flag;
+#define CONSOLE_PRINT_PROFILE 'p'  // Print the profile.
+#define CONSOLE_RESET_PROFILE 'r'  // Clear the profile.
+#define CONSOLE_NEXT_RATE 't'      // Step to the next game tick rate.
+#define CONSOLE_PRINT_STATS 's'    // Print the duty cycle and tick counters.
+#define CONSOLE_DUMP_TRACE 'd'     // Print the trace for host/tracedecode.
+#define CONSOLE_TOGGLE_OVERLAY 'o' // Show or hide the performance overlay.
+#define CONSOLE_QUIT 'q'           // End the run now.
+
+static bool quit = false;
 
-uint32_t isr_triggered_count;
-uint32_t isr_handled_count;
+volatile bool interrupt_flag;
 
 // Interrupt handler for game - use flag method so that it can be interrupted by
 // the touchscreen tick while running.
 void game_isr() {
   intervalTimer_ackInterrupt(INTERVAL_TIMER_0);
   interrupt_flag = true;
-  isr_triggered_count++;
+  tick_isr();
 }
 
-// Interrupt handler for touchscreen - tick directly
+// Interrupt handler for touchscreen - tick directly. It also drives the
+// wall-clock software timers.
 void touchscreen_isr() {
   intervalTimer_ackInterrupt(INTERVAL_TIMER_1);
   touchscreen_tick();
+  swtimer_advance(swtimer_real_e, rate_getPeriods().touch_period_us);
+}
+
+// Interrupt handler for audio - refill the FIFO from the mixed samples
+void audio_isr() {
+  intervalTimer_ackInterrupt(INTERVAL_TIMER_2);
+  sound_isr();
 }
 
 void game_win_cutscene(){
@@ -57,44 +83,112 @@ void game_loss_cutscene(){
   sound_missionFailed();
 }
 
+// Run the debug command typed on the UART, if any.
+void handle_console() {
+  switch (console_readChar()) {
+  case CONSOLE_PRINT_PROFILE:
+    profile_print();
+    break;
+  case CONSOLE_RESET_PROFILE:
+    profile_reset();
+    break;
+  case CONSOLE_NEXT_RATE:
+    // Start the counters over so they describe the new rate alone.
+    rate_next();
+    profile_reset();
+    idle_resetStats();
+    break;
+  case CONSOLE_PRINT_STATS:
+    idle_printStats();
+    tick_printStats();
+    break;
+  case CONSOLE_DUMP_TRACE:
+    trace_dump();
+    break;
+  case CONSOLE_TOGGLE_OVERLAY:
+    overlay_toggle();
+    break;
+  case CONSOLE_QUIT:
+    quit = true;
+    break;
+  }
+}
+
 // Milestone 3 test application
 int main() {
   interrupt_flag = false;
-  isr_triggered_count = 0;
-  isr_handled_count = 0;
+  rate_init(CONFIG_GAME_TIMER_PERIOD_US);
+  rate_periods_t periods = rate_getPeriods();
+  tick_init(periods.game_period_us, CONFIG_TICK_OVERRUN_POLICY);
 
   display_init();
-  touchscreen_init(CONFIG_TOUCHSCREEN_TIMER_PERIOD);
+  touchscreen_init((double)periods.touch_period_us /
+                   CONFIG_MICROSECONDS_PER_SECOND);
   gameControl_init();
+  quality_setBudget(periods.game_period_us);
+  autopilot_init(NULL);
+  autopilot_enable(CONFIG_AUTOPILOT_ENABLED);
 
   // Initialize timer interrupts
   interrupts_init();
   interrupts_register(INTERVAL_TIMER_0_INTERRUPT_IRQ, game_isr);
   interrupts_register(INTERVAL_TIMER_1_INTERRUPT_IRQ, touchscreen_isr);
+  interrupts_register(INTERVAL_TIMER_2_INTERRUPT_IRQ, audio_isr);
   interrupts_irq_enable(INTERVAL_TIMER_0_INTERRUPT_IRQ);
   interrupts_irq_enable(INTERVAL_TIMER_1_INTERRUPT_IRQ);
+  interrupts_irq_enable(INTERVAL_TIMER_2_INTERRUPT_IRQ);
 
-  intervalTimer_initCountDown(INTERVAL_TIMER_0, CONFIG_GAME_TIMER_PERIOD);
+  intervalTimer_initCountDown(INTERVAL_TIMER_0,
+                              (double)periods.game_period_us /
+                                  CONFIG_MICROSECONDS_PER_SECOND);
   intervalTimer_initCountDown(INTERVAL_TIMER_1,
-                              CONFIG_TOUCHSCREEN_TIMER_PERIOD);
+                              (double)periods.touch_period_us /
+                                  CONFIG_MICROSECONDS_PER_SECOND);
+  intervalTimer_initCountDown(INTERVAL_TIMER_2, CONFIG_AUDIO_TIMER_PERIOD);
   intervalTimer_enableInterrupt(INTERVAL_TIMER_0);
   intervalTimer_enableInterrupt(INTERVAL_TIMER_1);
-  intervalTimer_start(INTERVAL_TIMER_0);
+  intervalTimer_enableInterrupt(INTERVAL_TIMER_2);
   intervalTimer_start(INTERVAL_TIMER_1);
 
   sound_initialize(); // Initializes the sound functionality
+  sound_setInterruptDriven(true); // audio_isr() feeds the FIFO
+  intervalTimer_start(INTERVAL_TIMER_2);
   //sound_runTest(); // Plays all the possible sounds to test them at the beginning of the game
   sound_introSong(); // Plays the intro song for the game start
+  // Game time starts now, so the intro isn't handed to the first tick.
+  intervalTimer_start(INTERVAL_TIMER_0);
 
   // Main game loop
-  while ((isr_triggered_count < RUNTIME_TICKS) && !getGameStatus()) {
-    while (!interrupt_flag)
-      ;
+  idle_init();
+  telemetry_init();
+  // Nothing before the loop counts as an overrun.
+  interrupt_flag = false;
+  tick_resync();
+  // The run is timed rather than counted in ticks, which depend on the rate.
+  uint64_t start_us = idle_hal_nowUs();
+  while ((idle_hal_nowUs() - start_us < RUNTIME_US) && !getGameStatus() &&
+         !quit) {
+    // Sleep until the next tick. Every interrupt wakes the loop, so audio is
+    // mixed ahead as soon as the audio ISR has taken a buffer.
+    while (!interrupt_flag) {
+      swtimer_runExpired(swtimer_real_e);
+      uint32_t start = PROFILE_START();
+      sound_tick();
+      PROFILE_RECORD(profile_sound_e, start);
+      idle_sleep(&interrupt_flag);
+    }
     interrupt_flag = false;
-    isr_handled_count++;
-
-    gameControl_tick();
+    idle_endTick();
+
+    // Timer periods that expired while the previous tick was still running
+    // are handled by the overrun policy.
+    tick_run(gameControl_tick);
+    overlay_setDropped(tick_getStats().dropped);
+    telemetry_tick();
+    handle_console();
   }
+  idle_printStats();
+  tick_printStats();
   if (didYouWin()) {
     game_win_cutscene();
   }
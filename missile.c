@@ -7,6 +7,9 @@
 #include "missile.h"
 #include "display.h"
 #include "sound.h"
+#include "difficulty.h"
+#include "quality.h"
+#include "trace.h"
 
 #define SCREEN_WIDTH 320 //Display Width
 #define SCREEN_HEIGHT 240 //Display Height
@@ -21,16 +24,6 @@
 
 #define DEBUG_FLAG false //True if we want debug print statements
 
-// All printed messages for states are provided here.
-#define init_st_msg "Init State\n" //Init_st
-#define move_st_msg "Moving State\n" //Moving
-#define explode_grow_st_msg "Grow State\n" //ExplodeGrow
-#define explode_shrink_st_msg "Shrink State\n" //ExplodeShrink
-#define dead_st_msg "Dead State\n" //Dead
-
-#define DOUBLE_SPEED 2 //Used for doubling the speed as we only tick our missiles half as often
-#define TRIPLE_SPEED 3
-
 //States
 enum missile_st {
     init_st, //Init_st
@@ -40,6 +33,12 @@ enum missile_st {
     dead_st, //Dead
 };
 
+//Change state, recording the change in the trace
+static void setState(missile_t *missile, enum missile_st state){
+    TRACE(trace_missile_e, missile->id, missile->currentState, state);
+    missile->currentState = state;
+}
+
 // Return whether the given missile is dead.
 bool missile_is_dead(missile_t *missile){
     if(missile->currentState == dead_st){
@@ -84,6 +83,9 @@ void init_general(missile_t *missile){
     missile->total_length = computeLength(missile->x_origin,missile->y_origin,missile->x_dest,missile->y_dest); //Computes total end length
     missile->x_current = missile->x_origin;
     missile->y_current = missile->y_origin;
+    missile->x_drawn = missile->x_current;
+    missile->y_drawn = missile->y_current;
+    missile->trail_skipped = false;
     missile->impacted = false;
 }
 
@@ -95,7 +97,8 @@ void init_general(missile_t *missile){
 // game to ensure that player and plane missiles aren't moving before they
 // should.
 void missile_init_dead(missile_t *missile){
-    missile->currentState = dead_st;
+    setState(missile, dead_st);
+    missile->radius = 0; //Leftover explosions from a previous game shouldn't collide
     // init_general(missile);
 }
 
@@ -113,11 +116,11 @@ void missile_init_enemy(missile_t *missile){
     missile->y_dest = SCREEN_HEIGHT;
     missile->x_dest = rand() % SCREEN_WIDTH;
     // Set missile speed
-    float a = 1.5;
+    float a = difficulty_get()->enemy_speed_multiplier_max;
     float speed_multiplier = (((float)rand()/(float)(RAND_MAX)) * a);
-    missile->speed = speed_multiplier;
+    missile->speed = ((uint32_t)speed_multiplier) * CONFIG_ENEMY_MISSILE_BONUS_DISTANCE_PER_SECOND;
     // Set current state
-    missile->currentState = init_st;
+    setState(missile, init_st);
     init_general(missile); //General Init
 }
 
@@ -158,7 +161,7 @@ void missile_init_player(missile_t *missile, uint16_t x_dest, uint16_t y_dest){
     missile->x_dest = x_dest;
     missile->y_dest = y_dest;
     // Set current state
-    missile->currentState = init_st;
+    setState(missile, init_st);
     init_general(missile);
 }
 
@@ -168,24 +171,30 @@ double getPercentage(missile_t *missile){
     return percent;
 }
 
+// Return the speed, in pixels per second, the missile flies along its path.
+double missile_get_speed(missile_t *missile){
+    switch(missile->type){
+        case MISSILE_TYPE_PLAYER:
+            return CONFIG_PLAYER_MISSILE_DISTANCE_PER_SECOND;
+        case MISSILE_TYPE_ENEMY:
+            return missile->speed + CONFIG_ENEMY_MISSILE_DISTANCE_PER_SECOND;
+        case MISSILE_TYPE_PLANE:
+            return CONFIG_PLANE_MISSILE_DISTANCE_PER_SECOND;
+        default:
+            break;
+    }
+    return 0;
+}
+
 //Update the length of the missile when ticked from SM depending on its type
-void updateLength(missile_t *missile){
+void updateLength(missile_t *missile, uint32_t elapsed_us){
     if (DEBUG_FLAG){
         printf("Before Update : %f\n", missile->length);
         printf("Previous percentage : %f\n", getPercentage(missile));
         printf("Previous Total Length : %d\n", missile->total_length);
     }
-    switch(missile->type){ //Increments missile length
-        case MISSILE_TYPE_PLAYER:
-            missile->length = ((missile->length) + (CONFIG_PLAYER_MISSILE_DISTANCE_PER_TICK * DOUBLE_SPEED));
-            break;
-        case MISSILE_TYPE_ENEMY:
-            missile->length = (((missile->length) + (missile->speed + CONFIG_ENEMY_MISSILE_DISTANCE_PER_TICK) * DOUBLE_SPEED));
-            break;
-        case MISSILE_TYPE_PLANE:
-            missile->length = ((missile->length) + (CONFIG_ENEMY_MISSILE_DISTANCE_PER_TICK * DOUBLE_SPEED));
-            break;
-    }
+    //Increments missile length at the speed of its type
+    missile->length = ((missile->length) + CONFIG_DISTANCE_FOR_US(missile_get_speed(missile), elapsed_us));
     if (DEBUG_FLAG){
         printf("After Update : %f\n", missile->length);
         printf("Post percentage : %f\n", getPercentage(missile));
@@ -194,8 +203,11 @@ void updateLength(missile_t *missile){
 }
 
 //Draw Moving Line, erases if alive is false
+//Erasing erases the line last drawn, which may end short of the current location
 void drawMovingLine(missile_t *missile, bool alive){
     if(alive){
+        missile->x_drawn = missile->x_current;
+        missile->y_drawn = missile->y_current;
         if(missile->type == MISSILE_TYPE_PLAYER){ //Player Missile
             display_drawLine(missile->x_origin, missile->y_origin, missile->x_current, missile->y_current, DISPLAY_GREEN);
         }
@@ -207,7 +219,7 @@ void drawMovingLine(missile_t *missile, bool alive){
         }
     }
     else{ //Dead line
-        display_drawLine(missile->x_origin, missile->y_origin, missile->x_current, missile->y_current, DISPLAY_BLACK); //Erase old
+        display_drawLine(missile->x_origin, missile->y_origin, missile->x_drawn, missile->y_drawn, DISPLAY_BLACK); //Erase old
     }
 }
 
@@ -220,13 +232,13 @@ void updateLocation(missile_t *missile, double percentage){
 }
 
 //Increase radius for growing missile explosion
-void increaseRadius(missile_t *missile){
-    missile->radius = (missile->radius + (CONFIG_EXPLOSION_RADIUS_CHANGE_PER_TICK * TRIPLE_SPEED));
+void increaseRadius(missile_t *missile, uint32_t elapsed_us){
+    missile->radius = (missile->radius + CONFIG_DISTANCE_FOR_US(CONFIG_EXPLOSION_RADIUS_GROW_PER_SECOND, elapsed_us));
 }
 
 //Decrease radius for shrinking missile explosion
-void decreaseRadius(missile_t *missile){
-    missile->radius = (missile->radius - (CONFIG_EXPLOSION_RADIUS_CHANGE_PER_TICK * DOUBLE_SPEED));
+void decreaseRadius(missile_t *missile, uint32_t elapsed_us){
+    missile->radius = (missile->radius - CONFIG_DISTANCE_FOR_US(CONFIG_EXPLOSION_RADIUS_SHRINK_PER_SECOND, elapsed_us));
 }
 
 //Draw a circle if true, else erase a circle
@@ -247,42 +259,6 @@ void drawCircle(missile_t *missile, bool draw){
     }
 }
 
-// This is a debug state print routine. It will print the names of the states each
-// time tick() is called. It only prints states if they are different than the
-// previous state.
-void debugStatePrintMissiles(uint8_t currentState) {
-  static enum missile_st previousState;
-  static bool firstPass = true;
-  // Only print the message if:
-  // 1. This the first pass and the value for previousState is unknown.
-  // 2. previousState != currentState - this prevents reprinting the same state name over and over.
-  if (previousState != currentState || firstPass) {
-    firstPass = false;                // previousState will be defined, firstPass is false.
-    previousState = currentState;     // keep track of the last state that you were in.
-    switch(currentState) {            // This prints messages based upon the state that you were in.
-      case init_st:
-            printf(init_st_msg);
-            break;
-        case move_st:
-            printf(move_st_msg);
-            break;
-        case explode_grow_st:
-            printf(explode_grow_st_msg);
-            break;
-        case explode_shrink_st:
-            printf(explode_shrink_st_msg);
-            break;
-        case dead_st:
-            printf(dead_st_msg);
-            break;
-        default:
-        // print an error message here.
-            break;
-     }
-  }
-}
-
-
 // Initialize the missile as a plane missile.  This function takes an (x, y)
 // location of the plane which will be used as the origin.  The destination can
 // be randomly chosed along the bottom of the screen.
@@ -295,46 +271,43 @@ void missile_init_plane(missile_t *missile, int16_t plane_x, int16_t plane_y){
     missile->y_dest = SCREEN_HEIGHT;
     missile->x_dest = rand() % SCREEN_WIDTH;
     //Set current state
-    missile->currentState = init_st;
+    setState(missile, init_st);
     init_general(missile);
 }
 
 ////////// State Machine TICK Function //////////
-void missile_tick(missile_t *missile){
-    if(DEBUG_FLAG){
-        debugStatePrintMissiles(missile->currentState); //Debug SM
-    }
+void missile_tick(missile_t *missile, uint32_t elapsed_us){
     // Perform state update first.
     switch(missile->currentState) { //Mealy
         case init_st:
-            missile->currentState = move_st; //Move to next state
+            setState(missile, move_st); //Move to next state
             break;
         case move_st:
             if(missile->explode_me == true){ //If we explode mid path
-                missile->currentState = explode_grow_st; //Go into exploding state
+                setState(missile, explode_grow_st); //Go into exploding state
                 drawMovingLine(missile, false); //Erase path
                 break;
             }
             if(getPercentage(missile) >= 1){ //Did it reach its destination?
                 if((missile->type == MISSILE_TYPE_ENEMY) || (missile->type == MISSILE_TYPE_PLANE)){ //If enemy, it reached its end and should die
-                    missile->currentState = explode_grow_st;//explode on impact
+                    setState(missile, explode_grow_st);//explode on impact
                     drawMovingLine(missile, false); //Erase path
                     missile->impacted = true; //Used for counting number of impacted missiles
                 }
                 else{ //Player missiles should explode at end
-                    missile->currentState = explode_grow_st;//explode
+                    setState(missile, explode_grow_st);//explode
                     drawMovingLine(missile, false); //Erase path
                 }
             }
             break;
         case explode_grow_st:
             if(missile->radius >= CONFIG_EXPLOSION_MAX_RADIUS){ //Max radius reached
-                missile->currentState = explode_shrink_st; //Start shrinking
+                setState(missile, explode_shrink_st); //Start shrinking
             }
             break;
         case explode_shrink_st:
             if(missile->radius <= 0){ //Explosion gone, move to dead state
-                missile->currentState = dead_st;
+                setState(missile, dead_st);
                 drawCircle(missile, false); //Erase leftovers
             }
             break;
@@ -350,18 +323,23 @@ void missile_tick(missile_t *missile){
         case init_st:
             break;
         case move_st:
-            drawMovingLine(missile, false); //Erase old line
-            updateLength(missile);//Update length
+            updateLength(missile, elapsed_us);//Update length
             updateLocation(missile, getPercentage(missile));//Calculate new x and y
+            if(quality_isShed(quality_trails_e) && !missile->trail_skipped){ //Trails shed, redraw every other tick
+                missile->trail_skipped = true;
+                break;
+            }
+            missile->trail_skipped = false;
+            drawMovingLine(missile, false); //Erase old line
             drawMovingLine(missile, true); //Draw new line
             break;
         case explode_grow_st:
-            increaseRadius(missile); //Increase explosion radius
+            increaseRadius(missile, elapsed_us); //Increase explosion radius
             drawCircle(missile, true); //Draw new circle
             break;
         case explode_shrink_st:
             drawCircle(missile, false); //Erase old circle
-            decreaseRadius(missile); //Decrease radius of explosion
+            decreaseRadius(missile, elapsed_us); //Decrease radius of explosion
             drawCircle(missile, true); //Draw new circle
             break;
         case dead_st:
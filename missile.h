@@ -9,7 +9,8 @@ so this enum is used to identify the type of missile */
 typedef enum {
   MISSILE_TYPE_PLAYER,
   MISSILE_TYPE_ENEMY,
-  MISSILE_TYPE_PLANE
+  MISSILE_TYPE_PLANE,
+  MISSILE_TYPE_COUNT
 } missile_type_t;
 
 /* This struct contains all information about a missile */
@@ -22,6 +23,9 @@ typedef struct {
   // just declared as an integer type here)
   int32_t currentState;
 
+  // Slot in gameControl.c's missiles array, identifies the missile in traces
+  uint8_t id;
+
   // Starting x,y of missile
   uint16_t x_origin;
   uint16_t y_origin;
@@ -35,6 +39,12 @@ typedef struct {
   int16_t x_current;
   int16_t y_current;
 
+  // End of the trail on screen, which lags x,y_current by a tick while trails
+  // are shed (see quality.h)
+  int16_t x_drawn;
+  int16_t y_drawn;
+  bool trail_skipped;
+
   // While flying, this tracks the current length of the flight path
   double length;
 
@@ -48,9 +58,10 @@ typedef struct {
   // ground.
   bool impacted;
 
-  // Used to handle different speeds of enemy missiles
+  // Used to handle different speeds of enemy missiles (extra distance per
+  // second on top of the base enemy speed)
   uint32_t speed;
-  
+
 } missile_t;
 
 ////////// State Machine INIT Functions //////////
@@ -80,7 +91,9 @@ void missile_init_player(missile_t *missile, uint16_t x_dest, uint16_t y_dest);
 void missile_init_plane(missile_t *missile, int16_t plane_x, int16_t plane_y);
 
 ////////// State Machine TICK Function //////////
-void missile_tick(missile_t *missile);
+// elapsed_us is the game time, in microseconds, since this missile was last
+// ticked.  All motion is scaled by it.
+void missile_tick(missile_t *missile, uint32_t elapsed_us);
 
 // Return whether the given missile is dead.
 bool missile_is_dead(missile_t *missile);
@@ -92,6 +105,16 @@ bool missile_is_exploding(missile_t *missile);
 // Return whether the given missile is flying.
 bool missile_is_flying(missile_t *missile);
 
+// Compute and return the distance between 2 points
+double computeLength(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+// Return the speed, in pixels per second, the missile flies along its path.
+double missile_get_speed(missile_t *missile);
+
+// Return the x coordinate of the launch site a player missile aimed at x_dest
+// would be fired from.
+uint16_t getClosestLaunchSite(uint16_t x_dest);
+
 // Used to indicate that a flying missile should be detonated.  This occurs when
 // an enemy or plane missile is located within an explosion zone.
 void missile_trigger_explosion(missile_t *missile);
@@ -0,0 +1,189 @@
+#include "config.h"
+#include "display.h"
+#include "overlay.h"
+#include "quality.h"
+
+#define OVERLAY_MICROSECONDS_PER_SECOND 1000000
+
+#define OVERLAY_GLYPH_WIDTH 3
+#define OVERLAY_GLYPH_HEIGHT 5
+#define OVERLAY_GLYPH_MAX_RUNS 10 // Two runs on every row, at most.
+#define OVERLAY_SCALE 2           // Screen pixels per font pixel.
+#define OVERLAY_CELL_WIDTH ((OVERLAY_GLYPH_WIDTH + 1) * OVERLAY_SCALE)
+#define OVERLAY_CELL_HEIGHT ((OVERLAY_GLYPH_HEIGHT + 1) * OVERLAY_SCALE)
+#define OVERLAY_DIGITS 5
+#define OVERLAY_MAX_VALUE 99999
+#define OVERLAY_COLUMNS (2 + OVERLAY_DIGITS) // Label, space, value.
+#define OVERLAY_MARGIN 2
+#define OVERLAY_X                                                              \
+  (DISPLAY_WIDTH - OVERLAY_COLUMNS * OVERLAY_CELL_WIDTH - OVERLAY_MARGIN)
+#define OVERLAY_Y OVERLAY_MARGIN
+
+typedef enum {
+  overlay_tick_e,    // T: last tick.
+  overlay_worst_e,   // W: worst tick of the last second.
+  overlay_dropped_e, // D: dropped ticks.
+  overlay_ops_e,     // O: display operations of the last tick.
+  overlay_rowCount_e
+} overlay_row_t;
+
+static const char overlay_labels[overlay_rowCount_e] = {
+    [overlay_tick_e] = 'T',
+    [overlay_worst_e] = 'W',
+    [overlay_dropped_e] = 'D',
+    [overlay_ops_e] = 'O',
+};
+
+// The characters the overlay can show and their 3x5 font, one row per
+// entry, the most significant of the three bits on the left.
+static const char overlay_chars[] = "0123456789TWDO ";
+#define OVERLAY_GLYPH_COUNT (sizeof(overlay_chars) - 1)
+static const uint8_t overlay_font[OVERLAY_GLYPH_COUNT][OVERLAY_GLYPH_HEIGHT] = {
+    {7, 5, 5, 5, 7}, {2, 6, 2, 2, 7}, {7, 1, 7, 4, 7}, {7, 1, 7, 1, 7},
+    {5, 5, 7, 1, 1}, {7, 4, 7, 1, 7}, {7, 4, 7, 5, 7}, {7, 1, 1, 1, 1},
+    {7, 5, 7, 5, 7}, {7, 5, 7, 1, 7}, {7, 2, 2, 2, 2}, {5, 5, 5, 7, 5},
+    {6, 5, 5, 5, 6}, {2, 5, 5, 5, 2}, {0, 0, 0, 0, 0},
+};
+
+// A glyph as the runs of set pixels along its rows, so drawing it takes one
+// display_fillRect() per run instead of one per pixel.
+typedef struct {
+  uint8_t count;
+  uint8_t x[OVERLAY_GLYPH_MAX_RUNS];
+  uint8_t y[OVERLAY_GLYPH_MAX_RUNS];
+  uint8_t width[OVERLAY_GLYPH_MAX_RUNS];
+} overlay_glyph_t;
+
+static overlay_glyph_t overlay_glyphs[OVERLAY_GLYPH_COUNT];
+// The glyph index on screen in each cell.
+static uint8_t overlay_shown[overlay_rowCount_e][OVERLAY_COLUMNS];
+static uint8_t overlay_blank;
+
+static bool overlay_visible;
+static uint32_t overlay_dropped;
+static uint32_t overlay_opsAfterDraw; // Display operations after the last draw.
+static uint32_t overlay_windowUs;     // Game time in this second so far.
+static uint32_t overlay_windowWorstUs;
+static uint32_t overlay_worstUs; // Worst tick of the last full second.
+
+// Returns true if pixel x, y of glyph g is set.
+static bool overlay_fontPixel(uint8_t g, uint8_t x, uint8_t y) {
+  return x < OVERLAY_GLYPH_WIDTH &&
+         (overlay_font[g][y] & (1 << (OVERLAY_GLYPH_WIDTH - 1 - x)));
+}
+
+// Turns the font into runs.
+static void overlay_buildGlyphs() {
+  for (uint8_t g = 0; g < OVERLAY_GLYPH_COUNT; g++) {
+    overlay_glyph_t *glyph = &overlay_glyphs[g];
+    glyph->count = 0;
+    for (uint8_t y = 0; y < OVERLAY_GLYPH_HEIGHT; y++) {
+      for (uint8_t x = 0; x < OVERLAY_GLYPH_WIDTH; x++) {
+        if (!overlay_fontPixel(g, x, y))
+          continue;
+        uint8_t width = 1;
+        while (overlay_fontPixel(g, x + width, y))
+          width++;
+        glyph->x[glyph->count] = x;
+        glyph->y[glyph->count] = y;
+        glyph->width[glyph->count] = width;
+        glyph->count++;
+        x += width;
+      }
+    }
+  }
+}
+
+// Returns the glyph index of c, blank if the overlay has no glyph for it.
+static uint8_t overlay_glyphOf(char c) {
+  for (uint8_t g = 0; g < OVERLAY_GLYPH_COUNT; g++)
+    if (overlay_chars[g] == c)
+      return g;
+  return overlay_blank;
+}
+
+// Draws glyph g in a cell.
+static void overlay_drawGlyph(uint8_t row, uint8_t column, uint8_t g,
+                              uint16_t color) {
+  const overlay_glyph_t *glyph = &overlay_glyphs[g];
+  int16_t x = OVERLAY_X + column * OVERLAY_CELL_WIDTH;
+  int16_t y = OVERLAY_Y + row * OVERLAY_CELL_HEIGHT;
+  for (uint8_t i = 0; i < glyph->count; i++)
+    display_fillRect(x + glyph->x[i] * OVERLAY_SCALE,
+                     y + glyph->y[i] * OVERLAY_SCALE,
+                     glyph->width[i] * OVERLAY_SCALE, OVERLAY_SCALE, color);
+}
+
+// Shows c in a cell. The game draws over the corner too, missile trails
+// cross it and erasing them leaves holes in the glyphs, so the glyph is drawn
+// again every tick; only a glyph that changed is erased first.
+static void overlay_setCell(uint8_t row, uint8_t column, char c) {
+  uint8_t g = overlay_glyphOf(c);
+  if (overlay_shown[row][column] != g) {
+    overlay_drawGlyph(row, column, overlay_shown[row][column],
+                      CONFIG_BACKGROUND_COLOR);
+    overlay_shown[row][column] = g;
+  }
+  overlay_drawGlyph(row, column, g, CONFIG_OVERLAY_COLOR);
+}
+
+// Shows a row as its label and value, right-aligned, or blanks it.
+static void overlay_setRow(overlay_row_t row, uint32_t value) {
+  char text[OVERLAY_COLUMNS];
+  for (uint8_t i = 0; i < OVERLAY_COLUMNS; i++)
+    text[i] = ' ';
+  if (overlay_visible) {
+    text[0] = overlay_labels[row];
+    if (value > OVERLAY_MAX_VALUE)
+      value = OVERLAY_MAX_VALUE;
+    uint8_t i = OVERLAY_COLUMNS;
+    do {
+      text[--i] = '0' + value % 10;
+      value /= 10;
+    } while (value);
+  }
+  for (uint8_t i = 0; i < OVERLAY_COLUMNS; i++)
+    overlay_setCell(row, i, text[i]);
+}
+
+// Clears the counters and hides the overlay unless CONFIG_OVERLAY_ENABLED.
+void overlay_init() {
+  overlay_buildGlyphs();
+  overlay_blank = overlay_glyphOf(' ');
+  for (uint8_t row = 0; row < overlay_rowCount_e; row++)
+    for (uint8_t i = 0; i < OVERLAY_COLUMNS; i++)
+      overlay_shown[row][i] = overlay_blank;
+  overlay_visible = CONFIG_OVERLAY_ENABLED;
+  overlay_dropped = 0;
+  overlay_windowUs = 0;
+  overlay_windowWorstUs = 0;
+  overlay_worstUs = 0;
+  overlay_opsAfterDraw = overlay_hal_displayOps();
+}
+
+// Call at the end of every game tick, after quality_endTick().
+void overlay_tick(uint32_t elapsed_us) {
+  uint32_t ops = overlay_hal_displayOps() - overlay_opsAfterDraw;
+  uint32_t tick_us = quality_getStats().last_tick_us;
+  if (tick_us > overlay_windowWorstUs)
+    overlay_windowWorstUs = tick_us;
+  overlay_windowUs += elapsed_us;
+  if (overlay_windowUs >= OVERLAY_MICROSECONDS_PER_SECOND) {
+    overlay_worstUs = overlay_windowWorstUs;
+    overlay_windowWorstUs = 0;
+    overlay_windowUs = 0;
+  }
+
+  // Hidden rows are blanked, which draws nothing once they have been erased.
+  overlay_setRow(overlay_tick_e, tick_us);
+  overlay_setRow(overlay_worst_e, overlay_worstUs);
+  overlay_setRow(overlay_dropped_e, overlay_dropped);
+  overlay_setRow(overlay_ops_e, ops);
+  overlay_opsAfterDraw = overlay_hal_displayOps();
+}
+
+// Shows the overlay if it is hidden and hides it if it is shown.
+void overlay_toggle() { overlay_visible = !overlay_visible; }
+
+// Sets the dropped tick count shown.
+void overlay_setDropped(uint32_t dropped) { overlay_dropped = dropped; }
@@ -0,0 +1,42 @@
+#ifndef OVERLAY_H_
+#define OVERLAY_H_
+
+// A small performance readout in the top right corner of the screen:
+//   T  the length of the last game tick, in us
+//   W  the longest tick of the last second of game time, in us
+//   D  timer periods that did not get a tick of their own, see tick.h
+//   O  display operations the last tick made
+// Type 'o' on the UART to show or hide it.
+//
+// The overlay is drawn after the tick has been timed, and its own display
+// operations are left out of O, so it doesn't count itself. Its glyphs come
+// from a 3x5 font turned into rectangles once, in overlay_init(). Missiles
+// fly through the corner, so while the overlay is shown every glyph is drawn
+// again each tick, on top of the game, and only glyphs that changed are
+// erased. What an erase paints over is redrawn by the game on its next tick,
+// as missiles and explosions redraw themselves every tick.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Clears the counters and hides the overlay unless CONFIG_OVERLAY_ENABLED.
+// Call after the screen has been cleared.
+void overlay_init();
+
+// Call at the end of every game tick, after quality_endTick(), with the game
+// time the tick covered. Redraws the digits that changed.
+void overlay_tick(uint32_t elapsed_us);
+
+// Shows the overlay if it is hidden and hides it if it is shown. It is drawn
+// or erased on the next overlay_tick().
+void overlay_toggle();
+
+// Sets the dropped tick count shown, normally tick_getStats().dropped.
+void overlay_setDropped(uint32_t dropped);
+
+// Returns the display operations made since some fixed point. overlay_xilinx.c
+// counts the driver calls the game makes by wrapping them at link time,
+// host/overlay_host.c reads the host display's counter.
+uint32_t overlay_hal_displayOps();
+
+#endif /* OVERLAY_H_ */
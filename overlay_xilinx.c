@@ -0,0 +1,69 @@
+#include "display.h"
+#include "overlay.h"
+
+// The display driver doesn't count its calls, so the drawing calls the game
+// makes are wrapped at link time (-Wl,--wrap=display_fillRect and so on, see
+// CMakeLists.txt). Calls the driver makes to itself are not counted.
+static uint32_t overlay_displayOps;
+
+// Returns the display operations made since the program started.
+uint32_t overlay_hal_displayOps() { return overlay_displayOps; }
+
+void __real_display_fillScreen(uint16_t color);
+void __real_display_drawPixel(int16_t x, int16_t y, uint16_t color);
+void __real_display_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                             uint16_t color);
+void __real_display_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             uint16_t color);
+void __real_display_fillCircle(int16_t x0, int16_t y0, int16_t r,
+                               uint16_t color);
+void __real_display_fillTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                 int16_t y1, int16_t x2, int16_t y2,
+                                 uint16_t color);
+void __real_display_print(const char *str);
+void __real_display_printlnDecimalInt(int32_t value);
+
+void __wrap_display_fillScreen(uint16_t color) {
+  overlay_displayOps++;
+  __real_display_fillScreen(color);
+}
+
+void __wrap_display_drawPixel(int16_t x, int16_t y, uint16_t color) {
+  overlay_displayOps++;
+  __real_display_drawPixel(x, y, color);
+}
+
+void __wrap_display_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                             uint16_t color) {
+  overlay_displayOps++;
+  __real_display_drawLine(x0, y0, x1, y1, color);
+}
+
+void __wrap_display_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             uint16_t color) {
+  overlay_displayOps++;
+  __real_display_fillRect(x, y, w, h, color);
+}
+
+void __wrap_display_fillCircle(int16_t x0, int16_t y0, int16_t r,
+                               uint16_t color) {
+  overlay_displayOps++;
+  __real_display_fillCircle(x0, y0, r, color);
+}
+
+void __wrap_display_fillTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                 int16_t y1, int16_t x2, int16_t y2,
+                                 uint16_t color) {
+  overlay_displayOps++;
+  __real_display_fillTriangle(x0, y0, x1, y1, x2, y2, color);
+}
+
+void __wrap_display_print(const char *str) {
+  overlay_displayOps++;
+  __real_display_print(str);
+}
+
+void __wrap_display_printlnDecimalInt(int32_t value) {
+  overlay_displayOps++;
+  __real_display_printlnDecimalInt(value);
+}
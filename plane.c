@@ -8,13 +8,14 @@
 #include <stdlib.h>
 #include "missile.h"
 #include "sound.h"
+#include "difficulty.h"
+#include "swtimer.h"
+#include "trace.h"
 
 #define SCREEN_WIDTH 320 //Display Width
 #define PLANE_HEIGHT 70 //Height of plane
 
-#define DEBUG_FLAG true
-
-#define EIGHT_SECONDS 8
+#define EIGHT_SECONDS_US 8000000 //First appearance of the UFO
 
 #define PLANE_TRIANGLE_LENGTH 20
 #define HALF_PLANE_TRIANGLE_LENGTH 10
@@ -23,10 +24,6 @@
 #define UFO_TOP_RADIUS 2
 
 
-#define PLANE_INIT_MSG "In Plane Init State \n"
-#define PLANE_MOVE_MSG "In Plane Move State \n"
-#define PLANE_DEAD_MSG "In Plane Dead State \n"
-
 //States
 enum plane_st {
     plane_init_st, //Init_st
@@ -34,12 +31,19 @@ enum plane_st {
     plane_dead_st, //Dead
 };
 
-static int32_t resetTicks = 0; //Counts to ticks we need to reset
-static int32_t resetPlaneTicks = 0; //Counts up to the number of ticks it needs to reset
+static uint32_t reset_us = 0; //Game time we need to stay dead before resetting
+static swtimer_t respawn_timer; //Runs on game time while the plane is dead
+static bool respawn_due = false; //Set by respawn_timer once reset_us has passed
 
 // Current state 
 static int32_t currentState;
 
+//Change state, recording the change in the trace
+static void setState(enum plane_st state){
+    TRACE(trace_plane_e, 0, currentState, state);
+    currentState = state;
+}
+
 // Starting x,y of place
 static uint16_t x_origin = SCREEN_WIDTH;
 static uint16_t y_origin = PLANE_HEIGHT;
@@ -69,13 +73,18 @@ static bool missile_launched = false; //If we launched the missile
 // Pass in a pointer to the missile struct (the plane will only have one
 // missile)
 void plane_init(missile_t *plane_missile){
-    currentState = plane_init_st;
+    setState(plane_init_st);
     missile = plane_missile;
+    length = 0;
+    y_origin = PLANE_HEIGHT;
     x_current = x_origin;
     y_current = y_origin;
+    isExploded = false;
+    missile_launched = false;
     // missile.type = plane_missile;
-    resetPlaneTicks = 0;
-    resetTicks = EIGHT_SECONDS/CONFIG_GAME_TIMER_PERIOD;
+    swtimer_stop(&respawn_timer);
+    respawn_due = false;
+    reset_us = EIGHT_SECONDS_US;
 }
 
 // Trigger the plane to expode
@@ -91,14 +100,19 @@ display_point_t plane_getXY(){
     return newDisplayPoint;
 }
 
+// Return whether the plane is currently flying across the screen
+bool plane_isFlying(){
+    return (currentState == plane_move_st);
+}
+
 //Returns the percentage of distance the plane has traveled
 double planeGetPercentage(){
     return (length/total_length);
 }
 
-//Updates the total length the plane has traveled based off the tick
-void planeUpdateLength(){
-    length = length + CONFIG_PLANE_DISTANCE_PER_TICK;
+//Updates the total length the plane has traveled based off the elapsed time
+void planeUpdateLength(uint32_t elapsed_us){
+    length = length + CONFIG_DISTANCE_FOR_US(CONFIG_PLANE_DISTANCE_PER_SECOND, elapsed_us);
 }
 
 //Updates the X Coordinate of the plane
@@ -118,75 +132,55 @@ void drawPlane(bool erase){
     }
 }
 
-//Debug plane state
-void plane_debug_tick(){
-    static enum plane_st previousState;
-    static bool firstPass = true;
-    if (previousState != currentState || firstPass) {
-        firstPass = false;                // previousState will be defined, firstPass is false.
-        previousState = currentState; 
-        switch(currentState){ //State Update
-            case plane_init_st:
-                printf(PLANE_INIT_MSG);
-                break;
-            case plane_move_st:
-                printf(PLANE_MOVE_MSG);
-                break;
-            case plane_dead_st:
-                printf(PLANE_DEAD_MSG);
-                break;
-            default:
-                break;
-        }
-    }
+//Called by respawn_timer once the plane has been dead for reset_us
+static void plane_respawn(void *context){
+    respawn_due = true;
 }
 
+//Erases the plane and waits reset_us of game time before the next one
+static void plane_die(){
+    drawPlane(true); //Erase plane
+    setState(plane_dead_st);
+    swtimer_start(&respawn_timer, swtimer_game_e, reset_us, 0, plane_respawn, NULL);
+}
 
 // State machine tick function
-void plane_tick(){
-    if(DEBUG_FLAG){
-        plane_debug_tick();
-    }
+void plane_tick(uint32_t elapsed_us){
     switch(currentState){ //State Update
         case plane_init_st:
             missile_launch_x = rand() % SCREEN_WIDTH;
-            if(DEBUG_FLAG){
-                printf("%d is the firing point for the missile\n", missile_launch_x);
-            }
             sound_ufo();
-            currentState = plane_move_st;
+            setState(plane_move_st);
             break;
         case plane_move_st: //Keeping these two conditions separate for scoring purposes
             if(isExploded){ //if there isnt a collision
-                drawPlane(true); //Erase plane
-                currentState = plane_dead_st;
+                plane_die();
                 break;
             }
             if(planeGetPercentage() > 1.25){//if we haven't reached the destination
-                drawPlane(true); //Erase plane
-                currentState = plane_dead_st;
+                plane_die();
                 break;
             }
             if((x_current <= missile_launch_x) && !missile_launched){ //If we haven't launched yet and we're at the right spot to
-                if(DEBUG_FLAG){
-                    printf("Launching missile now!\n");
-                }
                 missile_init_plane(missile, x_current, y_current); //Launch off the missile
                 missile_launched = true;
                 break;
             }
             break;
         case plane_dead_st:
-            if(resetPlaneTicks >= resetTicks){ //Reset all the stats for dead planes
-                resetPlaneTicks = 0;
-                currentState = plane_init_st;
+            if(respawn_due){ //Reset all the stats for dead planes
+                respawn_due = false;
+                setState(plane_init_st);
                 length = 0; //Reset Plane Specs
                 x_current = x_origin;
                 y_origin = (rand()%100);
                 y_current = y_origin;
                 isExploded = false;
                 missile_launched = false;
-                resetTicks = ((rand()%10)+5)/CONFIG_GAME_TIMER_PERIOD; //Random respawn time
+                reset_us = difficulty_get()->ufo_respawn_min_us; //Random respawn time
+                if(difficulty_get()->ufo_respawn_range_s){ //A range of 0 respawns after exactly the minimum
+                    reset_us += (rand()%difficulty_get()->ufo_respawn_range_s)*CONFIG_MICROSECONDS_PER_SECOND;
+                }
             }
             break;
         default:
@@ -198,12 +192,11 @@ void plane_tick(){
             break;
         case plane_move_st:
             drawPlane(true); //Erase plane
-            planeUpdateLength(); //Updates flight progress
+            planeUpdateLength(elapsed_us); //Updates flight progress
             planeUpdateLocation(); //Update Location of plane
             drawPlane(false);
             break;
         case plane_dead_st:
-            resetPlaneTicks = resetPlaneTicks + 1; //Increment Ticks Each Pass
             break;
         default:
             break;
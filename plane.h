@@ -10,7 +10,8 @@
 void plane_init(missile_t *plane_missile);
 
 // State machine tick function
-void plane_tick();
+// elapsed_us is the game time, in microseconds, since the last tick
+void plane_tick(uint32_t elapsed_us);
 
 // Trigger the plane to expode
 void plane_explode();
@@ -18,4 +19,7 @@ void plane_explode();
 // Get the XY location of the plane
 display_point_t plane_getXY();
 
+// Return whether the plane is currently flying across the screen
+bool plane_isFlying();
+
 #endif /* PLANE */
@@ -7,14 +7,16 @@
 #include <math.h>
 #include <stdlib.h>
 #include "sound.h"
+#include "swtimer.h"
+#include "trace.h"
+#include "quality.h"
 
 #define SCREEN_WIDTH 320 //Display Width
 #define PLANE_HEIGHT 70 //Height of plane
 
-#define DEBUG_FLAG true
-
-#define TEN_SECONDS 10
-#define TWO_SECONDS 2
+#define TEN_SECONDS_US 10000000
+#define TWO_SECONDS_US 2000000
+#define EXPLODED_HEAD_START_US 2250000 //Exploded powerups come back sooner
 
 #define PLANE_TRIANGLE_LENGTH 20
 #define HALF_PLANE_TRIANGLE_LENGTH 10
@@ -23,10 +25,6 @@
 #define UFO_TOP_RADIUS 2
 
 
-#define PLANE_INIT_MSG "In Plane Init State \n"
-#define PLANE_MOVE_MSG "In Plane Move State \n"
-#define PLANE_DEAD_MSG "In Plane Dead State \n"
-
 //States
 enum powerup_st {
     powerup_init_st, //Init_st
@@ -34,15 +32,22 @@ enum powerup_st {
     powerup_dead_st, //Dead
 };
 
-static int32_t resetTicks = 0; //Counts to ticks we need to reset
-static int32_t resetPowerupTicks = 0; //Counts up to the number of ticks it needs to reset
+static uint32_t reset_us = 0; //Game time we need to stay dead before resetting
+static swtimer_t respawn_timer; //Runs on game time while the powerup is dead
+static bool respawn_due = false; //Set by respawn_timer once the powerup can come back
 
-static int32_t moveTicks = 0; //Counts to ticks we need to move powerup
-static int32_t movePowerupTicks = 0;
+static uint32_t move_us = 0; //Game time the powerup stays on screen
+static uint32_t alive_us = 0; //Counts up the game time spent on screen
 
 // Current state 
 static int32_t currentState;
 
+//Change state, recording the change in the trace
+static void setState(enum powerup_st state){
+    TRACE(trace_powerup_e, 0, currentState, state);
+    currentState = state;
+}
+
 // Starting x,y of place
 static uint16_t x_origin = SCREEN_WIDTH;
 static uint16_t y_origin = PLANE_HEIGHT;
@@ -63,13 +68,15 @@ int16_t random_y() {
 // Initialize the plane state machine
 
 void powerup_init(){
-    currentState = powerup_init_st;
+    setState(powerup_init_st);
+    isExploded = false;
     x_current = random_x();
     y_current = random_y();
-    resetPowerupTicks = 0;
-    resetTicks = TEN_SECONDS/CONFIG_GAME_TIMER_PERIOD;
-    movePowerupTicks = 0;
-    moveTicks = TWO_SECONDS/CONFIG_GAME_TIMER_PERIOD;
+    swtimer_stop(&respawn_timer);
+    respawn_due = false;
+    reset_us = TEN_SECONDS_US;
+    alive_us = 0;
+    move_us = TWO_SECONDS_US;
 }
 
 // Trigger the plane to expode
@@ -85,6 +92,11 @@ display_point_t powerup_getXY(){
     return newDisplayPoint;
 }
 
+//Returns whether the powerup is on screen
+bool powerup_isMoving(){
+    return (currentState == powerup_move_st);
+}
+
 //Draws and Erases the Powerup
 void drawPowerup(bool erase){
     if(erase){
@@ -97,33 +109,42 @@ void drawPowerup(bool erase){
     }
 }
 
+//Called by respawn_timer once the powerup has been dead long enough
+static void powerup_respawn(void *context){
+    respawn_due = true;
+}
+
+//Erases the powerup and waits dead_us less than reset_us of game time before the next one
+static void powerup_die(uint32_t dead_us){
+    drawPowerup(true); //Erase plane
+    setState(powerup_dead_st);
+    swtimer_start(&respawn_timer, swtimer_game_e, reset_us - dead_us, 0, powerup_respawn, NULL);
+}
+
 // State machine tick function
-void powerup_tick(){
+void powerup_tick(uint32_t elapsed_us){
     switch(currentState){ //State Update
         case powerup_init_st:
-            currentState = powerup_move_st;
+            setState(powerup_move_st);
             break;
         case powerup_move_st: //Keeping these two conditions separate for scoring purposes
             if(isExploded){ //if there is a collision
-                drawPowerup(true); //Erase plane
+                powerup_die(EXPLODED_HEAD_START_US);
                 sound_powerup();
-                resetPowerupTicks = 50;
-                currentState = powerup_dead_st;
                 break;
             }
-            if(movePowerupTicks > moveTicks){//if we haven't reached the destination
-                drawPowerup(true); //Erase plane
-                currentState = powerup_dead_st;
+            if(alive_us > move_us){//if we haven't reached the destination
+                powerup_die(0);
                 break;
             }
             break;
         case powerup_dead_st:
             x_current = 400;
             y_current = 400;
-            if(resetPowerupTicks >= resetTicks){ //Reset all the stats for dead planes
-                resetPowerupTicks = 0;
-                movePowerupTicks = 0;
-                currentState = powerup_init_st;
+            if(respawn_due){ //Reset all the stats for dead planes
+                respawn_due = false;
+                alive_us = 0;
+                setState(powerup_init_st);
                 x_current = random_x();
                 y_current = random_y();
                 isExploded = false;            
@@ -137,12 +158,17 @@ void powerup_tick(){
         case powerup_init_st:
             break;
         case powerup_move_st:
-            drawPowerup(true); //Erase plane
-            drawPowerup(false);
-            movePowerupTicks = movePowerupTicks + 1;
+            if(quality_isShed(quality_powerupColor_e) && alive_us > 0){ //Keep the colors on screen, but draw the same random numbers
+                rand();
+                rand();
+            }
+            else{
+                drawPowerup(true); //Erase plane
+                drawPowerup(false);
+            }
+            alive_us = alive_us + elapsed_us;
             break;
         case powerup_dead_st:
-            resetPowerupTicks = resetPowerupTicks + 1; //Increment Ticks Each Pass
             break;
         default:
             break;
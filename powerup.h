@@ -10,7 +10,8 @@
 void powerup_init();
 
 // State machine tick function
-void powerup_tick();
+// elapsed_us is the game time, in microseconds, since the last tick
+void powerup_tick(uint32_t elapsed_us);
 
 // Trigger the plane to expode
 void powerup_explode();
@@ -18,4 +19,7 @@ void powerup_explode();
 // Get the XY location of the plane
 display_point_t powerup_getXY();
 
+// Return whether the powerup is currently on screen
+bool powerup_isMoving();
+
 #endif /* PLANE */
@@ -0,0 +1,75 @@
+#include <stdio.h>
+
+#include "profile.h"
+
+#define PROFILE_MICROSECONDS_PER_SECOND 1000000
+
+static profile_stats_t profile_stats[profile_sectionCount_e];
+
+static const char *const profile_names[profile_sectionCount_e] = {
+    [profile_gameTick_e] = "gameTick",
+    [profile_missiles_e] = "missiles",
+    [profile_plane_e] = "plane",
+    [profile_powerup_e] = "powerup",
+    [profile_autopilot_e] = "autopilot",
+    [profile_touch_e] = "touch",
+    [profile_collision_e] = "collision",
+    [profile_statsErase_e] = "statsErase",
+    [profile_statsDraw_e] = "statsDraw",
+    [profile_sound_e] = "sound",
+};
+
+// Histogram bucket of a time.
+static uint32_t profile_bucket(uint32_t us) {
+  uint32_t bucket = 0;
+  while (us && bucket < PROFILE_BUCKET_COUNT - 1) {
+    us >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+// Records the time from start, a PROFILE_START() value, until now against
+// section.
+void profile_record(profile_section_t section, uint32_t start) {
+  uint32_t counts = profile_hal_now() - start;
+  uint32_t us = (uint64_t)counts * PROFILE_MICROSECONDS_PER_SECOND /
+                profile_hal_countsPerSecond();
+  profile_stats_t *stats = &profile_stats[section];
+  if (stats->calls == 0 || us < stats->min_us)
+    stats->min_us = us;
+  if (us > stats->max_us)
+    stats->max_us = us;
+  stats->calls++;
+  stats->total_us += us;
+  stats->histogram[profile_bucket(us)]++;
+}
+
+// Returns the statistics of one section.
+profile_stats_t profile_getStats(profile_section_t section) {
+  return profile_stats[section];
+}
+
+// Clears every section.
+void profile_reset() {
+  for (uint32_t i = 0; i < profile_sectionCount_e; i++)
+    profile_stats[i] = (profile_stats_t){0};
+}
+
+// Prints a table of every section that ran.
+void profile_print() {
+  printf("%-10s %8s %8s %8s %8s  histogram, <1 us then up to 2^i us\n",
+         "section", "calls", "min_us", "mean_us", "max_us");
+  for (uint32_t i = 0; i < profile_sectionCount_e; i++) {
+    const profile_stats_t *stats = &profile_stats[i];
+    if (stats->calls == 0)
+      continue;
+    printf("%-10s %8lu %8lu %8lu %8lu ", profile_names[i],
+           (unsigned long)stats->calls, (unsigned long)stats->min_us,
+           (unsigned long)(stats->total_us / stats->calls),
+           (unsigned long)stats->max_us);
+    for (uint32_t b = 0; b < PROFILE_BUCKET_COUNT; b++)
+      printf(" %lu", (unsigned long)stats->histogram[b]);
+    printf("\n");
+  }
+}
@@ -0,0 +1,75 @@
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+// Times sections of the game loop and keeps the minimum, mean and maximum of
+// each, plus a histogram with power-of-two microsecond buckets. Time comes
+// from a free-running counter: the Cortex-A9 global timer on the board
+// (profile_xilinx.c), CLOCK_MONOTONIC on the host (host/profile_host.c).
+//
+// Wrap a section like this; with CONFIG_PROFILE_ENABLED false it compiles to
+// nothing:
+//   uint32_t start = PROFILE_START();
+//   plane_tick(elapsed_us);
+//   PROFILE_RECORD(profile_plane_e, start);
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "config.h"
+
+typedef enum {
+  profile_gameTick_e,  // All of gameControl_tick().
+  profile_missiles_e,  // missile_tick() for the half ticked this time.
+  profile_plane_e,     // plane_tick().
+  profile_powerup_e,   // powerup_tick().
+  profile_autopilot_e, // autopilot_tick().
+  profile_touch_e,     // Reading the touchscreen and launching a missile.
+  profile_collision_e, // Missile, plane and powerup collisions.
+  profile_statsErase_e, // Erasing the stats before the tick moves things.
+  profile_statsDraw_e,  // Drawing the stats at the end of the tick.
+  profile_sound_e,     // sound_tick() in the main loop.
+  profile_sectionCount_e
+} profile_section_t;
+
+// Bucket i of the histogram counts times below 2^i us, above the bucket
+// before it. The last bucket counts everything longer.
+#define PROFILE_BUCKET_COUNT 18
+
+typedef struct {
+  uint32_t calls;
+  uint32_t min_us;
+  uint32_t max_us;
+  uint64_t total_us;
+  uint32_t histogram[PROFILE_BUCKET_COUNT];
+} profile_stats_t;
+
+#if CONFIG_PROFILE_ENABLED
+#define PROFILE_START() profile_hal_now()
+#define PROFILE_RECORD(section, start) profile_record(section, start)
+#else
+#define PROFILE_START() 0
+#define PROFILE_RECORD(section, start) ((void)(start))
+#endif
+
+// Records the time from start, a PROFILE_START() value, until now against
+// section.
+void profile_record(profile_section_t section, uint32_t start);
+
+// Returns the statistics of one section.
+profile_stats_t profile_getStats(profile_section_t section);
+
+// Clears every section.
+void profile_reset();
+
+// Prints a table of every section that ran.
+void profile_print();
+
+// Implemented by the platform.
+
+// The counter, which may wrap.
+uint32_t profile_hal_now();
+
+// How fast the counter counts.
+uint32_t profile_hal_countsPerSecond();
+
+#endif /* PROFILE_H_ */
@@ -0,0 +1,13 @@
+#include "profile.h"
+#include "xtime_l.h"
+
+// The low half of the Cortex-A9 global timer. The SCU private timer would
+// count at the same rate, but TimerDelay() stops and reloads it.
+uint32_t profile_hal_now() {
+  XTime now;
+  XTime_GetTime(&now);
+  return (uint32_t)now;
+}
+
+// How fast the counter counts.
+uint32_t profile_hal_countsPerSecond() { return COUNTS_PER_SECOND; }
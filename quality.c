@@ -0,0 +1,74 @@
+#include "config.h"
+#include "profile.h"
+#include "quality.h"
+#include "trace.h"
+
+#define QUALITY_MICROSECONDS_PER_SECOND 1000000
+#define QUALITY_PERCENT 100
+
+
+static uint32_t quality_budgetUs;
+static uint32_t quality_tickStart;
+static uint32_t quality_ticks;     // Ticks ended since quality_init().
+static uint32_t quality_fastTicks; // Fast ticks in a row.
+static quality_stats_t quality_stats;
+
+// Restores full quality and measures ticks against budget_us, normally the
+// game timer period.
+void quality_init(uint32_t budget_us) {
+  quality_budgetUs = budget_us;
+  quality_ticks = 0;
+  quality_fastTicks = 0;
+  quality_stats = (quality_stats_t){0};
+}
+
+// Changes the budget ticks are measured against.
+void quality_setBudget(uint32_t budget_us) { quality_budgetUs = budget_us; }
+
+// Call at the start of a tick.
+void quality_startTick() { quality_tickStart = profile_hal_now(); }
+
+// Call at the end of a tick. Sheds or restores an item if the tick was slow
+// or ticks have been fast for long enough.
+void quality_endTick() {
+  uint32_t counts = profile_hal_now() - quality_tickStart;
+  uint32_t us = (uint64_t)counts * QUALITY_MICROSECONDS_PER_SECOND /
+                profile_hal_countsPerSecond();
+  quality_stats.last_tick_us = us;
+  quality_ticks++;
+
+  uint64_t percent = (uint64_t)us * QUALITY_PERCENT;
+  if (percent > (uint64_t)quality_budgetUs * CONFIG_QUALITY_SHED_PERCENT) {
+    quality_fastTicks = 0;
+    if (quality_stats.level < quality_itemCount_e) {
+      TRACE(trace_quality_e, 0, quality_stats.level, quality_stats.level + 1);
+      quality_stats.level++;
+      quality_stats.sheds++;
+    }
+  } else if (percent <
+             (uint64_t)quality_budgetUs * CONFIG_QUALITY_RESTORE_PERCENT) {
+    // Restore only after a run of fast ticks, so quality doesn't flap when
+    // ticks hover around the budget.
+    if (quality_stats.level > 0 &&
+        ++quality_fastTicks >= CONFIG_QUALITY_RESTORE_TICKS) {
+      quality_fastTicks = 0;
+      TRACE(trace_quality_e, 0, quality_stats.level, quality_stats.level - 1);
+      quality_stats.level--;
+      quality_stats.restores++;
+    }
+  } else {
+    quality_fastTicks = 0;
+  }
+}
+
+// Returns true if item is shed.
+bool quality_isShed(quality_item_t item) { return item < quality_stats.level; }
+
+// Returns true if the stats should be redrawn this tick.
+bool quality_hudDue() {
+  return !quality_isShed(quality_hud_e) ||
+         quality_ticks % CONFIG_QUALITY_HUD_INTERVAL == 0;
+}
+
+// Returns the current level and the counters.
+quality_stats_t quality_getStats() { return quality_stats; }
@@ -0,0 +1,53 @@
+#ifndef QUALITY_H_
+#define QUALITY_H_
+
+// Sheds optional drawing when game ticks run long, and brings it back when
+// there is headroom again. Only drawing is shed: positions, collisions and
+// the order of rand() calls are the same at every level, so the game plays
+// out exactly as it would at full quality.
+//
+// Items are shed in the order of quality_item_t, one per slow tick, and
+// restored in reverse once ticks have been fast for a while. Every change of
+// level is recorded in the trace, see trace.h.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+  quality_hud_e,          // Redraw the stats only every few ticks.
+  quality_powerupColor_e, // Stop redrawing the powerup in new random colors.
+  quality_trails_e,       // Redraw each missile trail every other tick.
+  quality_itemCount_e
+} quality_item_t;
+
+typedef struct {
+  uint32_t level;        // Items shed right now, from the start of the list.
+  uint32_t sheds;        // Times an item was shed.
+  uint32_t restores;     // Times an item was restored.
+  uint32_t last_tick_us; // Length of the last tick.
+} quality_stats_t;
+
+// Restores full quality and measures ticks against budget_us, normally the
+// game timer period.
+void quality_init(uint32_t budget_us);
+
+// Changes the budget ticks are measured against.
+void quality_setBudget(uint32_t budget_us);
+
+// Call at the start of a tick.
+void quality_startTick();
+
+// Call at the end of a tick. Sheds or restores an item if the tick was slow
+// or ticks have been fast for long enough.
+void quality_endTick();
+
+// Returns true if item is shed.
+bool quality_isShed(quality_item_t item);
+
+// Returns true if the stats should be redrawn this tick.
+bool quality_hudDue();
+
+// Returns the current level and the counters.
+quality_stats_t quality_getStats();
+
+#endif /* QUALITY_H_ */
@@ -0,0 +1,99 @@
+#include <stdio.h>
+
+#include "config.h"
+#include "intervalTimer.h"
+#include "quality.h"
+#include "rate.h"
+#include "tick.h"
+#include "touchscreen.h"
+
+static const uint32_t rate_choicesHz[] = CONFIG_GAME_TICK_RATES_HZ;
+#define RATE_CHOICE_COUNT (sizeof(rate_choicesHz) / sizeof(rate_choicesHz[0]))
+
+static rate_periods_t rate_periods;
+
+// Periods for a game timer period.
+static rate_periods_t rate_derive(uint32_t game_period_us) {
+  rate_periods_t periods = {
+      .game_period_us = game_period_us,
+      .touch_period_us = CONFIG_TOUCHSCREEN_TIMER_PERIOD_US,
+  };
+  if (game_period_us < periods.touch_period_us)
+    periods.touch_period_us = game_period_us;
+  return periods;
+}
+
+// The timer and touchscreen drivers take periods in seconds.
+static double rate_seconds(uint32_t us) {
+  return (double)us / CONFIG_MICROSECONDS_PER_SECOND;
+}
+
+// Restarts the game and touchscreen timers with new periods. The
+// touchscreen driver counts its debounce delay in timer periods, so it is
+// set up again for the new one.
+static void rate_restartTimers(rate_periods_t periods) {
+  intervalTimer_stop(INTERVAL_TIMER_0);
+  intervalTimer_stop(INTERVAL_TIMER_1);
+  touchscreen_init(rate_seconds(periods.touch_period_us));
+  intervalTimer_initCountDown(INTERVAL_TIMER_0,
+                              rate_seconds(periods.game_period_us));
+  intervalTimer_initCountDown(INTERVAL_TIMER_1,
+                              rate_seconds(periods.touch_period_us));
+  intervalTimer_enableInterrupt(INTERVAL_TIMER_0);
+  intervalTimer_enableInterrupt(INTERVAL_TIMER_1);
+  intervalTimer_start(INTERVAL_TIMER_0);
+  intervalTimer_start(INTERVAL_TIMER_1);
+}
+
+// Sets the starting game timer period without touching the timers, which
+// are started afterwards from rate_getPeriods().
+void rate_init(uint32_t game_period_us) {
+  rate_periods = rate_derive(game_period_us);
+}
+
+// Changes the game timer period while the game is running. Returns false and
+// changes nothing if the period is out of range.
+bool rate_setPeriod(uint32_t game_period_us) {
+  if (game_period_us < CONFIG_GAME_TIMER_MIN_PERIOD_US ||
+      game_period_us > CONFIG_GAME_TIMER_MAX_PERIOD_US)
+    return false;
+  rate_periods = rate_derive(game_period_us);
+  rate_restartTimers(rate_periods);
+  tick_setPeriod(game_period_us);
+  quality_setBudget(game_period_us);
+  printf("rate: game tick every %lu us (%lu Hz), touchscreen every %lu us\n",
+         (unsigned long)rate_periods.game_period_us,
+         (unsigned long)rate_getHz(),
+         (unsigned long)rate_periods.touch_period_us);
+  return true;
+}
+
+// Changes the game tick rate while the game is running.
+bool rate_setHz(uint32_t hz) {
+  if (hz == 0)
+    return false;
+  return rate_setPeriod(CONFIG_MICROSECONDS_PER_SECOND / hz);
+}
+
+// Switches to the next rate in CONFIG_GAME_TICK_RATES_HZ and returns it.
+uint32_t rate_next() {
+  uint32_t hz = rate_getHz();
+  uint32_t next = rate_choicesHz[0];
+  for (uint32_t i = 0; i < RATE_CHOICE_COUNT; i++) {
+    if (rate_choicesHz[i] > hz) {
+      next = rate_choicesHz[i];
+      break;
+    }
+  }
+  rate_setHz(next);
+  return rate_getHz();
+}
+
+// Returns the current periods.
+rate_periods_t rate_getPeriods() { return rate_periods; }
+
+// Returns the game tick rate, rounded to the nearest Hz.
+uint32_t rate_getHz() {
+  return (CONFIG_MICROSECONDS_PER_SECOND + rate_periods.game_period_us / 2) /
+         rate_periods.game_period_us;
+}
@@ -0,0 +1,40 @@
+#ifndef RATE_H_
+#define RATE_H_
+
+// The game tick rate, chosen at runtime. Everything in the game moves by
+// elapsed game time in microseconds (see config.h), so a new rate only needs
+// new timer periods and new budgets measured against them: the game timer,
+// the touchscreen timer, the period tick_run() gives each tick and the budget
+// quality.h sheds drawing against. The touchscreen timer runs at its
+// configured period, or as fast as the game timer when that is faster, so
+// every tick sees a fresh touch.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+  uint32_t game_period_us;  // Game timer period.
+  uint32_t touch_period_us; // Touchscreen timer period.
+} rate_periods_t;
+
+// Sets the starting game timer period without touching the timers, which
+// are started afterwards from rate_getPeriods().
+void rate_init(uint32_t game_period_us);
+
+// Changes the game timer period while the game is running. Returns false and
+// changes nothing if the period is out of range.
+bool rate_setPeriod(uint32_t game_period_us);
+
+// Changes the game tick rate while the game is running.
+bool rate_setHz(uint32_t hz);
+
+// Switches to the next rate in CONFIG_GAME_TICK_RATES_HZ and returns it.
+uint32_t rate_next();
+
+// Returns the current periods.
+rate_periods_t rate_getPeriods();
+
+// Returns the game tick rate, rounded to the nearest Hz.
+uint32_t rate_getHz();
+
+#endif /* RATE_H_ */
@@ -9,61 +9,17 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #include <stdio.h>
 
+#include "adpcm.h"
+#include "audio_hal.h"
 #include "sound.h"
-#include "sounds/bcfire01_48k.wav.h"
-#include "sounds/gameBoyStartup.wav.h"
-#include "sounds/gameOver48k.wav.h"
-#include "sounds/gunEmpty48k.wav.h"
-#include "sounds/johnCena.wav.h"
-#include "sounds/missionFailed.wav.h"
-#include "sounds/ouch48k.wav.h"
-#include "sounds/pacmanDeath.wav.h"
-#include "sounds/powerUp48k.wav.h"
-#include "sounds/robloxOof.wav.h"
-#include "sounds/screamAndDie48k.wav.h"
-#include "timer_ps.h"
-#include "xiicps.h"
-#include "xil_io.h"
-#include "xil_printf.h"
-#include "xil_types.h"
-#include "xparameters.h"
-
-/***************************************************************
- * Quite a bit of this code was obtained from digilent.com
- * so it does not necessarily meet the coding standard.
- ****************************************************************/
-
-/* I2S Register offsets */
-#define I2S_RESET_REG 0x00
-#define I2S_CTRL_REG 0x04
-#define I2S_CLK_CTRL_REG 0x08
-#define I2S_FIFO_STS_REG 0x20
-#define I2S_RX_FIFO_REG 0x28
-#define I2S_TX_FIFO_REG 0x2C
-
-/* IIC address of the SSM2603 device and the desired IIC clock speed */
-#define IIC_SLAVE_ADDR 0b0011010
-#define IIC_SCLK_RATE 100000
-
-/* Redefine the XPAR constants */
-#define IIC_DEVICE_ID XPAR_XIICPS_0_DEVICE_ID
-#define I2S_ADDRESS XPAR_AXI_I2S_ADI_0_BASEADDR
-#define TIMER_DEVICE_ID XPAR_SCUTIMER_DEVICE_ID
-#define AUDIO_IIC_ID XPAR_XIICPS_0_DEVICE_ID
-#define AUDIO_CTRL_BASEADDR 0x43C20000
-#define SCU_TIMER_ID XPAR_SCUTIMER_DEVICE_ID
-#define UART_BASEADDR XPAR_PS7_UART_1_BASEADDR
+#include "sounds/sound_asset_ids.h"
+#include "sounds/sound_assets.h"
+#include "swtimer.h"
+#include "synth.h"
+#include "trace.h"
 
 #define SOUND_MULTIPLIER INT16_MAX / 3 // Primitive volume control.
 
-#define NO_SOUND 0 // A zero generates no sound.
-#define ONE_SECOND_OF_SOUND_ARRAY_SIZE                                         \
-  48000 // The sample rate is 48k so that is 1 second's worth.
-uint16_t soundOfSilence[ONE_SECOND_OF_SOUND_ARRAY_SIZE];
-
-// Declared below the sound state-machine code.
-static int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr);
-
 /****************************************************************
  *                 sound state machine code                     *
  ****************************************************************/
@@ -72,19 +28,101 @@ volatile static bool sound_initFlag = false;
 
 // True if a sound should be played, false otherwise.
 // Note that the state-machine sets this back to false once it has completed
-// playing a sound.
+// playing every voice.
 volatile static bool sound_playSoundFlag = false;
 
-// Keep track of the base pointer to the sound array with current sample-rate
-// and sample count.
-volatile static uint16_t *sound_array; // Base pointer to the sound array.
-
-// static uint32_t sound_sampleRate;  // Sample rate for this sound.
-volatile static uint32_t sound_sampleCount; // Number of samples in this sound.
+// How the samples in a sound array are stored.
+typedef enum {
+  sound_pcm_e,   // 16-bit offset-binary samples.
+  sound_adpcm_e, // IMA-ADPCM blocks, decoded while playing.
+  sound_synth_e  // A synth_script_t, rendered while playing.
+} sound_format_t;
+
+// Where each sound_sounds_t comes from. Recordings live in the sound blob,
+// whose index holds their data pointer, sample count, rate and format; the
+// short effects are synthesized from a note script.
+typedef struct {
+  const synth_script_t *script; // Note script, NULL for a recording.
+  uint8_t asset;                // SOUND_ASSET_* id of a recording.
+  uint16_t gain;                // Gain used by sound_startSound().
+} sound_registry_t;
+
+// Every sound, indexed by sound_sounds_t. Defined below the sound data.
+#define SOUND_COUNT (sound_missionFailed_e + 1)
+static const sound_registry_t sound_registry[SOUND_COUNT];
+
+// The sound selected by sound_setSound(), NULL if there is none.
+// sound_startSound() plays it on a voice.
+static const sound_registry_t *sound_selected;
+
+// How sounds at other rates are converted to the CODEC rate.
+volatile static sound_resample_t sound_resampleQuality =
+    sound_linearResample_e;
 
 // Keep track of the current volume setting.
 volatile static sound_volume_t sound_currentVolume = sound_minimumVolume_e;
 
+#define SOUND_SAMPLE_OFFSET INT16_MAX // Sound arrays are offset-binary.
+#define SOUND_GAIN_SHIFT 15           // Gains are fixed point, 1.0 = 1 << 15.
+#define SOUND_MIX_BLOCK_SIZE 64       // Samples mixed at a time.
+#define SOUND_READ_AHEAD_SIZE 32      // Samples a resampled voice reads ahead.
+#define SOUND_BUFFER_SIZE 1024        // Samples per ping-pong buffer, ~21 ms.
+#define SOUND_OUTPUT_RATE 48000       // Sample rate of the CODEC.
+#define SOUND_PHASE_SHIFT 16          // Resampling phase is 16.16 fixed point.
+#define SOUND_PHASE_ONE (1 << SOUND_PHASE_SHIFT) // One input sample.
+
+// One sound being mixed into the output.
+typedef struct {
+  const void *samples;     // Sound array.
+  union {
+    adpcm_decoder_t decoder; // Decoder state for IMA-ADPCM arrays.
+    synth_t synth;           // Synthesizer state for scripts.
+  };
+  uint32_t count;          // Number of samples in the array.
+  uint32_t position;       // Next sample to mix.
+  uint16_t gain;           // Scale applied before mixing.
+  uint8_t format;          // sound_format_t of the sound array.
+  bool loop;               // Start over at the end instead of stopping.
+  bool active;             // True while the voice is playing.
+  uint32_t started;        // sound_voiceStarts when the voice was started.
+  // Resampling state, used when the sound is not at SOUND_OUTPUT_RATE. The
+  // output lies phase of the way from current to next.
+  uint32_t step;    // Input samples per output sample, 16.16 fixed point.
+  uint32_t phase;   // Position between current and next, 16.16 fixed point.
+  int32_t current;  // Input sample at or before the output position.
+  int32_t next;     // Input sample after current.
+  uint16_t input[SOUND_READ_AHEAD_SIZE]; // Input samples read ahead.
+  uint16_t inputIndex;                   // Next sample of input to use.
+  uint16_t inputLength;                  // Samples held in input.
+} sound_voice_t;
+
+static sound_voice_t sound_voices[SOUND_VOICE_COUNT];
+
+// Voices started so far. The difference from a voice's started is how many
+// voices have started since, which orders them even after it wraps.
+static uint32_t sound_voiceStarts;
+
+// Sum of the voices in the block being mixed.
+static int32_t sound_mixBuffer[SOUND_MIX_BLOCK_SIZE];
+
+// Mixed FIFO words are double buffered. sound_isr() writes the front buffer to
+// the FIFO while sound_tick() mixes the next one into the back buffer, then
+// the two swap. Only sound_isr() changes sound_front and sound_frontIndex, and
+// only while sound_backReady is set.
+static uint32_t sound_buffers[2][SOUND_BUFFER_SIZE];
+volatile static uint8_t sound_front = 0;         // Buffer being played.
+volatile static uint32_t sound_frontIndex = 0;   // Next word of the front.
+volatile static uint32_t sound_frontLength = 0;  // Words in the front buffer.
+volatile static uint32_t sound_backLength = 0;   // Words in the back buffer.
+volatile static bool sound_backReady = false;    // Back buffer has been mixed.
+
+// True if a periodic interrupt calls sound_isr(), otherwise sound_tick() feeds
+// the FIFO itself.
+static bool sound_interruptDriven = false;
+
+// Decoded samples of the voice being mixed.
+static uint16_t sound_decodeBuffer[SOUND_MIX_BLOCK_SIZE];
+
 // Sound state-machine states.
 typedef enum {
   sound_init_st, // Waiting for sound_init() to be invoked.
@@ -94,75 +132,196 @@ typedef enum {
 
 volatile static sound_st_t currentState = sound_init_st;
 
-// Reset the TX FIFO.
-static void sound_resetTxFifo() {
-  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_RESET_REG, 0b010); // Reset TX Fifo
+// Must be called before using the sound state machine.
+sound_status_t sound_init() {
+  // Setup the audio CODEC.
+  audio_hal_init();
+  sound_initFlag = true;
+  sound_setVolume(sound_minimumVolume_e); // Init the volume level.
+  return SOUND_STATUS_OK;
 }
 
-// Enable the TX FIFO.
-static void sound_enableTxFifo() {
-  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_CTRL_REG,
-            0b001); // Enable TX Fifo, disable mute
+// Changes state, recording the change in the trace.
+static void sound_setState(sound_st_t state) {
+  TRACE(trace_sound_e, 0, currentState, state);
+  currentState = state;
 }
 
-// Disables the TX FIFO.
-static void sound_disableTxFifo() {
-  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_CTRL_REG, 0b00); // Disable TX FIFO.
+// Adds length samples of one voice into the mix. This is kept to a plain loop
+// over contiguous arrays so the compiler vectorizes it.
+static void sound_mixSamples(int32_t *restrict mix,
+                             const uint16_t *restrict samples, uint32_t length,
+                             int32_t gain) {
+  for (uint32_t i = 0; i < length; i++)
+    mix[i] += (((int32_t)samples[i] - SOUND_SAMPLE_OFFSET) * gain) >>
+              SOUND_GAIN_SHIFT;
 }
 
-// sampleValue is sent to both the left and right channels.
-static void sound_sendDataToBothChannels(uint32_t sampleValue) {
-  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_TX_FIFO_REG,
-            sampleValue); // add to left Channel.
-  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_TX_FIFO_REG,
-            sampleValue); // add to right Channel.
+// Starts a voice over from the first sample of its sound.
+static void sound_rewindVoice(sound_voice_t *voice) {
+  voice->position = 0;
+  if (voice->format == sound_adpcm_e)
+    adpcm_decoderStart(&voice->decoder, voice->samples, 0);
+  else if (voice->format == sound_synth_e)
+    synth_start(&voice->synth, voice->samples);
 }
 
-// Must be called before using the sound state machine.
-sound_status_t sound_init() {
-  // Setup the audio CODEC.
-  AudioInitialize(SCU_TIMER_ID, AUDIO_IIC_ID, AUDIO_CTRL_BASEADDR);
-  sound_initFlag = true;
-  // Initialize the silence array.
-  for (uint32_t i = 0; i < ONE_SECOND_OF_SOUND_ARRAY_SIZE; i++)
-    soundOfSilence[i] = NO_SOUND;
-  sound_setVolume(sound_minimumVolume_e); // Init the volume level.
-  return SOUND_STATUS_OK;
+// Reads the next input sample of a resampled voice, refilling its read-ahead
+// buffer as needed. Returns false at the end of a sound that does not loop.
+static bool sound_readSample(sound_voice_t *voice, int32_t *sample) {
+  if (voice->inputIndex == voice->inputLength) {
+    if (voice->position == voice->count) { // End of the sound.
+      if (!voice->loop)
+        return false;
+      sound_rewindVoice(voice);
+    }
+    uint32_t length = voice->count - voice->position;
+    if (length > SOUND_READ_AHEAD_SIZE)
+      length = SOUND_READ_AHEAD_SIZE;
+    if (voice->format == sound_adpcm_e) {
+      adpcm_decode(&voice->decoder, voice->input, length);
+    } else if (voice->format == sound_synth_e) {
+      synth_render(&voice->synth, voice->input, length);
+    } else {
+      const uint16_t *samples = (const uint16_t *)voice->samples;
+      for (uint32_t i = 0; i < length; i++)
+        voice->input[i] = samples[voice->position + i];
+    }
+    voice->position += length;
+    voice->inputIndex = 0;
+    voice->inputLength = length;
+  }
+  *sample = (int32_t)voice->input[voice->inputIndex++] - SOUND_SAMPLE_OFFSET;
+  return true;
 }
 
-// This is a debug state print routine. It will print the names of the states
-// each time tick() is called. It only prints states if they are different than
-// the previous state.
-static void debugStatePrint() {
-  static sound_st_t previousState;
-  static bool firstPass = true;
-  // Only print the message if:
-  // 1. This the first pass and the value for previousState is unknown.
-  // 2. previousState != currentState - this prevents reprinting the same state
-  // name over and over.
-  if (previousState != currentState || firstPass) {
-    firstPass = false; // previousState will be defined, firstPass is false.
-    previousState =
-        currentState;       // keep track of the last state that you were in.
-    switch (currentState) { // This prints messages based upon the state that
-                            // you were in.
-    case sound_init_st:
-      printf("sound_init_st\n");
-      break;
-    case sound_wait_st:
-      printf("sound_wait_st\n");
-      break;
-    case sound_play_st:
-      printf("sound_play_st\n");
-      break;
+// Converts the next length output samples of a voice whose sound is not at
+// SOUND_OUTPUT_RATE into out, offset-binary. Returns how many were written,
+// fewer than length if the sound ended.
+static uint32_t sound_resampleVoice(sound_voice_t *voice, uint16_t *out,
+                                    uint32_t length) {
+  bool linear = (sound_resampleQuality == sound_linearResample_e);
+  for (uint32_t i = 0; i < length; i++) {
+    while (voice->phase >= SOUND_PHASE_ONE) { // Move on to the next input.
+      voice->phase -= SOUND_PHASE_ONE;
+      voice->current = voice->next;
+      if (!sound_readSample(voice, &voice->next))
+        return i;
     }
+    int32_t sample = voice->current;
+    if (linear) // 17-bit difference times 15-bit phase fits in 32 bits.
+      sample += ((voice->next - voice->current) *
+                 (int32_t)(voice->phase >> 1)) >>
+                (SOUND_PHASE_SHIFT - 1);
+    out[i] = (uint16_t)(sample + SOUND_SAMPLE_OFFSET);
+    voice->phase += voice->step;
   }
+  return length;
 }
 
+// Mixes the next block of every active voice into out as FIFO words.
+// Returns false if no voice was active.
+static bool sound_mixBlock(uint32_t *out) {
+  bool anyActive = false;
+  for (uint32_t i = 0; i < SOUND_MIX_BLOCK_SIZE; i++)
+    sound_mixBuffer[i] = 0;
+  for (uint8_t v = 0; v < SOUND_VOICE_COUNT; v++) {
+    sound_voice_t *voice = &sound_voices[v];
+    uint32_t mixed = 0;
+    if (voice->active && voice->step != SOUND_PHASE_ONE) {
+      anyActive = true;
+      uint32_t length =
+          sound_resampleVoice(voice, sound_decodeBuffer, SOUND_MIX_BLOCK_SIZE);
+      sound_mixSamples(sound_mixBuffer, sound_decodeBuffer, length,
+                       voice->gain);
+      voice->active = (length == SOUND_MIX_BLOCK_SIZE);
+      continue;
+    }
+    // A voice may end or wrap around part way through the block.
+    while (voice->active && mixed < SOUND_MIX_BLOCK_SIZE) {
+      anyActive = true;
+      uint32_t length = voice->count - voice->position;
+      if (length > SOUND_MIX_BLOCK_SIZE - mixed)
+        length = SOUND_MIX_BLOCK_SIZE - mixed;
+      const uint16_t *samples;
+      if (voice->format == sound_adpcm_e) {
+        adpcm_decode(&voice->decoder, sound_decodeBuffer, length);
+        samples = sound_decodeBuffer;
+      } else if (voice->format == sound_synth_e) {
+        synth_render(&voice->synth, sound_decodeBuffer, length);
+        samples = sound_decodeBuffer;
+      } else {
+        samples = (const uint16_t *)voice->samples + voice->position;
+      }
+      sound_mixSamples(&sound_mixBuffer[mixed], samples, length, voice->gain);
+      mixed += length;
+      voice->position += length;
+      if (voice->position == voice->count) { // End of the sound.
+        voice->active = voice->loop;
+        sound_rewindVoice(voice);
+      }
+    }
+  }
+  if (!anyActive)
+    return false;
+  // Saturate the sum back into the sample range and scale by volume.
+  for (uint32_t i = 0; i < SOUND_MIX_BLOCK_SIZE; i++) {
+    int32_t sample = sound_mixBuffer[i];
+    if (sample > UINT16_MAX - SOUND_SAMPLE_OFFSET)
+      sample = UINT16_MAX - SOUND_SAMPLE_OFFSET;
+    else if (sample < -SOUND_SAMPLE_OFFSET)
+      sample = -SOUND_SAMPLE_OFFSET;
+    out[i] = (uint32_t)(sample + SOUND_SAMPLE_OFFSET) * sound_currentVolume;
+  }
+  return true;
+}
+
+// Mixes up to a buffer of samples into the back buffer and hands it to
+// sound_isr(). Returns false if no voice was active.
+static bool sound_mixBackBuffer() {
+  uint32_t *back = sound_buffers[sound_front ^ 1];
+  uint32_t length = 0;
+  while (length < SOUND_BUFFER_SIZE && sound_mixBlock(&back[length]))
+    length += SOUND_MIX_BLOCK_SIZE;
+  if (length == 0)
+    return false;
+  sound_backLength = length;
+  sound_backReady = true;
+  return true;
+}
+
+// Copies mixed samples into the FIFO until it is full or they run out. When
+// the front buffer is used up, the back buffer becomes the front.
+static void sound_feedFifo() {
+  while (!audio_hal_txFull()) { // while room in FIFO.
+    if (sound_frontIndex == sound_frontLength) {
+      if (!sound_backReady)
+        break; // sound_tick() has not mixed the next buffer yet.
+      sound_front ^= 1;
+      sound_frontIndex = 0;
+      sound_frontLength = sound_backLength;
+      sound_backReady = false;
+    }
+    // Send the sound data to the left and right channels.
+    audio_hal_write(sound_buffers[sound_front][sound_frontIndex]);
+    sound_frontIndex++;
+  }
+}
+
+// Copies mixed samples into the audio FIFO. Call from a periodic interrupt,
+// at least every CONFIG_AUDIO_TIMER_PERIOD, after
+// sound_setInterruptDriven(true).
+void sound_isr() {
+  if (currentState == sound_play_st)
+    sound_feedFifo();
+}
+
+// Selects who feeds the FIFO. With enable, sound_isr() must be called from a
+// periodic interrupt often enough that the FIFO never drains.
+void sound_setInterruptDriven(bool enable) { sound_interruptDriven = enable; }
+
 // Standard tick function.
 void sound_tick() {
-  //  debugStatePrint();
-  static uint32_t arrayIndex = 0;
   // Action switch statement.
   switch (currentState) {
   case sound_init_st:
@@ -178,44 +337,122 @@ void sound_tick() {
   // Transistion switch statement.
   switch (currentState) {
   case sound_init_st:
-    if (sound_initFlag) {
-      currentState = sound_wait_st;
+    // Carry on without sound if the CODEC could not be set up.
+    if (sound_initFlag && (audio_hal_isReady() || audio_hal_failed())) {
+      sound_setState(sound_wait_st);
     }
     break;
   case sound_wait_st:
-    if (sound_playSoundFlag) {
-      arrayIndex = 0;
-      currentState = sound_play_st;
-      sound_resetTxFifo();  // Reset the TX FIFO.
-      sound_enableTxFifo(); // Enable the TX FIFO, disable mute.
+    if (sound_playSoundFlag && audio_hal_failed()) {
+      sound_stopSound(); // Nothing can play, so every sound ends at once.
+    } else if (sound_playSoundFlag) {
+      sound_frontIndex = sound_frontLength = 0;
+      sound_backReady = false;
+      audio_hal_resetTx();      // Reset the TX FIFO.
+      audio_hal_enableTx(true); // Enable the TX FIFO, disable mute.
+      sound_mixBackBuffer();
+      sound_feedFifo(); // Fill the FIFO before sound_isr() may run.
+      sound_setState(sound_play_st);
     }
     break;
   case sound_play_st:
-    // Each time you enter this state, add as many samples as will fit in the
-    // FIFO.
-    if (sound_array == NULL) {
-      printf("ERROR, sound_tick: sound array has not been set.\n");
-      return;
-    }
-    // This while-loop continues to load sound-data into the FIFOs until it is
-    // full or the sound data are exhausted.
-    while (!(Xil_In32(AUDIO_CTRL_BASEADDR + I2S_FIFO_STS_REG) &
-             0b0010)) { // while room in FIFO.
-      uint32_t sampleValue =
-          sound_array[arrayIndex] * sound_currentVolume; // Scale by volume.
-      sound_sendDataToBothChannels(
-          sampleValue); // Send the sound data to the left and right channels.
-      arrayIndex++;     // Go to next sample.
-      if (arrayIndex == sound_sampleCount) { // All done?
-        sound_playSoundFlag = false;         // Yes.
-        sound_disableTxFifo();               // Disable the TX FIFO.
-        currentState = sound_wait_st;        // Go back to the wait state.
-      }
+    // Each time you enter this state, mix the next buffer once sound_isr()
+    // has taken the last one. Playback ends when every voice has finished and
+    // the front buffer has been written out.
+    if (!sound_backReady && !sound_mixBackBuffer() &&
+        sound_frontIndex == sound_frontLength) {
+      sound_setState(sound_wait_st); // Go back to the wait state.
+      sound_playSoundFlag = false;  // All voices are done.
+      audio_hal_enableTx(false);    // Disable the TX FIFO.
+      break;
     }
+    if (!sound_interruptDriven)
+      sound_feedFifo();
     break;
   }
 }
 
+// Starts the selected sound on a free voice, mixed with whatever is already
+// playing. If every voice is busy, the one that was started first, and so has
+// played the longest, is replaced.
+static int8_t sound_startVoice(uint16_t gain, bool loop) {
+  const void *samples;
+  uint32_t count, rate;
+  sound_format_t format;
+  if (sound_selected == NULL) {
+    return SOUND_NO_VOICE;
+  } else if (sound_selected->script) {
+    samples = sound_selected->script;
+    count = synth_length(sound_selected->script);
+    rate = SYNTH_SAMPLE_RATE;
+    format = sound_synth_e;
+  } else {
+    const sound_asset_t *asset = sound_assets_get(sound_selected->asset);
+    if (asset == NULL) {
+      printf("sound_startVoice(): sound %d is missing from the blob\n",
+             sound_selected->asset);
+      return SOUND_NO_VOICE;
+    }
+    samples = sound_assets_data(asset);
+    count = asset->sample_count;
+    rate = asset->sample_rate;
+    format = (asset->format == SOUND_ASSET_FORMAT_ADPCM) ? sound_adpcm_e
+                                                         : sound_pcm_e;
+  }
+  if (count == 0)
+    return SOUND_NO_VOICE;
+  int8_t voice = 0;
+  for (int8_t v = 0; v < SOUND_VOICE_COUNT; v++) {
+    if (!sound_voices[v].active) {
+      voice = v;
+      break;
+    }
+    if (sound_voiceStarts - sound_voices[v].started >
+        sound_voiceStarts - sound_voices[voice].started)
+      voice = v;
+  }
+  sound_voices[voice].samples = samples;
+  sound_voices[voice].format = format;
+  sound_voices[voice].count = count;
+  sound_rewindVoice(&sound_voices[voice]);
+  sound_voices[voice].gain = gain;
+  sound_voices[voice].loop = loop;
+  sound_voices[voice].started = sound_voiceStarts++;
+  sound_voices[voice].step =
+      (uint32_t)(((uint64_t)rate << SOUND_PHASE_SHIFT) / SOUND_OUTPUT_RATE);
+  if (sound_voices[voice].step != SOUND_PHASE_ONE) {
+    // Prime current and next with the first two samples.
+    sound_voices[voice].inputIndex = sound_voices[voice].inputLength = 0;
+    sound_voices[voice].phase = 0;
+    sound_voices[voice].current = sound_voices[voice].next = 0;
+    sound_readSample(&sound_voices[voice], &sound_voices[voice].current);
+    sound_readSample(&sound_voices[voice], &sound_voices[voice].next);
+  }
+  TRACE(trace_voice_e, voice, sound_voices[voice].active,
+        sound_selected - sound_registry);
+  sound_voices[voice].active = true;
+  sound_playSoundFlag = true;
+  return voice;
+}
+
+// Plays a sound on its own voice and returns the voice.
+int8_t sound_playVoice(sound_sounds_t sound, uint16_t gain, bool loop) {
+  sound_setSound(sound);
+  return sound_startVoice(gain, loop);
+}
+
+// Stops one voice, the others keep playing.
+void sound_stopVoice(int8_t voice) {
+  if (voice >= 0 && voice < SOUND_VOICE_COUNT)
+    sound_voices[voice].active = false;
+}
+
+// Returns true if the voice is still playing.
+bool sound_isVoiceBusy(int8_t voice) {
+  return voice >= 0 && voice < SOUND_VOICE_COUNT &&
+         sound_voices[voice].active;
+}
+
 // Sets the sound and starts playing it immediately.
 void sound_playSound(sound_sounds_t sound) {
   sound_setSound(sound); // Set the sound to be played.
@@ -227,152 +464,153 @@ bool sound_isBusy() {
   return (sound_playSoundFlag); // Busy if NOT in the wait state.
 }
 
+// Returns the mixed samples waiting to go into the FIFO. sound_isr() may move
+// on while they are counted, so this is only a level, not an exact count.
+uint32_t sound_getQueuedSamples() {
+  uint32_t length = sound_frontLength;
+  uint32_t index = sound_frontIndex;
+  uint32_t queued = index < length ? length - index : 0;
+  if (sound_backReady)
+    queued += sound_backLength;
+  return queued;
+}
+
 // Returns true if the sound has finished playing.
 bool sound_isSoundComplete() { return (!sound_isBusy()); }
 
+// Sound effects played by the synthesizer, see synth.h. Fields are waveform,
+// volume, duration_ms, start_hz, end_hz, attack_ms and release_ms.
+static const synth_note_t sound_silenceNotes[] = {
+    {synth_silence_e, 0, 1000, 0, 0, 0, 0},
+};
+// A noise crack and a falling laser sweep.
+static const synth_note_t sound_gunFireNotes[] = {
+    {synth_noise_e, 200, 25, 6000, 2000, 0, 10},
+    {synth_square_e, 150, 160, 1600, 200, 2, 80},
+};
+// A short, high tick.
+static const synth_note_t sound_gunClickNotes[] = {
+    {synth_noise_e, 160, 12, 9000, 9000, 0, 8},
+    {synth_triangle_e, 200, 30, 1400, 900, 0, 25},
+};
+// A rising arpeggio.
+static const synth_note_t sound_gunReloadNotes[] = {
+    {synth_square_e, 110, 70, 523, 523, 2, 15},
+    {synth_square_e, 110, 70, 659, 659, 2, 15},
+    {synth_square_e, 110, 70, 784, 784, 2, 15},
+    {synth_square_e, 130, 160, 1047, 1047, 2, 100},
+};
+
+#define SOUND_SCRIPT(notes) {notes, sizeof(notes) / sizeof(notes[0])}
+static const synth_script_t sound_silenceScript =
+    SOUND_SCRIPT(sound_silenceNotes);
+static const synth_script_t sound_gunFireScript =
+    SOUND_SCRIPT(sound_gunFireNotes);
+static const synth_script_t sound_gunClickScript =
+    SOUND_SCRIPT(sound_gunClickNotes);
+static const synth_script_t sound_gunReloadScript =
+    SOUND_SCRIPT(sound_gunReloadNotes);
+
+#define SOUND_SYNTH(script) {&script, 0, SOUND_GAIN_UNITY}
+#define SOUND_ASSET(id) {NULL, id, SOUND_GAIN_UNITY}
+
+// Every sound, indexed by sound_sounds_t.
+static const sound_registry_t sound_registry[SOUND_COUNT] = {
+    [sound_gameStart_e] = SOUND_ASSET(SOUND_ASSET_GAMEBOYSTARTUP),
+    [sound_gunFire_e] = SOUND_SYNTH(sound_gunFireScript),
+    [sound_hit_e] = SOUND_ASSET(SOUND_ASSET_OUCH48K),
+    [sound_gunClick_e] = SOUND_SYNTH(sound_gunClickScript),
+    [sound_gunReload_e] = SOUND_SYNTH(sound_gunReloadScript),
+    [sound_loseLife_e] = SOUND_ASSET(SOUND_ASSET_SCREAMANDDIE48K),
+    [sound_gameOver_e] = SOUND_ASSET(SOUND_ASSET_PACMANDEATH),
+    [sound_returnToBase_e] = SOUND_ASSET(SOUND_ASSET_GAMEOVER48K),
+    [sound_oneSecondSilence_e] = SOUND_SYNTH(sound_silenceScript),
+    [sound_johnCena_e] = SOUND_ASSET(SOUND_ASSET_JOHNCENA),
+    [sound_robloxOof_e] = SOUND_ASSET(SOUND_ASSET_ROBLOXOOF),
+    [sound_missionFailed_e] = SOUND_ASSET(SOUND_ASSET_MISSIONFAILED),
+};
+
 // Use this to set the base address for the array containing sound data.
-// Allow sounds to be interrupted.
+// Sounds started afterwards are mixed with the ones already playing.
 void sound_setSound(sound_sounds_t sound) {
-  if (sound_isBusy()) { // You are currently playing some sound.
-    sound_stopSound(); // Stop the sound and reset the state-machine, FIFO, etc.
-  }
-  sound_array =
-      NULL; // Set the pointer to NULL so you can detect it never being set.
-  switch (sound) {
-  case sound_gameStart_e:
-    sound_array = gameBoyStartup_wav; // Set the array holding the data.
-    sound_sampleCount =
-        GAMEBOYSTARTUP_WAV_NUMBER_OF_SAMPLES; // Size of the array.
-    break;
-  case sound_gunFire_e:
-    sound_array = bcfire01_48k_wav; // Set the array holding the data.
-    sound_sampleCount =
-        BCFIRE01_48K_WAV_NUMBER_OF_SAMPLES; // Size of the array.
-    break;
-  case sound_hit_e:
-    sound_array = ouch48k_wav; // You get the idea...
-    sound_sampleCount = OUCH48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_gunClick_e:
-    sound_array = gunEmpty48k_wav;
-    sound_sampleCount = GUNEMPTY48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_gunReload_e:
-    sound_array = powerUp48k_wav;
-    sound_sampleCount = POWERUP48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_loseLife_e:
-    sound_array = screamAndDie48k_wav;
-    sound_sampleCount = SCREAMANDDIE48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_gameOver_e:
-    sound_array = pacmanDeath_wav;
-    sound_sampleCount = PACMANDEATH_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_returnToBase_e:
-    sound_array = gameOver48k_wav;
-    sound_sampleCount = GAMEOVER48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_oneSecondSilence_e:
-    sound_array = soundOfSilence;
-    sound_sampleCount = ONE_SECOND_OF_SOUND_ARRAY_SIZE;
-    break;
-  case sound_johnCena_e:
-    sound_array = game_intro_wav;
-    sound_sampleCount = JOHN_CENA_NUMBER_OF_SAMPLES;
-    break;
-  case sound_robloxOof_e:
-    sound_array = robloxOof;
-    sound_sampleCount = ROBLOX_OOF_NUMBER_OF_SAMPLES;
-    break;
-  case sound_missionFailed_e:
-    sound_array = mission_failed_wav;
-    sound_sampleCount = MISSION_FAILED_NUMBER_SAMPLES;
-    break;
-  default:
+  if ((uint32_t)sound >= SOUND_COUNT) {
+    sound_selected = NULL; // Nothing will be played.
     printf("sound_setSound(): bogus sound value(%d)\n", sound);
+    return;
   }
+  sound_selected = &sound_registry[sound];
 }
 
 // Used to set the volume. Use one of the provided values.
 void sound_setVolume(sound_volume_t volume) { sound_currentVolume = volume; }
 
-// Tell the state machine to start playing the sound.
-void sound_startSound() { sound_playSoundFlag = true; }
+// Selects how sounds recorded at other rates are converted to 48 kHz. Applies
+// to the voices started afterwards as well as the ones already playing.
+void sound_setResampleQuality(sound_resample_t quality) {
+  sound_resampleQuality = quality;
+}
+
+// Tell the state machine to start playing the sound on a new voice.
+void sound_startSound() {
+  if (sound_selected)
+    sound_startVoice(sound_selected->gain, false);
+}
 
-// Stops playing the sound and resets the state-machine to the wait state.
+// Stops playing every voice and resets the state-machine to the wait state.
 void sound_stopSound() {
+  for (uint8_t v = 0; v < SOUND_VOICE_COUNT; v++)
+    sound_voices[v].active = false;
+  sound_setState(sound_wait_st); // Force the state-machine back to wait.
   sound_playSoundFlag = false; // disable the state-machine.
-  currentState =
-      sound_wait_st; // Force the state-machine back to the wait state.
+  sound_frontIndex = sound_frontLength = 0;
+  sound_backReady = false;
 }
 
 // Initializes the sound functionality
 void sound_initialize() { sound_init(); }
 
-// Plays a intro noise
-void sound_introSong() {
+// Plays a sound to completion before returning. Only for use outside of the
+// game loop, where nothing else needs the CPU.
+static void sound_playAndWait(sound_sounds_t sound) {
   sound_tick();
-  sound_setSound(sound_gameStart_e);
-  printf("playing intro\n");
-  sound_startSound();
-  while (1) {
+  sound_playSound(sound);
+  while (sound_isBusy()) {
+    swtimer_runExpired(swtimer_real_e); // Finishes the CODEC setup.
     sound_tick();
-    if (!sound_isBusy())
-      break;
   }
 }
 
-// Plays a mission failed noise
+// Plays a intro noise
+void sound_introSong() {
+  printf("playing intro\n");
+  sound_playAndWait(sound_gameStart_e);
+}
+
+// Plays a mission failed noise once the sound already playing has finished
 void sound_missionFailed() {
-  sound_tick();
-  sound_setSound(sound_missionFailed_e);
-  printf("playing mission failed\n");
-  sound_startSound();
-  while (1) {
+  while (sound_isBusy())
     sound_tick();
-    if (!sound_isBusy())
-      break;
-  }
+  printf("playing mission failed\n");
+  sound_playAndWait(sound_missionFailed_e);
 }
 
+// The in-game sounds below only start playback and return right away, so a
+// game tick never waits on audio. sound_tick() must be called regularly to
+// keep the FIFO fed.
+
 // Plays a powerup noise
 void sound_powerup() {
-  sound_tick();
-  sound_setSound(sound_johnCena_e);
-  printf("playing powerup\n");
-  sound_startSound();
-  while (1) {
-    sound_tick();
-    if (!sound_isBusy())
-      break;
-  }
+  sound_playSound(sound_johnCena_e);
 }
 
 // Plays the game over noise
 void sound_gameOver() {
-  sound_tick();
-  sound_setSound(sound_gameOver_e);
-  printf("playing game over\n");
-  sound_startSound();
-  while (1) {
-    sound_tick();
-    if (!sound_isBusy())
-      break;
-  }
+  sound_playSound(sound_gameOver_e);
 }
 
 // Plays a noise for the ufo entrance
 void sound_ufo() {
-  sound_tick();
-  sound_setSound(sound_gunReload_e);
-  printf("playing ufo\n");
-  sound_startSound();
-  while (1) {
-    sound_tick();
-    if (!sound_isBusy())
-      break;
-  }
+  sound_playSound(sound_gunReload_e);
 }
 
 // Plays several sounds.
@@ -425,243 +663,3 @@ void sound_runTest() {
   }
   printf("done.\n");
 }
-
-/**********************************************************************************
- * Note from BLH: Most of this code was re-purposed from the original Digilent
- * demonstration code. The code initializes the IIC controller that is
- * connected to the audio CODEC. It also provides functions to initialize the
- * audio CODEC and to send/received to/from CODEC.
- **********************************************************************************/
-
-#define SEND_BUFFER_SIZE 2
-
-static XIicPs Iic; /* Instance of the IIC Device */
-
-/***************************************************************************
- * Procedural definitions from the original audio_demo files from Digilent.
- ***************************************************************************/
-
-/***  AudioRegSet(XIicPs *IIcPtr, u8 regAddr, u16 regData)
-**
-**  Parameters:
-**    IIcPtr - Pointer to the initialized XIicPs struct
-**    regAddr - Register in the SSM2603 to write to
-**    regData - Data to write to the register (lower 9 bits are used)
-**
-**  Return Value: int
-**    XST_SUCCESS if successful
-**
-**  Errors:
-**
-**  Description:
-**    Writes a value to a register in the SSM2603 device over IIC.
-**
-*/
-static int AudioRegSet(XIicPs *IIcPtr, u8 regAddr, u16 regData) {
-  int Status;
-  //  u8 SendBuffer[2];
-  u8 SendBuffer[SEND_BUFFER_SIZE]; // We will send 2 bytes at a time.
-  // Register address is stored in bits 7 - 1.
-  SendBuffer[0] = regAddr << 1;
-  // Store data bit 9 in bit 7 of 0th word.
-  SendBuffer[0] = SendBuffer[0] | ((regData >> 8) & 0b1);
-  // Bits 7-0 of data are stored in 8 bits of 1th word.
-  SendBuffer[1] = regData & 0xFF;
-  // Send 2 bytes to the IIC controller attached to the audio CODEC.
-  Status = XIicPs_MasterSendPolled(IIcPtr, SendBuffer, 2, IIC_SLAVE_ADDR);
-  // Always check for success.
-  if (Status != XST_SUCCESS) {
-    printf("IIC send failed\n");
-    return XST_FAILURE;
-  }
-  // This function blocks until the IIC is idle.
-  /*
-   * Wait until bus is idle to start another transfer.
-   */
-  volatile int no_op;
-  while (1) {
-    no_op = XIicPs_BusIsBusy(IIcPtr);
-    if (!no_op)
-      break;
-  }
-
-  // while (XIicPs_BusIsBusy(IIcPtr)) {
-  //   /* NOP */
-  // }
-  return XST_SUCCESS;
-}
-
-/***  AudioInitialize(u16 timerID,  u16 iicID, u32 i2sAddr)
-**
-**  Parameters:
-**    timerID - DEVICE_ID for the SCU timer
-**    iicID   - DEVICE_ID for the PS IIC controller connected to the SSM2603
-**    i2sAddr - Physical Base address of the I2S controller
-**
-**  Return Value: int
-**    XST_SUCCESS if successful
-**
-**  Errors:
-**
-**  Description:
-**    Initializes the Audio demo. Must be called once and only once before
-*calling
-**    AudioRunDemo
-**
-*/
-static int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr) {
-  int Status;            // Return status value.
-  XIicPs_Config *Config; // Keep track of the config. value.
-  u32 i2sClkDiv;         // Used to help compute the sampling frequency.
-
-  TimerInitialize(
-      timerID); // This is a timer that is used to create precise delays.
-
-  /*
-   * Initialize the IIC driver so that it's ready to use
-   * Look up the configuration in the config table,
-   * then initialize it.
-   */
-  Config = XIicPs_LookupConfig(iicID);
-  if (NULL == Config) {
-    return XST_FAILURE;
-  }
-
-  Status = XIicPs_CfgInitialize(&Iic, Config, Config->BaseAddress);
-  if (Status != XST_SUCCESS) {
-    return XST_FAILURE;
-  }
-
-  /*
-   * Perform a self-test to ensure that the hardware was built correctly.
-   */
-  Status = XIicPs_SelfTest(&Iic);
-  if (Status != XST_SUCCESS) {
-    return XST_FAILURE;
-  }
-
-  /*
-   * Set the IIC serial clock rate.
-   */
-  Status = XIicPs_SetSClk(&Iic, IIC_SCLK_RATE);
-  if (Status != XST_SUCCESS) {
-    return XST_FAILURE;
-  }
-
-  /*
-   * Write to the SSM2603 audio codec registers to configure the device. Refer
-   * to the SSM2603 Audio Codec data sheet for information on what these writes
-   * do.
-   */
-
-  // Perform Reset
-  Status = AudioRegSet(&Iic, 15, 0b000000000);
-  if (Status)
-    printf("Status1:%d\n", Status);
-  TimerDelay(75000);
-  // Power up
-  Status |= AudioRegSet(&Iic, 6, 0b000110000);
-  if (Status)
-    printf("Status2:%d\n", Status);
-  // Left-channel ADC input volume.
-  Status |= AudioRegSet(&Iic, 0, 0b000010111);
-  if (Status)
-    printf("Status3:%d\n", Status);
-  // Right-channel ADC input volume.
-  AudioRegSet(&Iic, 1, 0b000010111);
-  // Left-channel DAC volume. Also set
-  Status |= AudioRegSet(&Iic, 2, 0b101111001);
-  if (Status)
-    printf("Status4:%d\n", Status);
-  // right volume to same value.
-  Status |= AudioRegSet(&Iic, 4, 0b000010000); // Analog audio path.
-  if (Status)
-    printf("Status5:%d\n", Status);
-  Status |= AudioRegSet(&Iic, 5, 0b000000000); // Digital audio path.
-  if (Status)
-    printf("Status6:%d\n", Status);
-  // Changed so Word length is 24  Status |= AudioRegSet(&Iic,
-  // 8, 0b000000000); //Changed so no CLKDIV2
-  Status |= AudioRegSet(&Iic, 7, 0b000001010);
-  if (Status)
-    printf("Status7:%d\n", Status);
-  // Changed so no CLKDIV2
-  Status |= AudioRegSet(&Iic, 8, 0b000000000);
-  if (Status)
-    printf("Status8:%d\n", Status);
-  // Wait for things to settle down.
-  TimerDelay(75000);
-  // Make things active.
-  Status |= AudioRegSet(&Iic, 9, 0b000000001);
-  if (Status)
-    printf("Status9:%d\n", Status);
-  // Power-up the ouput (OSC is left
-  // disabled as MCLK pin provides clock).
-  Status |= AudioRegSet(&Iic, 6, 0b000100000);
-  if (Status)
-    printf("Status10:%d\n", Status);
-
-  if (Status != XST_SUCCESS) {
-    return XST_FAILURE;
-  }
-
-  // BLH: This is the original value used by Digilent.
-  // i2sClkDiv = 1; // Set the BCLK to be MCLK / 4
-  // BLH: This value makes things sound correct.
-  // Not sure what the problem is, perhaps the DLL is not running at the correct
-  // frequency? or, there is a bug in the IP that drives the CODEC. In any case,
-  // the sampling rate is 48k.
-  i2sClkDiv = 3;
-  // Set the LRCLK's to be BCLK / 64
-  i2sClkDiv = i2sClkDiv | (31 << 16);
-  // Write clock div register
-  Xil_Out32(i2sAddr + I2S_CLK_CTRL_REG, i2sClkDiv);
-
-  return XST_SUCCESS;
-}
-
-/* ------------------------------------------------------------ */
-
-/***  I2SFifoWrite (u32 i2sBaseAddr, u32 audioData)
-**
-**  Parameters:
-**    i2sBaseAddr - Physical Base address of the I2S controller
-**    audioData - Audio data to be written to FIFO
-**
-**  Return Value: none
-**
-**  Errors:
-**
-**  Description:
-**    Blocks execution until space is available in the I2S TX fifo, then
-**    writes data to it.
-**
-*/
-static void I2SFifoWrite(u32 i2sBaseAddr, u32 audioData) {
-  while ((Xil_In32(i2sBaseAddr + I2S_FIFO_STS_REG)) & 0b0010) {
-  }
-  Xil_Out32(i2sBaseAddr + I2S_TX_FIFO_REG, audioData);
-}
-/* ------------------------------------------------------------ */
-
-/***  I2SFifoRead (u32 i2sBaseAddr)
-**
-**  Parameters:
-**    i2sBaseAddr - Physical Base address of the I2S controller
-**
-**  Return Value: u32
-**    Audio data from the I2S RX FIFO
-**
-**  Errors:
-**
-**  Description:
-**    Blocks execution until data is available in the I2S RX fifo, then
-**    reads it out.
-**
-*/
-static u32 I2SFifoRead(u32 i2sBaseAddr) {
-  while ((Xil_In32(i2sBaseAddr + I2S_FIFO_STS_REG)) & 0b0100) {
-  }
-  return Xil_In32(i2sBaseAddr + I2S_RX_FIFO_REG);
-}
-/* ------------------------------------------------------------ */
@@ -23,6 +23,13 @@ typedef uint32_t sound_status_t;
 #define SOUND_VOLUME_2 (INT16_MAX / 8)
 #define SOUND_VOLUME_3 (INT16_MAX) // Max volume
 
+// Number of sounds that can play at the same time.
+#define SOUND_VOICE_COUNT 8
+// Per-voice gain that plays a sound at its recorded level.
+#define SOUND_GAIN_UNITY 0x8000
+// Returned by sound_playVoice() when there is nothing to play.
+#define SOUND_NO_VOICE -1
+
 // sound-specific defines.
 typedef enum {
   sound_gameStart_e,       // Play a sound when the game starts.
@@ -48,34 +55,71 @@ typedef enum {
   sound_maximumVolume_e = SOUND_VOLUME_3     // Really loud.
 } sound_volume_t;
 
+// How sounds recorded at other rates are converted to the CODEC's 48 kHz.
+// sound_linearResample_e is the default.
+typedef enum {
+  sound_nearestResample_e, // Repeat or drop samples. Cheapest, adds aliasing.
+  sound_linearResample_e   // Interpolate between neighbouring samples.
+} sound_resample_t;
+
 // Must be called before using the sound state machine.
 sound_status_t sound_init();
 
-// Standard tick function.
+// Standard tick function. Mixes the playing voices ahead of the CODEC; unless
+// sound_setInterruptDriven(true) was called it also feeds the FIFO.
 void sound_tick();
 
+// Copies mixed samples into the audio FIFO. Call from a periodic interrupt,
+// at least every CONFIG_AUDIO_TIMER_PERIOD, after
+// sound_setInterruptDriven(true).
+void sound_isr();
+
+// Selects who feeds the FIFO. With enable, sound_isr() must be called from a
+// periodic interrupt often enough that the FIFO never drains.
+void sound_setInterruptDriven(bool enable);
+
 // Sets the sound and starts playing it immediately.
 void sound_playSound(sound_sounds_t sound);
 
-// Returns true if the sound is still playing.
+// Returns true if any sound is still playing.
 bool sound_isBusy();
 
 // Returns true if the sound has finished playing.
 bool sound_isSoundComplete();
 
+// Returns how many mixed samples are waiting for sound_isr() to put them in
+// the FIFO.
+uint32_t sound_getQueuedSamples();
+
 // Use this to set the base address for the array containing sound data.
-// Allow sounds to be interrupted.
+// Sounds started afterwards are mixed with the ones already playing.
 void sound_setSound(sound_sounds_t sound);
 
 // Used to set the volume. Use one of the provided values.
 void sound_setVolume(sound_volume_t);
 
-// Tell the state machine to start playing the sound.
+// Selects how sounds recorded at other rates are converted to 48 kHz. Applies
+// to the voices started afterwards as well as the ones already playing.
+void sound_setResampleQuality(sound_resample_t quality);
+
+// Tell the state machine to start playing the sound on a new voice.
 void sound_startSound();
 
-// Stops playing the sound and resets the state-machine to the wait state.
+// Stops playing every voice and resets the state-machine to the wait state.
 void sound_stopSound();
 
+// Starts a sound on its own voice, mixed with the other voices, and returns
+// the voice. gain is relative to SOUND_GAIN_UNITY; a looping voice plays until
+// it is stopped. If every voice is busy, the one that was started first is
+// replaced, whatever its rate or however often it has looped.
+int8_t sound_playVoice(sound_sounds_t sound, uint16_t gain, bool loop);
+
+// Stops one voice, the others keep playing.
+void sound_stopVoice(int8_t voice);
+
+// Returns true if the voice is still playing.
+bool sound_isVoiceBusy(int8_t voice);
+
 // Plays several sounds.
 // To invoke, just place this in your main.
 // Completely stand alone, doesn't require interrupts, etc.
@@ -83,14 +127,19 @@ void sound_runTest();
 
 void sound_initialize();
 
+// Blocks until the intro has played. Call before the game starts.
 void sound_introSong();
 
+// In-game sounds. These start playback and return immediately; sound_tick()
+// must be called regularly (e.g. from the main loop) to play them.
 void sound_ufo();
 
 void sound_gameOver();
 
 void sound_powerup();
 
+// Blocks until any playing sound and then the mission failed clip are done.
+// Call after the game has ended.
 void sound_missionFailed();
 
 #endif /* SOUND_H_ */
\ No newline at end of file
@@ -1,4 +0,0 @@
-extern uint16_t game_intro_wav[];
-#define JOHN_CENA_SAMPLE_RATE 48000
-#define JOHN_CENA_BITS_PER_SAMPLE 16
-#define JOHN_CENA_NUMBER_OF_SAMPLES 164916
\ No newline at end of file
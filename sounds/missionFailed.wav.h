@@ -1,4 +0,0 @@
-extern uint16_t mission_failed_wav[];
-#define MISSION_FAILED_SAMPLE_RATE 48000
-#define MISSION_FAILED_BITS_PER_SAMPLE 16
-#define MISSION_FAILED_NUMBER_SAMPLES 144336
\ No newline at end of file
@@ -1,14966 +0,0 @@
-// This file was generated by executing this statement: wav2c powerUp48k.wav
-
-#include <stdint.h>
-
-uint16_t powerUp48k_wav[14960] = {
-34568,
-33821,
-32950,
-32090,
-31304,
-30623,
-29976,
-29331,
-28617,
-27881,
-27165,
-26535,
-25988,
-25447,
-24824,
-24080,
-23315,
-22663,
-22247,
-22019,
-21856,
-21607,
-21281,
-20978,
-20806,
-20755,
-20651,
-20337,
-19784,
-19120,
-18570,
-18222,
-18037,
-17885,
-17715,
-17603,
-17719,
-18114,
-18768,
-19488,
-20166,
-20755,
-21303,
-21853,
-22382,
-22832,
-23145,
-23339,
-23487,
-23663,
-23946,
-24351,
-24893,
-25543,
-26254,
-26952,
-27608,
-28215,
-28825,
-29453,
-30086,
-30677,
-31239,
-31834,
-32612,
-33618,
-34802,
-35984,
-36984,
-37743,
-38306,
-38777,
-39181,
-39463,
-39561,
-39514,
-39477,
-39679,
-40205,
-41021,
-41946,
-42816,
-43583,
-44294,
-45008,
-45694,
-46234,
-46482,
-46431,
-46147,
-45837,
-45616,
-45514,
-45454,
-45341,
-45150,
-44938,
-44783,
-44690,
-44586,
-44343,
-43917,
-43358,
-42824,
-42446,
-42287,
-42277,
-42312,
-42294,
-42201,
-42053,
-41855,
-41570,
-41129,
-40473,
-39618,
-38628,
-37641,
-36727,
-35974,
-35339,
-34809,
-34349,
-33974,
-33735,
-33648,
-33689,
-33738,
-33659,
-33352,
-32813,
-32132,
-31429,
-30746,
-30086,
-29373,
-28627,
-27896,
-27282,
-26830,
-26468,
-26086,
-25568,
-24926,
-24259,
-23723,
-23392,
-23264,
-23251,
-23257,
-23265,
-23291,
-23389,
-23567,
-23743,
-23825,
-23713,
-23402,
-23003,
-22622,
-22364,
-22183,
-22014,
-21773,
-21531,
-21440,
-21671,
-22246,
-23006,
-23725,
-24222,
-24540,
-24815,
-25195,
-25655,
-26046,
-26231,
-26236,
-26255,
-26513,
-27036,
-27676,
-28148,
-28333,
-28321,
-28378,
-28705,
-29311,
-30007,
-30601,
-31056,
-31515,
-32158,
-33034,
-34013,
-34874,
-35514,
-35990,
-36502,
-37171,
-37967,
-38688,
-39143,
-39294,
-39281,
-39353,
-39639,
-40142,
-40700,
-41173,
-41545,
-41870,
-42297,
-42801,
-43316,
-43670,
-43827,
-43834,
-43878,
-44080,
-44405,
-44720,
-44811,
-44620,
-44241,
-43866,
-43666,
-43638,
-43677,
-43621,
-43434,
-43189,
-42999,
-42904,
-42827,
-42627,
-42255,
-41773,
-41383,
-41216,
-41274,
-41397,
-41366,
-41072,
-40561,
-39985,
-39485,
-39081,
-38694,
-38222,
-37663,
-37085,
-36628,
-36312,
-36082,
-35778,
-35323,
-34716,
-34093,
-33571,
-33204,
-32906,
-32545,
-32040,
-31410,
-30802,
-30308,
-29983,
-29732,
-29462,
-29090,
-28667,
-28248,
-27922,
-27642,
-27375,
-27055,
-26704,
-26426,
-26287,
-26334,
-26484,
-26620,
-26633,
-26487,
-26220,
-25903,
-25638,
-25443,
-25368,
-25377,
-25470,
-25616,
-25798,
-25973,
-26110,
-26153,
-26075,
-25890,
-25661,
-25492,
-25482,
-25655,
-25967,
-26308,
-26566,
-26697,
-26712,
-26679,
-26634,
-26591,
-26510,
-26369,
-26205,
-26071,
-26085,
-26263,
-26573,
-26920,
-27213,
-27459,
-27718,
-28091,
-28551,
-29008,
-29281,
-29281,
-29091,
-28895,
-28901,
-29147,
-29510,
-29793,
-29895,
-29879,
-29895,
-30038,
-30222,
-30285,
-30110,
-29790,
-29582,
-29723,
-30238,
-30919,
-31450,
-31675,
-31650,
-31602,
-31697,
-31891,
-32000,
-31820,
-31359,
-30795,
-30360,
-30137,
-30032,
-29830,
-29473,
-29056,
-28847,
-29035,
-29581,
-30253,
-30741,
-30909,
-30836,
-30725,
-30747,
-30872,
-30951,
-30853,
-30567,
-30283,
-30153,
-30231,
-30355,
-30297,
-29939,
-29378,
-28859,
-28618,
-28706,
-28975,
-29243,
-29397,
-29551,
-29857,
-30426,
-31163,
-31851,
-32264,
-32368,
-32244,
-32102,
-31985,
-31862,
-31571,
-31076,
-30497,
-30087,
-30073,
-30496,
-31199,
-31932,
-32530,
-33002,
-33488,
-34108,
-34853,
-35563,
-36112,
-36452,
-36745,
-37161,
-37776,
-38468,
-39010,
-39227,
-39136,
-38947,
-38875,
-39031,
-39341,
-39636,
-39856,
-40074,
-40472,
-41178,
-42141,
-43180,
-44061,
-44724,
-45218,
-45693,
-46186,
-46617,
-46789,
-46598,
-46076,
-45437,
-44907,
-44604,
-44499,
-44447,
-44370,
-44289,
-44319,
-44566,
-44987,
-45461,
-45802,
-45957,
-45992,
-46048,
-46233,
-46476,
-46642,
-46553,
-46190,
-45647,
-45116,
-44670,
-44306,
-43889,
-43351,
-42703,
-42100,
-41653,
-41413,
-41279,
-41120,
-40885,
-40628,
-40469,
-40480,
-40584,
-40618,
-40401,
-39860,
-39059,
-38120,
-37142,
-36153,
-35140,
-34095,
-33103,
-32255,
-31647,
-31295,
-31113,
-30998,
-30837,
-30595,
-30287,
-29963,
-29662,
-29365,
-29016,
-28538,
-27914,
-27187,
-26474,
-25869,
-25385,
-24930,
-24398,
-23722,
-23001,
-22356,
-21915,
-21627,
-21382,
-21049,
-20685,
-20427,
-20471,
-20799,
-21238,
-21484,
-21361,
-20886,
-20239,
-19592,
-18981,
-18303,
-17474,
-16528,
-15667,
-15114,
-14951,
-15083,
-15293,
-15427,
-15485,
-15602,
-15922,
-16473,
-17140,
-17740,
-18141,
-18360,
-18491,
-18674,
-18931,
-19216,
-19404,
-19468,
-19457,
-19510,
-19742,
-20124,
-20546,
-20871,
-21059,
-21242,
-21594,
-22233,
-23137,
-24125,
-25048,
-25831,
-26548,
-27250,
-27975,
-28570,
-28967,
-29093,
-29074,
-29072,
-29194,
-29458,
-29770,
-30083,
-30420,
-30890,
-31582,
-32525,
-33610,
-34712,
-35711,
-36570,
-37306,
-37950,
-38530,
-39031,
-39455,
-39813,
-40140,
-40493,
-40905,
-41366,
-41818,
-42172,
-42360,
-42407,
-42405,
-42515,
-42847,
-43416,
-44135,
-44889,
-45613,
-46311,
-47054,
-47820,
-48517,
-48982,
-49076,
-48853,
-48444,
-48075,
-47809,
-47602,
-47286,
-46787,
-46180,
-45672,
-45466,
-45574,
-45838,
-46040,
-46059,
-46004,
-46057,
-46350,
-46825,
-47259,
-47445,
-47344,
-47085,
-46868,
-46765,
-46662,
-46366,
-45728,
-44790,
-43725,
-42747,
-41941,
-41267,
-40596,
-39856,
-39081,
-38370,
-37857,
-37545,
-37367,
-37163,
-36826,
-36343,
-35821,
-35361,
-35019,
-34672,
-34157,
-33343,
-32251,
-31051,
-29947,
-29016,
-28217,
-27403,
-26540,
-25682,
-24988,
-24523,
-24206,
-23859,
-23325,
-22629,
-21924,
-21392,
-21105,
-20953,
-20778,
-20451,
-19986,
-19463,
-18963,
-18488,
-17964,
-17352,
-16664,
-16004,
-15522,
-15274,
-15266,
-15356,
-15453,
-15485,
-15521,
-15687,
-16054,
-16598,
-17130,
-17483,
-17568,
-17492,
-17423,
-17481,
-17619,
-17679,
-17575,
-17374,
-17321,
-17577,
-18150,
-18787,
-19245,
-19461,
-19628,
-20062,
-20932,
-22143,
-23411,
-24512,
-25405,
-26271,
-27252,
-28328,
-29286,
-29917,
-30178,
-30284,
-30503,
-31004,
-31677,
-32295,
-32655,
-32786,
-32909,
-33282,
-34025,
-35043,
-36136,
-37172,
-38161,
-39237,
-40474,
-41811,
-43036,
-43976,
-44588,
-45060,
-45624,
-46418,
-47357,
-48176,
-48663,
-48751,
-48627,
-48522,
-48597,
-48830,
-49059,
-49208,
-49298,
-49506,
-49959,
-50627,
-51319,
-51791,
-51935,
-51866,
-51814,
-51998,
-52387,
-52818,
-52980,
-52771,
-52246,
-51658,
-51208,
-50962,
-50786,
-50519,
-50091,
-49583,
-49178,
-48949,
-48838,
-48632,
-48159,
-47401,
-46541,
-45824,
-45406,
-45215,
-45025,
-44547,
-43677,
-42473,
-41209,
-40098,
-39251,
-38567,
-37852,
-36988,
-36020,
-35131,
-34472,
-34032,
-33580,
-32878,
-31839,
-30666,
-29720,
-29217,
-29084,
-28921,
-28319,
-27135,
-25582,
-24097,
-22957,
-22171,
-21471,
-20613,
-19593,
-18639,
-17998,
-17744,
-17642,
-17410,
-16864,
-16126,
-15521,
-15314,
-15567,
-16064,
-16452,
-16520,
-16230,
-15800,
-15452,
-15317,
-15319,
-15286,
-15062,
-14661,
-14226,
-13948,
-13873,
-13921,
-13903,
-13776,
-13626,
-13706,
-14172,
-15005,
-15957,
-16735,
-17204,
-17431,
-17655,
-18046,
-18664,
-19386,
-20115,
-20770,
-21408,
-22028,
-22625,
-23106,
-23413,
-23600,
-23773,
-24107,
-24642,
-25395,
-26234,
-27090,
-27882,
-28599,
-29244,
-29842,
-30433,
-31079,
-31838,
-32737,
-33740,
-34756,
-35662,
-36377,
-36884,
-37254,
-37600,
-38027,
-38574,
-39205,
-39844,
-40421,
-40930,
-41389,
-41821,
-42218,
-42512,
-42694,
-42790,
-42926,
-43198,
-43641,
-44126,
-44493,
-44599,
-44479,
-44303,
-44263,
-44456,
-44789,
-45088,
-45211,
-45163,
-45081,
-45087,
-45226,
-45372,
-45414,
-45322,
-45204,
-45236,
-45462,
-45774,
-45932,
-45758,
-45243,
-44586,
-43999,
-43622,
-43402,
-43205,
-42928,
-42569,
-42197,
-41870,
-41566,
-41207,
-40767,
-40251,
-39798,
-39478,
-39337,
-39317,
-39295,
-39183,
-38916,
-38506,
-38013,
-37508,
-37060,
-36662,
-36289,
-35873,
-35388,
-34864,
-34329,
-33833,
-33326,
-32792,
-32207,
-31665,
-31258,
-31071,
-31060,
-31105,
-31081,
-30955,
-30783,
-30665,
-30656,
-30706,
-30749,
-30701,
-30578,
-30416,
-30266,
-30137,
-29991,
-29791,
-29488,
-29102,
-28654,
-28240,
-27896,
-27642,
-27414,
-27102,
-26684,
-26194,
-25834,
-25725,
-25893,
-26178,
-26360,
-26327,
-26161,
-26052,
-26149,
-26377,
-26528,
-26420,
-26067,
-25726,
-25633,
-25874,
-26232,
-26410,
-26207,
-25746,
-25307,
-25166,
-25342,
-25643,
-25810,
-25775,
-25686,
-25776,
-26167,
-26734,
-27199,
-27365,
-27223,
-27001,
-26952,
-27160,
-27499,
-27725,
-27674,
-27379,
-27042,
-26841,
-26840,
-26914,
-26913,
-26791,
-26657,
-26703,
-27041,
-27605,
-28195,
-28612,
-28789,
-28824,
-28898,
-29110,
-29426,
-29708,
-29838,
-29825,
-29798,
-29908,
-30207,
-30602,
-30926,
-31087,
-31126,
-31222,
-31521,
-32057,
-32695,
-33270,
-33700,
-34075,
-34547,
-35218,
-36003,
-36695,
-37094,
-37137,
-36942,
-36679,
-36466,
-36289,
-36068,
-35773,
-35483,
-35354,
-35519,
-35975,
-36606,
-37223,
-37705,
-38043,
-38337,
-38726,
-39296,
-40027,
-40797,
-41480,
-41973,
-42313,
-42557,
-42769,
-42905,
-42869,
-42576,
-42086,
-41571,
-41253,
-41245,
-41467,
-41737,
-41884,
-41913,
-41943,
-42163,
-42607,
-43198,
-43752,
-44122,
-44309,
-44342,
-44338,
-44257,
-44082,
-43693,
-43098,
-42328,
-41527,
-40823,
-40300,
-39950,
-39664,
-39350,
-38945,
-38539,
-38266,
-38241,
-38438,
-38690,
-38779,
-38585,
-38168,
-37696,
-37331,
-37070,
-36791,
-36330,
-35646,
-34845,
-34088,
-33464,
-32885,
-32185,
-31245,
-30130,
-29103,
-28438,
-28282,
-28520,
-28882,
-29081,
-28997,
-28691,
-28333,
-27979,
-27614,
-27072,
-26318,
-25432,
-24626,
-24078,
-23777,
-23536,
-23147,
-22517,
-21814,
-21246,
-21016,
-21067,
-21250,
-21365,
-21387,
-21384,
-21464,
-21627,
-21781,
-21830,
-21776,
-21701,
-21692,
-21702,
-21597,
-21250,
-20657,
-19999,
-19460,
-19164,
-19042,
-18995,
-18977,
-19082,
-19441,
-20061,
-20778,
-21356,
-21665,
-21855,
-22183,
-22886,
-23872,
-24840,
-25433,
-25543,
-25390,
-25321,
-25581,
-26094,
-26617,
-26944,
-27128,
-27417,
-28017,
-28877,
-29696,
-30129,
-30110,
-29869,
-29850,
-30307,
-31227,
-32269,
-33105,
-33587,
-33811,
-34009,
-34299,
-34660,
-34933,
-35033,
-34993,
-35016,
-35250,
-35774,
-36441,
-37077,
-37533,
-37839,
-38163,
-38688,
-39478,
-40404,
-41242,
-41798,
-42062,
-42191,
-42374,
-42735,
-43208,
-43696,
-44102,
-44457,
-44810,
-45171,
-45440,
-45473,
-45215,
-44733,
-44224,
-43842,
-43655,
-43583,
-43527,
-43390,
-43146,
-42802,
-42382,
-41929,
-41511,
-41204,
-41037,
-40954,
-40865,
-40664,
-40357,
-39981,
-39599,
-39205,
-38799,
-38388,
-38101,
-38050,
-38260,
-38584,
-38775,
-38652,
-38254,
-37785,
-37502,
-37486,
-37667,
-37845,
-37973,
-38060,
-38248,
-38512,
-38732,
-38686,
-38286,
-37593,
-36840,
-36192,
-35663,
-35127,
-34413,
-33491,
-32490,
-31588,
-30953,
-30558,
-30345,
-30163,
-29972,
-29748,
-29520,
-29294,
-29072,
-28860,
-28691,
-28598,
-28618,
-28743,
-28935,
-29134,
-29247,
-29179,
-28888,
-28377,
-27811,
-27363,
-27223,
-27411,
-27821,
-28257,
-28598,
-28839,
-29062,
-29347,
-29642,
-29855,
-29901,
-29815,
-29721,
-29711,
-29725,
-29611,
-29198,
-28475,
-27627,
-26851,
-26312,
-25974,
-25737,
-25522,
-25366,
-25344,
-25531,
-25874,
-26294,
-26723,
-27160,
-27654,
-28187,
-28719,
-29125,
-29376,
-29474,
-29512,
-29545,
-29608,
-29703,
-29817,
-29966,
-30129,
-30275,
-30370,
-30406,
-30449,
-30598,
-30937,
-31473,
-32161,
-32894,
-33593,
-34147,
-34506,
-34598,
-34444,
-34086,
-33622,
-33113,
-32598,
-32064,
-31567,
-31133,
-30834,
-30628,
-30456,
-30229,
-30004,
-29907,
-30102,
-30603,
-31245,
-31793,
-32096,
-32224,
-32374,
-32708,
-33166,
-33528,
-33583,
-33309,
-32918,
-32674,
-32691,
-32824,
-32835,
-32571,
-32144,
-31861,
-31954,
-32448,
-33066,
-33495,
-33568,
-33424,
-33358,
-33602,
-34132,
-34666,
-34903,
-34682,
-34168,
-33610,
-33232,
-32997,
-32714,
-32233,
-31580,
-31030,
-30870,
-31215,
-31885,
-32537,
-32878,
-32863,
-32699,
-32634,
-32817,
-33141,
-33419,
-33473,
-33333,
-33142,
-33063,
-33117,
-33179,
-33064,
-32683,
-32116,
-31550,
-31173,
-31022,
-31022,
-31032,
-31018,
-31036,
-31223,
-31649,
-32242,
-32862,
-33321,
-33580,
-33643,
-33604,
-33491,
-33318,
-33096,
-32888,
-32794,
-32863,
-33054,
-33251,
-33354,
-33361,
-33362,
-33444,
-33632,
-33821,
-33967,
-34049,
-34204,
-34519,
-34977,
-35429,
-35665,
-35641,
-35453,
-35356,
-35471,
-35784,
-36071,
-36149,
-35964,
-35674,
-35492,
-35541,
-35767,
-36012,
-36162,
-36253,
-36427,
-36806,
-37361,
-37902,
-38225,
-38215,
-37998,
-37776,
-37738,
-37915,
-38159,
-38332,
-38349,
-38305,
-38312,
-38484,
-38754,
-39043,
-39226,
-39301,
-39305,
-39302,
-39298,
-39270,
-39192,
-39053,
-38902,
-38753,
-38636,
-38541,
-38475,
-38397,
-38256,
-37963,
-37475,
-36852,
-36266,
-35908,
-35888,
-36120,
-36425,
-36625,
-36689,
-36712,
-36796,
-36938,
-37007,
-36867,
-36529,
-36149,
-35934,
-35973,
-36139,
-36213,
-36017,
-35577,
-35041,
-34622,
-34348,
-34165,
-33904,
-33493,
-32974,
-32446,
-32018,
-31689,
-31394,
-31048,
-30618,
-30125,
-29641,
-29200,
-28800,
-28376,
-27864,
-27259,
-26621,
-26080,
-25743,
-25614,
-25615,
-25596,
-25463,
-25214,
-24926,
-24671,
-24480,
-24291,
-24086,
-23861,
-23697,
-23631,
-23613,
-23546,
-23302,
-22912,
-22474,
-22153,
-22011,
-22014,
-22042,
-22050,
-22046,
-22120,
-22281,
-22464,
-22573,
-22546,
-22490,
-22515,
-22739,
-23068,
-23364,
-23452,
-23323,
-23093,
-22917,
-22889,
-22970,
-23061,
-23130,
-23203,
-23395,
-23740,
-24220,
-24712,
-25159,
-25544,
-25954,
-26484,
-27133,
-27871,
-28562,
-29142,
-29574,
-29919,
-30241,
-30624,
-31064,
-31536,
-31955,
-32264,
-32445,
-32551,
-32645,
-32783,
-32967,
-33174,
-33406,
-33731,
-34213,
-34899,
-35683,
-36401,
-36886,
-37117,
-37229,
-37431,
-37835,
-38428,
-39033,
-39555,
-39968,
-40405,
-40935,
-41556,
-42070,
-42374,
-42433,
-42447,
-42621,
-43033,
-43578,
-44005,
-44180,
-44149,
-44116,
-44279,
-44631,
-45015,
-45215,
-45155,
-44929,
-44705,
-44581,
-44519,
-44389,
-44153,
-43853,
-43669,
-43693,
-43920,
-44181,
-44291,
-44140,
-43756,
-43268,
-42841,
-42552,
-42424,
-42365,
-42284,
-42121,
-41868,
-41592,
-41316,
-41049,
-40699,
-40231,
-39646,
-39084,
-38673,
-38468,
-38352,
-38149,
-37730,
-37154,
-36618,
-36292,
-36221,
-36219,
-36103,
-35756,
-35254,
-34749,
-34311,
-33912,
-33433,
-32842,
-32230,
-31744,
-31472,
-31330,
-31146,
-30760,
-30166,
-29473,
-28850,
-28394,
-28107,
-27946,
-27849,
-27800,
-27782,
-27774,
-27746,
-27677,
-27565,
-27426,
-27288,
-27171,
-27094,
-27050,
-26990,
-26838,
-26520,
-26027,
-25450,
-24928,
-24569,
-24368,
-24236,
-24037,
-23757,
-23412,
-23111,
-22869,
-22669,
-22482,
-22324,
-22297,
-22464,
-22827,
-23239,
-23559,
-23681,
-23654,
-23577,
-23565,
-23628,
-23751,
-23873,
-23990,
-24096,
-24184,
-24218,
-24165,
-24045,
-23922,
-23891,
-24005,
-24240,
-24536,
-24797,
-24977,
-25047,
-25053,
-25021,
-25030,
-25105,
-25274,
-25523,
-25808,
-26101,
-26339,
-26494,
-26513,
-26399,
-26175,
-25970,
-25895,
-26047,
-26407,
-26828,
-27189,
-27378,
-27471,
-27554,
-27737,
-28009,
-28285,
-28502,
-28649,
-28816,
-29082,
-29451,
-29824,
-30082,
-30175,
-30187,
-30272,
-30574,
-31051,
-31574,
-31918,
-31983,
-31820,
-31628,
-31597,
-31812,
-32202,
-32597,
-32902,
-33102,
-33307,
-33563,
-33844,
-33997,
-33921,
-33643,
-33355,
-33329,
-33678,
-34359,
-35105,
-35700,
-36043,
-36250,
-36501,
-36940,
-37532,
-38160,
-38694,
-39120,
-39544,
-40076,
-40748,
-41464,
-42038,
-42399,
-42553,
-42686,
-42927,
-43327,
-43734,
-43982,
-43934,
-43681,
-43414,
-43342,
-43540,
-43911,
-44300,
-44604,
-44852,
-45128,
-45481,
-45844,
-46096,
-46182,
-46161,
-46193,
-46417,
-46838,
-47337,
-47758,
-47978,
-48017,
-47934,
-47821,
-47722,
-47659,
-47629,
-47634,
-47661,
-47699,
-47743,
-47780,
-47827,
-47859,
-47876,
-47859,
-47860,
-47921,
-48085,
-48289,
-48411,
-48321,
-47995,
-47521,
-47048,
-46672,
-46362,
-46025,
-45598,
-45088,
-44599,
-44147,
-43702,
-43158,
-42473,
-41717,
-41023,
-40501,
-40120,
-39786,
-39389,
-38908,
-38413,
-37946,
-37524,
-37073,
-36564,
-36004,
-35452,
-34929,
-34398,
-33759,
-32986,
-32096,
-31216,
-30423,
-29753,
-29153,
-28562,
-27952,
-27309,
-26649,
-25943,
-25168,
-24317,
-23413,
-22522,
-21692,
-20976,
-20376,
-19873,
-19392,
-18856,
-18190,
-17404,
-16571,
-15816,
-15198,
-14704,
-14248,
-13757,
-13278,
-12890,
-12670,
-12571,
-12454,
-12179,
-11745,
-11266,
-10901,
-10703,
-10576,
-10360,
-9964,
-9464,
-9006,
-8748,
-8672,
-8688,
-8645,
-8524,
-8359,
-8286,
-8337,
-8500,
-8686,
-8852,
-8997,
-9216,
-9563,
-10076,
-10680,
-11270,
-11728,
-12026,
-12205,
-12364,
-12593,
-12909,
-13275,
-13627,
-13963,
-14328,
-14798,
-15388,
-16058,
-16684,
-17242,
-17727,
-18275,
-18963,
-19814,
-20746,
-21648,
-22461,
-23206,
-23966,
-24792,
-25676,
-26542,
-27328,
-28006,
-28645,
-29309,
-30060,
-30851,
-31627,
-32311,
-32929,
-33575,
-34363,
-35349,
-36477,
-37620,
-38661,
-39582,
-40458,
-41392,
-42417,
-43465,
-44431,
-45255,
-45995,
-46785,
-47692,
-48706,
-49672,
-50467,
-51037,
-51472,
-51892,
-52400,
-52964,
-53509,
-53948,
-54278,
-54551,
-54865,
-55262,
-55733,
-56221,
-56648,
-56982,
-57237,
-57464,
-57717,
-57997,
-58264,
-58426,
-58470,
-58429,
-58434,
-58603,
-58942,
-59373,
-59720,
-59881,
-59856,
-59736,
-59617,
-59537,
-59446,
-59293,
-59082,
-58858,
-58731,
-58701,
-58725,
-58686,
-58479,
-58082,
-57524,
-56908,
-56294,
-55740,
-55218,
-54707,
-54160,
-53571,
-52977,
-52400,
-51880,
-51384,
-50866,
-50289,
-49633,
-48934,
-48215,
-47486,
-46741,
-45964,
-45178,
-44407,
-43690,
-43017,
-42370,
-41719,
-41031,
-40312,
-39496,
-38571,
-37518,
-36416,
-35383,
-34546,
-33889,
-33352,
-32754,
-32054,
-31250,
-30459,
-29723,
-29010,
-28219,
-27280,
-26231,
-25201,
-24294,
-23520,
-22760,
-21896,
-20854,
-19714,
-18606,
-17647,
-16870,
-16190,
-15510,
-14753,
-13927,
-13101,
-12363,
-11752,
-11262,
-10828,
-10417,
-10028,
-9730,
-9546,
-9463,
-9360,
-9094,
-8632,
-8011,
-7405,
-6921,
-6599,
-6337,
-6057,
-5708,
-5360,
-5091,
-4917,
-4791,
-4646,
-4448,
-4268,
-4154,
-4145,
-4179,
-4198,
-4158,
-4102,
-4099,
-4200,
-4403,
-4686,
-4977,
-5273,
-5504,
-5666,
-5724,
-5703,
-5676,
-5698,
-5858,
-6151,
-6609,
-7201,
-7938,
-8746,
-9540,
-10192,
-10653,
-10980,
-11316,
-11786,
-12436,
-13184,
-13933,
-14637,
-15355,
-16143,
-17040,
-17928,
-18702,
-19297,
-19784,
-20322,
-21036,
-21923,
-22877,
-23751,
-24518,
-25255,
-26116,
-27176,
-28404,
-29635,
-30728,
-31608,
-32354,
-33078,
-33866,
-34718,
-35564,
-36367,
-37166,
-38056,
-39114,
-40316,
-41526,
-42599,
-43450,
-44126,
-44761,
-45462,
-46302,
-47228,
-48204,
-49175,
-50118,
-51014,
-51818,
-52496,
-53060,
-53533,
-53990,
-54447,
-54912,
-55359,
-55802,
-56242,
-56700,
-57131,
-57500,
-57775,
-58033,
-58347,
-58829,
-59441,
-60108,
-60681,
-61121,
-61427,
-61701,
-61973,
-62264,
-62519,
-62730,
-62899,
-63063,
-63238,
-63386,
-63465,
-63432,
-63309,
-63135,
-62963,
-62818,
-62694,
-62577,
-62439,
-62278,
-62086,
-61868,
-61633,
-61400,
-61198,
-61037,
-60909,
-60764,
-60519,
-60109,
-59493,
-58718,
-57872,
-57073,
-56359,
-55739,
-55132,
-54522,
-53888,
-53282,
-52674,
-52003,
-51164,
-50130,
-49000,
-47971,
-47200,
-46707,
-46343,
-45916,
-45319,
-44582,
-43828,
-43106,
-42376,
-41519,
-40486,
-39343,
-38250,
-37306,
-36517,
-35748,
-34884,
-33903,
-32879,
-31924,
-31084,
-30308,
-29520,
-28644,
-27695,
-26714,
-25769,
-24903,
-24124,
-23431,
-22787,
-22169,
-21540,
-20874,
-20168,
-19399,
-18566,
-17662,
-16712,
-15807,
-15040,
-14486,
-14119,
-13850,
-13546,
-13150,
-12655,
-12135,
-11628,
-11160,
-10703,
-10271,
-9894,
-9608,
-9420,
-9258,
-9030,
-8679,
-8204,
-7681,
-7197,
-6794,
-6486,
-6226,
-6006,
-5797,
-5631,
-5504,
-5426,
-5365,
-5313,
-5260,
-5224,
-5253,
-5332,
-5479,
-5600,
-5671,
-5659,
-5621,
-5631,
-5747,
-5957,
-6193,
-6389,
-6529,
-6675,
-6903,
-7262,
-7713,
-8222,
-8739,
-9307,
-9960,
-10746,
-11594,
-12436,
-13140,
-13726,
-14224,
-14771,
-15426,
-16202,
-17017,
-17783,
-18429,
-18976,
-19469,
-19963,
-20473,
-20964,
-21430,
-21888,
-22424,
-23106,
-23955,
-24896,
-25808,
-26603,
-27261,
-27866,
-28487,
-29175,
-29905,
-30643,
-31360,
-32069,
-32785,
-33514,
-34231,
-34922,
-35570,
-36191,
-36788,
-37366,
-37929,
-38502,
-39127,
-39838,
-40603,
-41401,
-42155,
-42901,
-43657,
-44458,
-45288,
-46044,
-46663,
-47129,
-47515,
-47924,
-48425,
-48990,
-49569,
-50109,
-50592,
-51045,
-51456,
-51804,
-52065,
-52234,
-52374,
-52519,
-52731,
-52996,
-53319,
-53683,
-54080,
-54476,
-54815,
-55060,
-55186,
-55251,
-55305,
-55404,
-55550,
-55712,
-55862,
-55998,
-56111,
-56231,
-56336,
-56430,
-56491,
-56512,
-56461,
-56332,
-56141,
-55945,
-55801,
-55737,
-55676,
-55549,
-55284,
-54940,
-54602,
-54349,
-54133,
-53820,
-53311,
-52601,
-51865,
-51247,
-50827,
-50488,
-50075,
-49476,
-48755,
-48046,
-47466,
-46999,
-46529,
-45952,
-45258,
-44538,
-43924,
-43438,
-43051,
-42633,
-42119,
-41490,
-40809,
-40157,
-39569,
-39067,
-38581,
-38081,
-37515,
-36906,
-36285,
-35721,
-35206,
-34733,
-34223,
-33658,
-33052,
-32480,
-31993,
-31590,
-31222,
-30793,
-30296,
-29708,
-29121,
-28523,
-27949,
-27330,
-26666,
-25943,
-25208,
-24501,
-23848,
-23252,
-22684,
-22127,
-21546,
-20958,
-20344,
-19750,
-19161,
-18615,
-18107,
-17672,
-17318,
-17065,
-16869,
-16700,
-16498,
-16256,
-15982,
-15686,
-15378,
-15023,
-14640,
-14253,
-13963,
-13807,
-13791,
-13814,
-13797,
-13691,
-13553,
-13459,
-13446,
-13472,
-13471,
-13395,
-13299,
-13268,
-13370,
-13600,
-13875,
-14115,
-14282,
-14387,
-14484,
-14584,
-14693,
-14797,
-14874,
-14936,
-15022,
-15146,
-15398,
-15761,
-16242,
-16756,
-17218,
-17588,
-17876,
-18169,
-18525,
-18943,
-19384,
-19789,
-20188,
-20630,
-21176,
-21806,
-22446,
-22997,
-23445,
-23823,
-24202,
-24621,
-25063,
-25510,
-25961,
-26421,
-26925,
-27418,
-27901,
-28333,
-28764,
-29215,
-29698,
-30163,
-30561,
-30891,
-31205,
-31555,
-31969,
-32376,
-32749,
-33055,
-33376,
-33762,
-34237,
-34747,
-35224,
-35640,
-36025,
-36427,
-36852,
-37294,
-37699,
-38108,
-38520,
-38970,
-39414,
-39820,
-40166,
-40509,
-40897,
-41357,
-41815,
-42211,
-42491,
-42724,
-42956,
-43246,
-43521,
-43745,
-43868,
-43974,
-44137,
-44418,
-44780,
-45139,
-45413,
-45587,
-45663,
-45683,
-45649,
-45592,
-45545,
-45546,
-45588,
-45649,
-45670,
-45672,
-45672,
-45727,
-45770,
-45735,
-45504,
-45115,
-44679,
-44338,
-44158,
-44053,
-43900,
-43630,
-43285,
-43000,
-42847,
-42791,
-42711,
-42479,
-42090,
-41603,
-41137,
-40745,
-40432,
-40167,
-39917,
-39680,
-39462,
-39275,
-39122,
-38996,
-38862,
-38681,
-38399,
-38019,
-37601,
-37252,
-37053,
-37018,
-37070,
-37105,
-37080,
-36995,
-36909,
-36846,
-36770,
-36640,
-36418,
-36126,
-35801,
-35507,
-35223,
-34980,
-34731,
-34485,
-34231,
-33946,
-33630,
-33273,
-32916,
-32570,
-32244,
-31894,
-31508,
-31063,
-30630,
-30247,
-29977,
-29798,
-29695,
-29596,
-29474,
-29313,
-29127,
-28947,
-28816,
-28732,
-28691,
-28644,
-28580,
-28520,
-28538,
-28673,
-28938,
-29222,
-29468,
-29592,
-29679,
-29782,
-29962,
-30180,
-30337,
-30392,
-30331,
-30260,
-30210,
-30243,
-30299,
-30380,
-30459,
-30543,
-30625,
-30661,
-30642,
-30573,
-30521,
-30510,
-30548,
-30583,
-30603,
-30658,
-30819,
-31144,
-31571,
-32004,
-32325,
-32539,
-32709,
-32923,
-33221,
-33546,
-33846,
-34106,
-34357,
-34670,
-35070,
-35534,
-36030,
-36503,
-36937,
-37302,
-37583,
-37776,
-37894,
-37983,
-38037,
-38073,
-38046,
-37992,
-37933,
-37939,
-37986,
-38042,
-38001,
-37841,
-37586,
-37289,
-37002,
-36711,
-36403,
-36117,
-35889,
-35807,
-35836,
-35930,
-36014,
-36073,
-36162,
-36298,
-36472,
-36594,
-36614,
-36568,
-36556,
-36665,
-36901,
-37161,
-37377,
-37539,
-37714,
-37974,
-38283,
-38541,
-38646,
-38573,
-38406,
-38227,
-38092,
-37949,
-37768,
-37537,
-37294,
-37093,
-36914,
-36710,
-36428,
-36037,
-35560,
-35015,
-34414,
-33772,
-33126,
-32522,
-32000,
-31553,
-31127,
-30700,
-30280,
-29910,
-29619,
-29363,
-29052,
-28650,
-28156,
-27696,
-27317,
-27068,
-26840,
-26608,
-26309,
-26035,
-25831,
-25720,
-25643,
-25498,
-25246,
-24881,
-24484,
-24085,
-23731,
-23386,
-23050,
-22710,
-22379,
-22088,
-21839,
-21625,
-21417,
-21179,
-20885,
-20542,
-20154,
-19770,
-19392,
-19035,
-18700,
-18384,
-18139,
-17959,
-17870,
-17804,
-17745,
-17644,
-17559,
-17498,
-17487,
-17473,
-17402,
-17256,
-17089,
-16997,
-17049,
-17230,
-17446,
-17605,
-17669,
-17687,
-17735,
-17836,
-17951,
-17990,
-17879,
-17651,
-17408,
-17272,
-17320,
-17520,
-17779,
-18004,
-18147,
-18258,
-18400,
-18610,
-18875,
-19089,
-19224,
-19256,
-19284,
-19416,
-19715,
-20172,
-20702,
-21217,
-21687,
-22101,
-22519,
-22944,
-23382,
-23796,
-24177,
-24516,
-24852,
-25214,
-25655,
-26200,
-26864,
-27601,
-28343,
-29022,
-29594,
-30072,
-30510,
-30942,
-31389,
-31835,
-32259,
-32689,
-33159,
-33718,
-34381,
-35126,
-35897,
-36644,
-37313,
-37885,
-38374,
-38815,
-39279,
-39820,
-40428,
-41084,
-41696,
-42263,
-42800,
-43389,
-44067,
-44803,
-45485,
-46007,
-46345,
-46552,
-46768,
-47060,
-47450,
-47846,
-48179,
-48421,
-48638,
-48904,
-49288,
-49742,
-50198,
-50530,
-50697,
-50729,
-50725,
-50794,
-50991,
-51286,
-51598,
-51880,
-52105,
-52366,
-52709,
-53164,
-53671,
-54119,
-54457,
-54682,
-54880,
-55110,
-55406,
-55721,
-56008,
-56256,
-56478,
-56734,
-57018,
-57313,
-57562,
-57737,
-57830,
-57849,
-57782,
-57607,
-57312,
-56935,
-56548,
-56232,
-56002,
-55828,
-55614,
-55327,
-54939,
-54514,
-54070,
-53628,
-53135,
-52553,
-51871,
-51157,
-50483,
-49951,
-49553,
-49276,
-49017,
-48715,
-48364,
-47969,
-47613,
-47284,
-46972,
-46596,
-46111,
-45505,
-44882,
-44322,
-43925,
-43658,
-43446,
-43192,
-42825,
-42370,
-41856,
-41315,
-40720,
-40018,
-39189,
-38278,
-37381,
-36585,
-35924,
-35349,
-34784,
-34170,
-33490,
-32760,
-32000,
-31164,
-30270,
-29282,
-28295,
-27356,
-26537,
-25827,
-25179,
-24556,
-23946,
-23398,
-22943,
-22564,
-22192,
-21732,
-21140,
-20446,
-19750,
-19130,
-18635,
-18221,
-17825,
-17408,
-16973,
-16572,
-16232,
-15931,
-15577,
-15085,
-14413,
-13617,
-12809,
-12101,
-11536,
-11070,
-10628,
-10145,
-9622,
-9102,
-8626,
-8197,
-7770,
-7293,
-6753,
-6177,
-5625,
-5131,
-4707,
-4331,
-4007,
-3731,
-3533,
-3424,
-3382,
-3393,
-3420,
-3467,
-3532,
-3605,
-3680,
-3726,
-3770,
-3825,
-3965,
-4205,
-4563,
-4985,
-5418,
-5801,
-6110,
-6368,
-6615,
-6889,
-7201,
-7512,
-7778,
-7978,
-8145,
-8357,
-8703,
-9189,
-9772,
-10333,
-10801,
-11189,
-11555,
-11998,
-12509,
-13032,
-13452,
-13739,
-13950,
-14231,
-14706,
-15412,
-16267,
-17151,
-17937,
-18615,
-19217,
-19807,
-20433,
-21070,
-21711,
-22322,
-22935,
-23600,
-24371,
-25291,
-26311,
-27399,
-28425,
-29367,
-30184,
-30921,
-31635,
-32363,
-33128,
-33913,
-34711,
-35517,
-36357,
-37249,
-38205,
-39232,
-40285,
-41339,
-42319,
-43175,
-43882,
-44465,
-45027,
-45650,
-46416,
-47290,
-48196,
-49056,
-49835,
-50585,
-51377,
-52206,
-53032,
-53701,
-54172,
-54461,
-54715,
-55095,
-55686,
-56431,
-57202,
-57837,
-58317,
-58687,
-59090,
-59598,
-60203,
-60774,
-61209,
-61452,
-61596,
-61770,
-62091,
-62554,
-63065,
-63500,
-63790,
-63994,
-64186,
-64469,
-64809,
-65133,
-65343,
-65392,
-65341,
-65259,
-65243,
-65292,
-65388,
-65471,
-65495,
-65448,
-65322,
-65141,
-64911,
-64672,
-64419,
-64165,
-63879,
-63525,
-63107,
-62629,
-62134,
-61676,
-61267,
-60907,
-60539,
-60144,
-59692,
-59226,
-58802,
-58427,
-58106,
-57729,
-57246,
-56611,
-55917,
-55269,
-54796,
-54487,
-54243,
-53919,
-53420,
-52772,
-52095,
-51479,
-50942,
-50395,
-49706,
-48864,
-47909,
-47003,
-46227,
-45593,
-44996,
-44320,
-43503,
-42574,
-41615,
-40697,
-39822,
-38932,
-37946,
-36845,
-35662,
-34508,
-33472,
-32580,
-31800,
-31040,
-30240,
-29398,
-28534,
-27688,
-26855,
-25998,
-25111,
-24209,
-23390,
-22689,
-22145,
-21671,
-21213,
-20717,
-20196,
-19686,
-19195,
-18678,
-18094,
-17424,
-16731,
-16094,
-15566,
-15139,
-14726,
-14271,
-13736,
-13183,
-12649,
-12185,
-11743,
-11274,
-10719,
-10076,
-9399,
-8765,
-8220,
-7777,
-7379,
-6984,
-6544,
-6103,
-5681,
-5330,
-5025,
-4711,
-4349,
-3949,
-3583,
-3332,
-3221,
-3200,
-3186,
-3129,
-3041,
-2986,
-2994,
-3060,
-3119,
-3139,
-3150,
-3205,
-3362,
-3592,
-3830,
-3993,
-4061,
-4096,
-4172,
-4345,
-4605,
-4886,
-5143,
-5344,
-5539,
-5764,
-6076,
-6430,
-6799,
-7088,
-7299,
-7465,
-7671,
-7996,
-8435,
-8919,
-9370,
-9723,
-10053,
-10419,
-10910,
-11488,
-12062,
-12550,
-12906,
-13224,
-13588,
-14076,
-14672,
-15316,
-15955,
-16575,
-17198,
-17851,
-18497,
-19119,
-19663,
-20145,
-20606,
-21081,
-21601,
-22165,
-22763,
-23393,
-24071,
-24767,
-25476,
-26123,
-26707,
-27204,
-27670,
-28148,
-28689,
-29290,
-29937,
-30569,
-31166,
-31728,
-32298,
-32937,
-33635,
-34353,
-34974,
-35444,
-35786,
-36102,
-36528,
-37084,
-37715,
-38299,
-38760,
-39167,
-39605,
-40182,
-40848,
-41509,
-42039,
-42434,
-42760,
-43133,
-43627,
-44213,
-44863,
-45492,
-46099,
-46653,
-47180,
-47688,
-48203,
-48753,
-49319,
-49869,
-50362,
-50788,
-51203,
-51653,
-52160,
-52683,
-53143,
-53519,
-53813,
-54094,
-54386,
-54697,
-55004,
-55283,
-55539,
-55757,
-55926,
-56032,
-56093,
-56146,
-56258,
-56397,
-56534,
-56591,
-56568,
-56530,
-56543,
-56655,
-56811,
-56955,
-57021,
-57014,
-56974,
-56935,
-56913,
-56919,
-56940,
-56967,
-56999,
-57004,
-57020,
-57058,
-57167,
-57327,
-57464,
-57501,
-57393,
-57196,
-57022,
-56946,
-56978,
-57039,
-57049,
-56971,
-56844,
-56700,
-56572,
-56408,
-56175,
-55830,
-55377,
-54865,
-54315,
-53796,
-53295,
-52856,
-52416,
-51986,
-51510,
-51009,
-50490,
-49978,
-49491,
-49005,
-48508,
-47966,
-47415,
-46884,
-46435,
-46089,
-45827,
-45599,
-45343,
-45029,
-44658,
-44247,
-43823,
-43366,
-42882,
-42364,
-41848,
-41357,
-40897,
-40453,
-39997,
-39515,
-39016,
-38481,
-37898,
-37225,
-36486,
-35714,
-34979,
-34303,
-33654,
-32988,
-32298,
-31594,
-30955,
-30351,
-29782,
-29191,
-28574,
-27963,
-27369,
-26790,
-26196,
-25598,
-25035,
-24553,
-24136,
-23721,
-23242,
-22718,
-22204,
-21771,
-21377,
-20949,
-20418,
-19838,
-19303,
-18907,
-18598,
-18291,
-17910,
-17481,
-17097,
-16799,
-16543,
-16258,
-15896,
-15526,
-15213,
-14968,
-14725,
-14402,
-13974,
-13517,
-13067,
-12641,
-12187,
-11677,
-11157,
-10687,
-10279,
-9902,
-9488,
-9056,
-8658,
-8345,
-8095,
-7837,
-7525,
-7228,
-7025,
-6977,
-7018,
-7047,
-7009,
-6964,
-6985,
-7115,
-7269,
-7349,
-7323,
-7240,
-7182,
-7179,
-7189,
-7169,
-7131,
-7131,
-7203,
-7318,
-7399,
-7412,
-7365,
-7319,
-7292,
-7268,
-7220,
-7166,
-7163,
-7260,
-7462,
-7717,
-7980,
-8245,
-8518,
-8821,
-9124,
-9414,
-9689,
-9992,
-10362,
-10793,
-11257,
-11719,
-12160,
-12615,
-13080,
-13553,
-13998,
-14370,
-14680,
-14918,
-15156,
-15395,
-15687,
-16027,
-16391,
-16793,
-17187,
-17643,
-18132,
-18693,
-19260,
-19806,
-20312,
-20796,
-21325,
-21897,
-22535,
-23185,
-23847,
-24502,
-25151,
-25760,
-26318,
-26812,
-27291,
-27783,
-28294,
-28790,
-29263,
-29745,
-30300,
-30957,
-31673,
-32376,
-33030,
-33675,
-34383,
-35178,
-36002,
-36800,
-37542,
-38311,
-39136,
-40021,
-40859,
-41599,
-42258,
-42936,
-43663,
-44416,
-45047,
-45558,
-45990,
-46491,
-47096,
-47736,
-48301,
-48754,
-49184,
-49674,
-50249,
-50803,
-51264,
-51638,
-52035,
-52544,
-53130,
-53731,
-54265,
-54805,
-55413,
-56108,
-56798,
-57385,
-57854,
-58312,
-58852,
-59468,
-60070,
-60572,
-60988,
-61417,
-61889,
-62359,
-62704,
-62876,
-62944,
-62999,
-63094,
-63146,
-63104,
-62969,
-62857,
-62854,
-62939,
-63017,
-63004,
-62946,
-62937,
-63041,
-63219,
-63337,
-63381,
-63361,
-63420,
-63564,
-63770,
-63915,
-63994,
-64005,
-64015,
-64004,
-63909,
-63706,
-63402,
-63081,
-62766,
-62460,
-62114,
-61741,
-61379,
-61067,
-60802,
-60496,
-60109,
-59640,
-59145,
-58697,
-58279,
-57852,
-57382,
-56857,
-56335,
-55814,
-55295,
-54728,
-54089,
-53382,
-52622,
-51843,
-51041,
-50230,
-49411,
-48590,
-47773,
-46969,
-46180,
-45404,
-44648,
-43888,
-43112,
-42346,
-41567,
-40829,
-40090,
-39369,
-38650,
-37962,
-37334,
-36758,
-36205,
-35629,
-35017,
-34377,
-33744,
-33099,
-32430,
-31735,
-31015,
-30325,
-29646,
-28950,
-28211,
-27401,
-26576,
-25732,
-24858,
-23907,
-22872,
-21826,
-20852,
-20005,
-19216,
-18429,
-17596,
-16802,
-16120,
-15576,
-15087,
-14566,
-14002,
-13466,
-13047,
-12745,
-12475,
-12162,
-11794,
-11457,
-11176,
-10931,
-10627,
-10218,
-9754,
-9291,
-8878,
-8450,
-7965,
-7434,
-6933,
-6540,
-6232,
-5930,
-5577,
-5204,
-4879,
-4651,
-4455,
-4220,
-3948,
-3694,
-3586,
-3590,
-3642,
-3627,
-3548,
-3493,
-3521,
-3642,
-3731,
-3745,
-3714,
-3752,
-3943,
-4246,
-4570,
-4842,
-5083,
-5371,
-5725,
-6130,
-6500,
-6834,
-7166,
-7549,
-8003,
-8467,
-8936,
-9404,
-9919,
-10490,
-11076,
-11609,
-12103,
-12569,
-13080,
-13620,
-14143,
-14607,
-15029,
-15459,
-15962,
-16504,
-17035,
-17494,
-17880,
-18249,
-18630,
-19031,
-19416,
-19777,
-20136,
-20550,
-21051,
-21641,
-22281,
-22946,
-23616,
-24299,
-25013,
-25752,
-26517,
-27303,
-28094,
-28899,
-29698,
-30505,
-31301,
-32086,
-32828,
-33514,
-34135,
-34700,
-35228,
-35736,
-36238,
-36722,
-37210,
-37680,
-38150,
-38623,
-39099,
-39598,
-40112,
-40627,
-41122,
-41596,
-42057,
-42544,
-43071,
-43616,
-44163,
-44682,
-45205,
-45747,
-46320,
-46873,
-47381,
-47798,
-48190,
-48566,
-48974,
-49367,
-49735,
-50058,
-50382,
-50723,
-51089,
-51400,
-51658,
-51807,
-51935,
-52024,
-52117,
-52165,
-52175,
-52156,
-52136,
-52116,
-52091,
-52030,
-51964,
-51903,
-51873,
-51840,
-51778,
-51672,
-51569,
-51494,
-51453,
-51403,
-51281,
-51110,
-50928,
-50804,
-50737,
-50674,
-50569,
-50420,
-50272,
-50180,
-50119,
-50061,
-49954,
-49820,
-49697,
-49620,
-49563,
-49498,
-49387,
-49278,
-49182,
-49130,
-49074,
-48968,
-48806,
-48586,
-48344,
-48066,
-47718,
-47284,
-46768,
-46217,
-45670,
-45139,
-44615,
-44098,
-43589,
-43106,
-42636,
-42159,
-41658,
-41121,
-40581,
-40060,
-39548,
-39058,
-38556,
-38086,
-37653,
-37282,
-36940,
-36613,
-36265,
-35902,
-35532,
-35145,
-34750,
-34316,
-33864,
-33388,
-32931,
-32468,
-32036,
-31600,
-31208,
-30831,
-30489,
-30135,
-29744,
-29310,
-28834,
-28348,
-27870,
-27390,
-26917,
-26440,
-25990,
-25598,
-25285,
-25040,
-24839,
-24633,
-24438,
-24236,
-24077,
-23936,
-23804,
-23666,
-23495,
-23342,
-23202,
-23110,
-23041,
-22966,
-22891,
-22794,
-22718,
-22621,
-22511,
-22326,
-22099,
-21818,
-21549,
-21298,
-21050,
-20812,
-20562,
-20342,
-20155,
-20002,
-19850,
-19660,
-19417,
-19137,
-18835,
-18546,
-18243,
-17947,
-17634,
-17344,
-17080,
-16857,
-16673,
-16517,
-16385,
-16278,
-16187,
-16131,
-16101,
-16109,
-16155,
-16248,
-16378,
-16572,
-16811,
-17128,
-17486,
-17878,
-18269,
-18669,
-19068,
-19481,
-19881,
-20245,
-20567,
-20861,
-21163,
-21503,
-21853,
-22187,
-22463,
-22693,
-22912,
-23136,
-23367,
-23555,
-23679,
-23743,
-23795,
-23873,
-23990,
-24128,
-24249,
-24373,
-24515,
-24710,
-24959,
-25231,
-25505,
-25761,
-26017,
-26278,
-26546,
-26821,
-27078,
-27348,
-27620,
-27933,
-28259,
-28596,
-28908,
-29193,
-29435,
-29645,
-29814,
-29942,
-30037,
-30097,
-30150,
-30222,
-30340,
-30520,
-30759,
-31050,
-31372,
-31717,
-32086,
-32478,
-32878,
-33273,
-33641,
-33985,
-34330,
-34697,
-35105,
-35550,
-36020,
-36501,
-37007,
-37520,
-38038,
-38520,
-38951,
-39312,
-39645,
-39959,
-40296,
-40636,
-40987,
-41344,
-41749,
-42214,
-42749,
-43308,
-43842,
-44315,
-44731,
-45106,
-45467,
-45794,
-46046,
-46210,
-46274,
-46307,
-46329,
-46372,
-46392,
-46357,
-46253,
-46097,
-45935,
-45764,
-45578,
-45329,
-45017,
-44666,
-44326,
-44044,
-43812,
-43633,
-43490,
-43409,
-43429,
-43553,
-43771,
-44033,
-44309,
-44586,
-44874,
-45176,
-45478,
-45744,
-45963,
-46140,
-46292,
-46466,
-46645,
-46837,
-46998,
-47132,
-47209,
-47250,
-47235,
-47169,
-47030,
-46819,
-46548,
-46251,
-45960,
-45728,
-45549,
-45444,
-45391,
-45381,
-45431,
-45513,
-45621,
-45706,
-45734,
-45699,
-45601,
-45463,
-45270,
-45027,
-44715,
-44354,
-43981,
-43605,
-43240,
-42831,
-42378,
-41870,
-41343,
-40802,
-40260,
-39663,
-39026,
-38349,
-37708,
-37128,
-36635,
-36193,
-35798,
-35441,
-35156,
-34947,
-34791,
-34646,
-34438,
-34171,
-33824,
-33433,
-33007,
-32515,
-31986,
-31398,
-30811,
-30266,
-29783,
-29373,
-29013,
-28664,
-28336,
-28000,
-27688,
-27386,
-27090,
-26793,
-26508,
-26262,
-26105,
-26069,
-26156,
-26340,
-26587,
-26856,
-27148,
-27429,
-27676,
-27829,
-27851,
-27728,
-27492,
-27183,
-26820,
-26422,
-25959,
-25452,
-24918,
-24390,
-23879,
-23356,
-22785,
-22150,
-21474,
-20794,
-20162,
-19579,
-19046,
-18571,
-18165,
-17880,
-17729,
-17704,
-17770,
-17863,
-17984,
-18103,
-18232,
-18352,
-18424,
-18430,
-18365,
-18250,
-18115,
-17969,
-17807,
-17626,
-17433,
-17259,
-17138,
-17061,
-17027,
-17006,
-16994,
-17029,
-17127,
-17307,
-17560,
-17850,
-18188,
-18575,
-19046,
-19602,
-20220,
-20857,
-21461,
-22030,
-22539,
-23008,
-23420,
-23752,
-24000,
-24145,
-24222,
-24252,
-24267,
-24279,
-24285,
-24282,
-24270,
-24263,
-24278,
-24333,
-24422,
-24549,
-24709,
-24916,
-25187,
-25534,
-25947,
-26402,
-26869,
-27337,
-27801,
-28259,
-28690,
-29062,
-29363,
-29591,
-29770,
-29923,
-30047,
-30123,
-30131,
-30074,
-29976,
-29863,
-29740,
-29607,
-29457,
-29322,
-29245,
-29273,
-29424,
-29708,
-30091,
-30596,
-31203,
-31924,
-32721,
-33555,
-34386,
-35197,
-35993,
-36779,
-37542,
-38274,
-38937,
-39542,
-40093,
-40599,
-41043,
-41407,
-41649,
-41778,
-41788,
-41737,
-41622,
-41496,
-41337,
-41189,
-41056,
-40998,
-41028,
-41173,
-41404,
-41704,
-42042,
-42407,
-42804,
-43208,
-43614,
-43976,
-44274,
-44498,
-44661,
-44780,
-44861,
-44890,
-44841,
-44728,
-44542,
-44326,
-44070,
-43776,
-43421,
-43009,
-42570,
-42131,
-41741,
-41407,
-41130,
-40930,
-40813,
-40824,
-40975,
-41252,
-41623,
-42049,
-42491,
-42956,
-43412,
-43855,
-44240,
-44556,
-44789,
-44957,
-45071,
-45152,
-45180,
-45171,
-45091,
-44971,
-44793,
-44571,
-44296,
-43976,
-43621,
-43257,
-42913,
-42607,
-42370,
-42205,
-42132,
-42163,
-42288,
-42508,
-42780,
-43090,
-43405,
-43693,
-43957,
-44151,
-44272,
-44287,
-44206,
-44004,
-43722,
-43327,
-42860,
-42290,
-41651,
-40929,
-40161,
-39349,
-38521,
-37685,
-36850,
-36043,
-35271,
-34578,
-33966,
-33464,
-33056,
-32758,
-32561,
-32475,
-32505,
-32626,
-32812,
-33028,
-33225,
-33418,
-33568,
-33681,
-33726,
-33671,
-33519,
-33276,
-32976,
-32651,
-32311,
-31939,
-31553,
-31140,
-30747,
-30389,
-30075,
-29796,
-29537,
-29306,
-29122,
-29016,
-29003,
-29074,
-29219,
-29426,
-29681,
-30001,
-30337,
-30687,
-30991,
-31226,
-31364,
-31401,
-31315,
-31119,
-30795,
-30359,
-29833,
-29223,
-28561,
-27851,
-27117,
-26363,
-25610,
-24863,
-24136,
-23440,
-22777,
-22175,
-21637,
-21176,
-20804,
-20514,
-20326,
-20223,
-20206,
-20254,
-20349,
-20466,
-20596,
-20705,
-20786,
-20811,
-20776,
-20676,
-20524,
-20324,
-20081,
-19822,
-19548,
-19304,
-19081,
-18919,
-18792,
-18734,
-18735,
-18824,
-19003,
-19265,
-19612,
-20024,
-20517,
-21091,
-21745,
-22457,
-23201,
-23949,
-24689,
-25404,
-26083,
-26698,
-27212,
-27616,
-27885,
-28042,
-28082,
-28021,
-27855,
-27594,
-27257,
-26862,
-26448,
-26012,
-25579,
-25150,
-24733,
-24351,
-24016,
-23742,
-23531,
-23391,
-23308,
-23303,
-23356,
-23484,
-23661,
-23889,
-24136,
-24399,
-24661,
-24915,
-25165,
-25391,
-25601,
-25774,
-25919,
-26041,
-26148,
-26264,
-26373,
-26502,
-26635,
-26799,
-27003,
-27267,
-27598,
-28006,
-28479,
-29032,
-29657,
-30371,
-31148,
-31993,
-32856,
-33741,
-34614,
-35486,
-36327,
-37142,
-37886,
-38577,
-39189,
-39742,
-40224,
-40629,
-40942,
-41162,
-41282,
-41325,
-41292,
-41196,
-41035,
-40834,
-40611,
-40387,
-40195,
-40023,
-39888,
-39791,
-39735,
-39726,
-39749,
-39794,
-39845,
-39899,
-39960,
-40021,
-40088,
-40143,
-40193,
-40234,
-40279,
-40324,
-40362,
-40382,
-40376,
-40343,
-40294,
-40229,
-40152,
-40070,
-39994,
-39944,
-39929,
-39968,
-40053,
-40199,
-40409,
-40679,
-41011,
-41379,
-41789,
-42213,
-42665,
-43124,
-43585,
-44033,
-44456,
-44855,
-45232,
-45578,
-45893,
-46150,
-46354,
-46495,
-46580,
-46592,
-46531,
-46377,
-46144,
-45847,
-45497,
-45113,
-44688,
-44237,
-43769,
-43312,
-42879,
-42476,
-42095,
-41725,
-41353,
-41005,
-40672,
-40359,
-40051,
-39748,
-39438,
-39148,
-38869,
-38618,
-38382,
-38152,
-37917,
-37680,
-37426,
-37162,
-36880,
-36569,
-36232,
-35876,
-35501,
-35140,
-34777,
-34441,
-34124,
-33828,
-33556,
-33315,
-33091,
-32902,
-32719,
-32561,
-32409,
-32272,
-32163,
-32065,
-31999,
-31936,
-31883,
-31828,
-31775,
-31719,
-31654,
-31570,
-31447,
-31289,
-31090,
-30860,
-30608,
-30322,
-30007,
-29657,
-29279,
-28897,
-28499,
-28117,
-27722,
-27328,
-26943,
-26564,
-26223,
-25905,
-25625,
-25367,
-25147,
-24958,
-24803,
-24677,
-24572,
-24486,
-24413,
-24361,
-24314,
-24267,
-24215,
-24142,
-24066,
-23966,
-23847,
-23692,
-23503,
-23277,
-23037,
-22785,
-22535,
-22284,
-22037,
-21802,
-21600,
-21427,
-21299,
-21201,
-21136,
-21113,
-21130,
-21197,
-21306,
-21460,
-21636,
-21858,
-22093,
-22361,
-22631,
-22904,
-23156,
-23387,
-23578,
-23733,
-23843,
-23911,
-23939,
-23925,
-23883,
-23807,
-23727,
-23641,
-23569,
-23511,
-23453,
-23410,
-23388,
-23400,
-23468,
-23583,
-23735,
-23934,
-24176,
-24471,
-24839,
-25246,
-25703,
-26156,
-26632,
-27090,
-27571,
-28024,
-28466,
-28852,
-29204,
-29493,
-29764,
-29990,
-30190,
-30360,
-30499,
-30627,
-30747,
-30866,
-30990,
-31105,
-31232,
-31350,
-31494,
-31644,
-31822,
-32020,
-32250,
-32503,
-32796,
-33115,
-33462,
-33817,
-34174,
-34506,
-34822,
-35088,
-35319,
-35491,
-35610,
-35686,
-35711,
-35718,
-35698,
-35680,
-35664,
-35663,
-35683,
-35725,
-35789,
-35876,
-35985,
-36129,
-36299,
-36529,
-36801,
-37138,
-37532,
-37978,
-38493,
-39053,
-39658,
-40284,
-40893,
-41477,
-42007,
-42486,
-42910,
-43273,
-43563,
-43780,
-43920,
-44009,
-44062,
-44086,
-44099,
-44063,
-44013,
-43919,
-43831,
-43733,
-43642,
-43537,
-43421,
-43305,
-43206,
-43146,
-43125,
-43134,
-43168,
-43221,
-43301,
-43400,
-43506,
-43598,
-43646,
-43649,
-43594,
-43495,
-43349,
-43146,
-42903,
-42605,
-42294,
-41969,
-41655,
-41356,
-41063,
-40788,
-40518,
-40267,
-40029,
-39816,
-39617,
-39448,
-39301,
-39192,
-39141,
-39147,
-39224,
-39361,
-39541,
-39762,
-39992,
-40239,
-40464,
-40659,
-40800,
-40875,
-40895,
-40853,
-40771,
-40632,
-40462,
-40246,
-40023,
-39790,
-39556,
-39308,
-39042,
-38759,
-38464,
-38166,
-37865,
-37551,
-37222,
-36884,
-36561,
-36262,
-35998,
-35749,
-35510,
-35266,
-35032,
-34788,
-34534,
-34235,
-33875,
-33436,
-32935,
-32374,
-31779,
-31148,
-30495,
-29827,
-29173,
-28557,
-28002,
-27514,
-27074,
-26693,
-26326,
-26022,
-25742,
-25525,
-25345,
-25208,
-25114,
-25080,
-25119,
-25247,
-25458,
-25728,
-26029,
-26345,
-26647,
-26937,
-27176,
-27352,
-27441,
-27442,
-27373,
-27251,
-27106,
-26927,
-26728,
-26505,
-26266,
-26038,
-25807,
-25573,
-25311,
-25017,
-24700,
-24385,
-24090,
-23826,
-23589,
-23381,
-23205,
-23089,
-23021,
-23018,
-23019,
-23036,
-23010,
-22973,
-22900,
-22790,
-22642,
-22431,
-22172,
-21880,
-21575,
-21271,
-20973,
-20669,
-20391,
-20132,
-19928,
-19776,
-19660,
-19585,
-19540,
-19547,
-19620,
-19774,
-19990,
-20265,
-20579,
-20951,
-21380,
-21870,
-22402,
-22934,
-23449,
-23921,
-24353,
-24746,
-25095,
-25399,
-25637,
-25827,
-25968,
-26087,
-26208,
-26322,
-26449,
-26558,
-26664,
-26767,
-26883,
-27015,
-27177,
-27351,
-27558,
-27785,
-28057,
-28377,
-28725,
-29101,
-29453,
-29802,
-30110,
-30399,
-30638,
-30819,
-30926,
-30976,
-30970,
-30956,
-30904,
-30830,
-30707,
-30550,
-30370,
-30186,
-30008,
-29824,
-29649,
-29487,
-29389,
-29374,
-29467,
-29674,
-29976,
-30374,
-30880,
-31468,
-32135,
-32835,
-33538,
-34234,
-34914,
-35587,
-36243,
-36865,
-37439,
-37967,
-38450,
-38904,
-39313,
-39667,
-39937,
-40116,
-40223,
-40272,
-40292,
-40287,
-40266,
-40243,
-40231,
-40271,
-40379,
-40570,
-40831,
-41143,
-41477,
-41845,
-42216,
-42598,
-42967,
-43285,
-43543,
-43722,
-43835,
-43904,
-43919,
-43894,
-43795,
-43645,
-43438,
-43206,
-42954,
-42667,
-42345,
-41973,
-41584,
-41197,
-40854,
-40551,
-40316,
-40129,
-40037,
-40048,
-40188,
-40447,
-40793,
-41186,
-41614,
-42043,
-42483,
-42895,
-43266,
-43570,
-43797,
-43970,
-44093,
-44186,
-44242,
-44257,
-44227,
-44156,
-44039,
-43887,
-43690,
-43443,
-43178,
-42890,
-42625,
-42386,
-42206,
-42087,
-42047,
-42097,
-42236,
-42449,
-42721,
-43006,
-43309,
-43574,
-43817,
-43988,
-44085,
-44088,
-43980,
-43780,
-43474,
-43094,
-42614,
-42068,
-41433,
-40743,
-39997,
-39218,
-38426,
-37616,
-36824,
-36038,
-35301,
-34623,
-34031,
-33538,
-33139,
-32839,
-32646,
-32549,
-32576,
-32683,
-32860,
-33055,
-33252,
-33420,
-33567,
-33665,
-33702,
-33646,
-33488,
-33249,
-32951,
-32631,
-32295,
-31936,
-31548,
-31151,
-30754,
-30405,
-30089,
-29812,
-29553,
-29319,
-29133,
-29024,
-29005,
-29076,
-29218,
-29425,
-29685,
-29994,
-30343,
-30683,
-30994,
-31224,
-31364,
-31400,
-31317,
-31116,
-30798,
-30358,
-29833,
-29224,
-28558,
-27856,
-27113,
-26367,
-25606,
-24866,
-24135,
-23438,
-22780,
-22173,
-21639,
-21176,
-20802,
-20517,
-20323,
-20226,
-20205,
-20254,
-20349,
-20465,
-20598,
-20703,
-20789,
-20809,
-20775,
-20678,
-20524,
-20324,
-20081,
-19822,
-19548,
-19302,
-19084,
-18916,
-18795,
-18732,
-18735,
-18826,
-19000,
-19269,
-19609,
-20024,
-20519,
-21090,
-21746,
-22456,
-23202,
-23948,
-24690,
-25403,
-26085,
-26696,
-27215,
-27614,
-27885,
-28043,
-28080,
-28024,
-27853,
-27594,
-27257,
-26862,
-26449,
-26011,
-25580,
-25149,
-24734,
-24352,
-24015,
-23742,
-23532,
-23391,
-23307,
-23305,
-23354,
-23483,
-23665,
-23885,
-24141,
-24398,
-24659,
-24919,
-25161,
-25395,
-25599,
-25773,
-25919,
-26040,
-26151,
-26260,
-26377,
-26497,
-26638,
-26797,
-27005,
-27266,
-27599,
-28005,
-28479,
-29032,
-29658,
-30370,
-31149,
-31992,
-32857,
-33740,
-34617,
-35483,
-36330,
-37139,
-37889,
-38575,
-39188,
-39744,
-40222,
-40630,
-40943,
-41159,
-41285,
-41324,
-41291,
-41196,
-41036,
-40833,
-40613,
-40387,
-40196,
-40020,
-39890,
-39789,
-39736,
-39726,
-39747,
-39798,
-39841,
-39901,
-39959,
-40021,
-40090,
-40141,
-40194,
-40233,
-40280,
-40323,
-40364,
-40381,
-40375,
-40345,
-40291,
-40232,
-40149,
-40071,
-39994,
-39944,
-39929,
-39968,
-40052,
-40202,
-40407,
-40680,
-41009,
-41381,
-41787,
-42215,
-42663,
-43125,
-43585,
-44034,
-44455,
-44855,
-45230,
-45580,
-45891,
-46154,
-46350,
-46498,
-46577,
-46594,
-46530,
-46377,
-46144,
-45846,
-45497,
-45113,
-44690,
-44236,
-43770,
-43312,
-42876,
-42479,
-42083,
-41711,
-41331,
-40976,
-40637,
-40318,
-40010,
-39698,
-39391,
-39091,
-38816,
-38566,
-38330,
-38106,
-37874,
-37639,
-37392,
-37133,
-36854,
-36540,
-36210,
-35840,
-35476,
-35103,
-34745,
-34409,
-34090,
-33806,
-33540,
-33311,
-33102,
-32924,
-32765,
-32618,
-32487,
-32370,
-32274,
-32205,
-32162,
-32131,
-32118,
-32101,
-32090,
-32078,
-32056,
-32015,
-31932,
-31806,
-31629,
-31414,
-31168,
-30885,
-30574,
-30215,
-29830,
-29428,
-29019,
-28612,
-28205,
-27793,
-27384,
-26984,
-26612,
-26273,
-25972,
-25701,
-25466,
-25272,
-25111,
-25007,
-24917,
-24868,
-24829,
-24813,
-24801,
-24795,
-24776,
-24739,
-24686,
-24606,
-24500,
-24363,
-24188,
-23987,
-23761,
-23531,
-23298,
-23067,
-22840,
-22630,
-22444,
-22301,
-22185,
-22116,
-22076,
-22079,
-22131,
-22235,
-22387,
-22582,
-22804,
-23063,
-23338,
-23639,
-23927,
-24207,
-24450,
-24658,
-24817,
-24930,
-24980,
-24982,
-24929,
-24833,
-24710,
-24551,
-24376,
-24196,
-24014,
-23861,
-23716,
-23603,
-23516,
-23475,
-23495,
-23589,
-23751,
-23991,
-24282,
-24651,
-25081,
-25587,
-26132,
-26704,
-27272,
-27833,
-28381,
-28907,
-29407,
-29845,
-30234,
-30549,
-30821,
-31052,
-31233,
-31386,
-31483,
-31559,
-31615,
-31665,
-31729,
-31792,
-31880,
-31976,
-32107,
-32279,
-32489,
-32750,
-33048,
-33381,
-33748,
-34133,
-34526,
-34921,
-35295,
-35640,
-35935,
-36166,
-36331,
-36418,
-36446,
-36404,
-36311,
-36153,
-35964,
-35732,
-35512,
-35283,
-35091,
-34903,
-34763,
-34652,
-34608,
-34628,
-34724,
-34884,
-35129,
-35440,
-35843,
-36325,
-36875,
-37474,
-38102,
-38746,
-39386,
-40011,
-40591,
-41114,
-41561,
-41931,
-42233,
-42468,
-42637,
-42751,
-42804,
-42821,
-42805,
-42775,
-42729,
-42675,
-42611,
-42553,
-42506,
-42477,
-42472,
-42487,
-42530,
-42600,
-42701,
-42828,
-42967,
-43102,
-43222,
-43298,
-43341,
-43312,
-43221,
-43029,
-42754,
-42375,
-41922,
-41398,
-40819,
-40193,
-39535,
-38848,
-38167,
-37495,
-36854,
-36258,
-35704,
-35206,
-34773,
-34406,
-34138,
-33945,
-33864,
-33856,
-33946,
-34102,
-34339,
-34628,
-34965,
-35322,
-35678,
-36015,
-36308,
-36569,
-36761,
-36913,
-36987,
-37015,
-36985,
-36919,
-36834,
-36724,
-36603,
-36469,
-36327,
-36201,
-36078,
-35975,
-35872,
-35770,
-35683,
-35603,
-35555,
-35515,
-35484,
-35443,
-35391,
-35323,
-35231,
-35101,
-34907,
-34634,
-34276,
-33829,
-33302,
-32698,
-32022,
-31285,
-30512,
-29717,
-28937,
-28160,
-27430,
-26724,
-26080,
-25488,
-24964,
-24503,
-24115,
-23794,
-23564,
-23409,
-23358,
-23383,
-23504,
-23699,
-23961,
-24278,
-24625,
-24994,
-25362,
-25715,
-26042,
-26322,
-26561,
-26757,
-26924,
-27079,
-27214,
-27347,
-27466,
-27595,
-27735,
-27893,
-28068,
-28243,
-28413,
-28592,
-28771,
-28974,
-29188,
-29404,
-29635,
-29853,
-30089,
-30308,
-30525,
-30694,
-30823,
-30880,
-30879,
-30798,
-30643,
-30400,
-30072,
-29673,
-29215,
-28720,
-28202,
-27664,
-27139,
-26612,
-26128,
-25675,
-25279,
-24923,
-24617,
-24361,
-24153,
-24015,
-23941,
-23936,
-24003,
-24133,
-24330,
-24595,
-24914,
-25277,
-25671,
-26070,
-26468,
-26847,
-27209,
-27535,
-27843,
-28110,
-28379,
-28629,
-28900,
-29184,
-29487,
-29821,
-30172,
-30552,
-30938,
-31337,
-31721,
-32105,
-32468,
-32831,
-33177,
-33528,
-33867,
-34204,
-34531,
-34827,
-35104,
-35320,
-35488,
-35581,
-35585,
-35508,
-35332,
-35080,
-34760,
-34388,
-33976,
-33535,
-33084,
-32628,
-32199,
-31783,
-31404,
-31042,
-30716,
-30415,
-30162,
-29946,
-29782,
-29655,
-29596,
-29575,
-29641,
-29744,
-29924,
-30136,
-30389,
-30676,
-30970,
-31290,
-31582,
-31882,
-32148,
-32402,
-32641,
-32861,
-33087,
-33310,
-33553,
-33816,
-34107,
-34429,
-34783,
-35166,
-35568,
-35983,
-36393,
-36799,
-37188,
-37569,
-37931,
-38287,
-38624,
-38962,
-39280,
-39594,
-39875,
-40123,
-40308,
-40437,
-40471,
-40440,
-40303,
-40094,
-39807,
-39470,
-39105,
-38731,
-38362,
-38015,
-37689,
-37405,
-37147,
-36924,
-36718,
-36526,
-36352,
-36187,
-36057,
-35943,
-35885,
-35853,
-35894,
-35975,
-36118,
-36302,
-36507,
-36729,
-36937,
-37135,
-37306,
-37450,
-37566,
-37665,
-37753,
-37843,
-37953,
-38084,
-38253,
-38451,
-38686,
-38939,
-39217,
-39498,
-39788,
-40071,
-40348,
-40617,
-40868,
-41109,
-41333,
-41546,
-41754,
-41949,
-42135,
-42274,
-42387,
-42429,
-42420,
-42341,
-42184,
-41946,
-41628,
-41229,
-40787,
-40300,
-39805,
-39299,
-38807,
-38330,
-37880,
-37466,
-37080,
-36714,
-36369,
-36026,
-35704,
-35383,
-35092,
-34815,
-34566,
-34357,
-34184,
-34058,
-33972,
-33910,
-33863,
-33807,
-33726,
-33617,
-33459,
-33269,
-33039,
-32790,
-32527,
-32271,
-32035,
-31842,
-31694,
-31592,
-31526,
-31472,
-31440,
-31396,
-31374,
-31326,
-31287,
-31222,
-31158,
-31098,
-31047,
-31018,
-30986,
-30956,
-30909,
-30838,
-30738,
-30580,
-30367,
-30077,
-29730,
-29332,
-28893,
-28427,
-27938,
-27452,
-26976,
-26537,
-26122,
-25743,
-25379,
-25045,
-24725,
-24435,
-24162,
-23906,
-23664,
-23449,
-23254,
-23094,
-22968,
-22860,
-22794,
-22730,
-22703,
-22665,
-22640,
-22587,
-22527,
-22433,
-22325,
-22187,
-22039,
-21882,
-21741,
-21617,
-21533,
-21483,
-21484,
-21537,
-21639,
-21785,
-21961,
-22155,
-22364,
-22585,
-22826,
-23069,
-23332,
-23579,
-23846,
-24124,
-24414,
-24717,
-25001,
-25262,
-25487,
-25671,
-25818,
-25915,
-25967,
-25960,
-25920,
-25853,
-25791,
-25751,
-25732,
-25745,
-25787,
-25862,
-25982,
-26124,
-26307,
-26485,
-26688,
-26878,
-27090,
-27312,
-27549,
-27806,
-28064,
-28343,
-28625,
-28924,
-29220,
-29499,
-29757,
-29986,
-30189,
-30374,
-30528,
-30663,
-30769,
-30882,
-30994,
-31151,
-31331,
-31552,
-31807,
-32097,
-32427,
-32797,
-33193,
-33612,
-34027,
-34454,
-34868,
-35291,
-35704,
-36115,
-36524,
-36923,
-37316,
-37687,
-38043,
-38365,
-38661,
-38917,
-39129,
-39289,
-39401,
-39475,
-39516,
-39542,
-39556,
-39575,
-39608,
-39673,
-39772,
-39906,
-40060,
-40231,
-40414,
-40611,
-40818,
-41015,
-41192,
-41340,
-41476,
-41602,
-41740,
-41866,
-41970,
-42047,
-42089,
-42118,
-42112,
-42083,
-41999,
-41874,
-41704,
-41514,
-41312,
-41113,
-40928,
-40762,
-40640,
-40563,
-40540,
-40560,
-40625,
-40718,
-40856,
-41005,
-41183,
-41351,
-41522,
-41686,
-41850,
-42017,
-42175,
-42330,
-42463,
-42576,
-42658,
-42701,
-42711,
-42665,
-42587,
-42458,
-42295,
-42090,
-41870,
-41638,
-41423,
-41228,
-41058,
-40912,
-40791,
-40697,
-40635,
-40592,
-40562,
-40534,
-40494,
-40452,
-40397,
-40340,
-40259,
-40166,
-40048,
-39918,
-39769,
-39596,
-39380,
-39125,
-38826,
-38499,
-38146,
-37773,
-37383,
-36979,
-36586,
-36217,
-35888,
-35625,
-35406,
-35243,
-35130,
-35064,
-35055,
-35090,
-35161,
-35261,
-35363,
-35485,
-35595,
-35720,
-35833,
-35937,
-36018,
-36071,
-36092,
-36073,
-36014,
-35903,
-35745,
-35535,
-35287,
-35013,
-34714,
-34417,
-34115,
-33837,
-33587,
-33381,
-33222,
-33105,
-33030,
-32992,
-32984,
-33005,
-33046,
-33097,
-33157,
-33205,
-33249,
-33272,
-33277,
-33255,
-33206,
-33112,
-32982,
-32794,
-32557,
-32275,
-31946,
-31589,
-31199,
-30795,
-30390,
-30002,
-29644,
-29334,
-29067,
-28862,
-28710,
-28629,
-28598,
-28630,
-28692,
-28791,
-28915,
-29060,
-29220,
-29373,
-29519,
-29632,
-29728,
-29791,
-29824,
-29813,
-29751,
-29632,
-29472,
-29265,
-29033,
-28769,
-28485,
-28195,
-27907,
-27657,
-27436,
-27275,
-27155,
-27099,
-27100,
-27161,
-27276,
-27437,
-27621,
-27834,
-28039,
-28258,
-28448,
-28620,
-28752,
-28843,
-28883,
-28875,
-28799,
-28676,
-28483,
-28245,
-27947,
-27610,
-27235,
-26836,
-26433,
-26039,
-25670,
-25345,
-25063,
-24857,
-24708,
-24649,
-24656,
-24737,
-24873,
-25066,
-25292,
-25554,
-25820,
-26090,
-26344,
-26572,
-26769,
-26924,
-27032,
-27089,
-27088,
-27037,
-26941,
-26799,
-26626,
-26412,
-26196,
-25958,
-25745,
-25544,
-25377,
-25256,
-25182,
-25174,
-25228,
-25345,
-25526,
-25753,
-26026,
-26325,
-26645,
-26955,
-27257,
-27515,
-27732,
-27888,
-27987,
-28020,
-27983,
-27887,
-27724,
-27515,
-27267,
-26981,
-26682,
-26362,
-26048,
-25750,
-25472,
-25245,
-25065,
-24955,
-24916,
-24954,
-25076,
-25276,
-25546,
-25879,
-26251,
-26653,
-27063,
-27462,
-27844,
-28174,
-28466,
-28686,
-28851,
-28945,
-28980,
-28952,
-28869,
-28740,
-28567,
-28370,
-28154,
-27924,
-27711,
-27502,
-27336,
-27205,
-27129,
-27114,
-27161,
-27275,
-27449,
-27681,
-27960,
-28272,
-28604,
-28941,
-29264,
-29561,
-29823,
-30030,
-30182,
-30272,
-30295,
-30259,
-30165,
-30021,
-29837,
-29632,
-29400,
-29180,
-28954,
-28768,
-28598,
-28485,
-28418,
-28414,
-28474,
-28604,
-28799,
-29063,
-29386,
-29757,
-30169,
-30603,
-31042,
-31472,
-31867,
-32228,
-32530,
-32764,
-32938,
-33028,
-33058,
-33022,
-32929,
-32792,
-32622,
-32418,
-32217,
-32000,
-31806,
-31625,
-31479,
-31370,
-31311,
-31303,
-31362,
-31480,
-31659,
-31894,
-32168,
-32483,
-32818,
-33162,
-33499,
-33811,
-34086,
-34320,
-34499,
-34639,
-34714,
-34749,
-34733,
-34672,
-34585,
-34469,
-34345,
-34211,
-34088,
-33968,
-33888,
-33830,
-33832,
-33873,
-33979,
-34139,
-34357,
-34635,
-34953,
-35317,
-35699,
-36104,
-36503,
-36895,
-37255,
-37587,
-37865,
-38104,
-38274,
-38400,
-38460,
-38470,
-38433,
-38348,
-38237,
-38092,
-37937,
-37772,
-37619,
-37481,
-37369,
-37292,
-37251,
-37263,
-37324,
-37432,
-37599,
-37797,
-38039,
-38310,
-38598,
-38903,
-39195,
-39479,
-39731,
-39952,
-40131,
-40265,
-40352,
-40387,
-40380,
-40334,
-40248,
-40143,
-40003,
-39859,
-39703,
-39553,
-39420,
-39296,
-39207,
-39139,
-39120,
-39140,
-39211,
-39325,
-39478,
-39666,
-39881,
-40116,
-40363,
-40611,
-40845,
-41056,
-41236,
-41380,
-41494,
-41560,
-41592,
-41578,
-41527,
-41441,
-41330,
-41190,
-41039,
-40866,
-40692,
-40518,
-40354,
-40211,
-40089,
-39995,
-39934,
-39903,
-39911,
-39945,
-40009,
-40081,
-40169,
-40250,
-40332,
-40396,
-40437,
-40451,
-40422,
-40364,
-40253,
-40115,
-39923,
-39700,
-39435,
-39141,
-38822,
-38479,
-38131,
-37774,
-37437,
-37105,
-36809,
-36534,
-36307,
-36121,
-35988,
-35901,
-35861,
-35860,
-35897,
-35962,
-36052,
-36155,
-36259,
-36364,
-36448,
-36526,
-36574,
-36598,
-36580,
-36535,
-36437,
-36322,
-36154,
-35959,
-35724,
-35458,
-35178,
-34881,
-34586,
-34293,
-34002,
-33736,
-33485,
-33273,
-33086,
-32927,
-32793,
-32669,
-32566,
-32467,
-32370,
-32267,
-32154,
-32024,
-31880,
-31711,
-31530,
-31318,
-31088,
-30829,
-30545,
-30238,
-29903,
-29554,
-29185,
-28820,
-28450,
-28096,
-27769,
-27470,
-27223,
-27016,
-26865,
-26767,
-26710,
-26708,
-26731,
-26797,
-26865,
-26956,
-27039,
-27126,
-27203,
-27265,
-27318,
-27338,
-27343,
-27316,
-27263,
-27174,
-27049,
-26884,
-26683,
-26447,
-26194,
-25911,
-25639,
-25352,
-25101,
-24859,
-24670,
-24503,
-24398,
-24307,
-24271,
-24245,
-24252,
-24256,
-24272,
-24276,
-24268,
-24255,
-24214,
-24174,
-24104,
-24025,
-23918,
-23792,
-23645,
-23470,
-23268,
-23038,
-22776,
-22507,
-22223,
-21952,
-21695,
-21468,
-21288,
-21153,
-21088,
-21074,
-21127,
-21219,
-21355,
-21518,
-21701,
-21898,
-22088,
-22283,
-22460,
-22637,
-22796,
-22951,
-23087,
-23215,
-23311,
-23392,
-23434,
-23448,
-23419,
-23367,
-23276,
-23178,
-23062,
-22957,
-22867,
-22813,
-22799,
-22831,
-22904,
-23018,
-23164,
-23330,
-23514,
-23691,
-23864,
-24014,
-24146,
-24259,
-24351,
-24428,
-24483,
-24519,
-24534,
-24536,
-24505,
-24463,
-24375,
-24275,
-24136,
-23993,
-23844,
-23700,
-23583,
-23497,
-23467,
-23489,
-23587,
-23737,
-23958,
-24215,
-24521,
-24843,
-25184,
-25522,
-25850,
-26176,
-26473,
-26773,
-27046,
-27316,
-27568,
-27810,
-28030,
-28240,
-28412,
-28562,
-28681,
-28768,
-28840,
-28894,
-28951,
-29025,
-29121,
-29267,
-29444,
-29694,
-29970,
-30306,
-30661,
-31039,
-31411,
-31778,
-32111,
-32425,
-32692,
-32937,
-33135,
-33313,
-33458,
-33577,
-33679,
-33745,
-33791,
-33790,
-33771,
-33705,
-33625,
-33518,
-33413,
-33311,
-33244,
-33209,
-33241,
-33328,
-33488,
-33712,
-33988,
-34318,
-34670,
-35056,
-35434,
-35819,
-36187,
-36542,
-36894,
-37222,
-37559,
-37874,
-38195,
-38503,
-38802,
-39092,
-39356,
-39607,
-39833,
-40043,
-40237,
-40435,
-40640,
-40867,
-41125,
-41419,
-41756,
-42131,
-42538,
-42962,
-43393,
-43811,
-44197,
-44553,
-44846,
-45090,
-45274,
-45396,
-45469,
-45491,
-45465,
-45409,
-45306,
-45177,
-45016,
-44819,
-44607,
-44367,
-44124,
-43887,
-43665,
-43483,
-43350,
-43279,
-43292,
-43376,
-43545,
-43781,
-44078,
-44424,
-44796,
-45184,
-45572,
-45950,
-46308,
-46646,
-46963,
-47258,
-47530,
-47785,
-48019,
-48226,
-48415,
-48563,
-48691,
-48775,
-48835,
-48870,
-48886,
-48900,
-48921,
-48959,
-49028,
-49125,
-49256,
-49415,
-49585,
-49769,
-49927,
-50072,
-50166,
-50214,
-50208,
-50141,
-50025,
-49858,
-49647,
-49403,
-49130,
-48826,
-48509,
-48160,
-47807,
-47427,
-47052,
-46669,
-46307,
-45976,
-45675,
-45448,
-45271,
-45185,
-45164,
-45222,
-45341,
-45503,
-45704,
-45907,
-46110,
-46291,
-46436,
-46540,
-46597,
-46610,
-46573,
-46502,
-46381,
-46234,
-46041,
-45816,
-45559,
-45264,
-44954,
-44607,
-44271,
-43915,
-43598,
-43294,
-43048,
-42845,
-42710,
-42625,
-42601,
-42609,
-42656,
-42705,
-42752,
-42778,
-42764,
-42709,
-42603,
-42442,
-42239,
-41977,
-41681,
-41342,
-40966,
-40567,
-40129,
-39671,
-39192,
-38691,
-38192,
-37689,
-37208,
-36753,
-36339,
-35982,
-35680,
-35449,
-35270,
-35148,
-35063,
-35005,
-34948,
-34890,
-34796,
-34673,
-34501,
-34280,
-34017,
-33704,
-33362,
-32982,
-32585,
-32166,
-31744,
-31312,
-30881,
-30458,
-30045,
-29657,
-29301,
-28992,
-28740,
-28554,
-28445,
-28409,
-28454,
-28567,
-28729,
-28939,
-29155,
-29370,
-29550,
-29684,
-29754,
-29756,
-29670,
-29511,
-29271,
-28957,
-28587,
-28157,
-27682,
-27167,
-26613,
-26034,
-25433,
-24832,
-24221,
-23641,
-23080,
-22570,
-22125,
-21747,
-21461,
-21250,
-21123,
-21052,
-21049,
-21062,
-21105,
-21127,
-21132,
-21096,
-21016,
-20889,
-20726,
-20523,
-20299,
-20059,
-19809,
-19568,
-19328,
-19104,
-18889,
-18694,
-18512,
-18364,
-18246,
-18176,
-18164,
-18211,
-18339,
-18536,
-18806,
-19136,
-19509,
-19894,
-20279,
-20617,
-20907,
-21109,
-21219,
-21230,
-21139,
-20962,
-20706,
-20390,
-20026,
-19636,
-19219,
-18801,
-18368,
-17946,
-17526,
-17125,
-16746,
-16408,
-16124,
-15915,
-15791,
-15769,
-15845,
-16026,
-16298,
-16642,
-17035,
-17443,
-17841,
-18194,
-18496,
-18719,
-18870,
-18944,
-18952,
-18908,
-18828,
-18731,
-18621,
-18527,
-18427,
-18346,
-18262,
-18203,
-18153,
-18133,
-18153,
-18208,
-18342,
-18542,
-18834,
-19219,
-19681,
-20222,
-20800,
-21404,
-21990,
-22540,
-23019,
-23404,
-23684,
-23866,
-23942,
-23943,
-23862,
-23741,
-23577,
-23399,
-23212,
-23028,
-22845,
-22674,
-22508,
-22364,
-22250,
-22174,
-22162,
-22213,
-22361,
-22586,
-22923,
-23327,
-23827,
-24362,
-24938,
-25499,
-26032,
-26508,
-26907,
-27231,
-27463,
-27625,
-27713,
-27753,
-27761,
-27750,
-27739,
-27737,
-27746,
-27779,
-27841,
-27929,
-28069,
-28233,
-28464,
-28746,
-29106,
-29540,
-30052,
-30626,
-31263,
-31936,
-32632,
-33324,
-33983,
-34579,
-35099,
-35516,
-35834,
-36044,
-36146,
-36163,
-36089,
-35961,
-35777,
-35578,
-35356,
-35151,
-34952,
-34790,
-34666,
-34600,
-34590,
-34653,
-34788,
-35010,
-35307,
-35692,
-36146,
-36669,
-37235,
-37844,
-38456,
-39077,
-39663,
-40214,
-40704,
-41125,
-41470,
-41737,
-41926,
-42056,
-42122,
-42152,
-42150,
-42140,
-42140,
-42162,
-42225,
-42332,
-42491,
-42705,
-42975,
-43296,
-43670,
-44079,
-44521,
-44986,
-45460,
-45943,
-46417,
-46878,
-47303,
-47691,
-48026,
-48291,
-48492,
-48599,
-48625,
-48561,
-48423,
-48219,
-47976,
-47705,
-47441,
-47198,
-47006,
-46880,
-46832,
-46868,
-46984,
-47162,
-47415,
-47694,
-48033,
-48375,
-48743,
-49110,
-49476,
-49839,
-50193,
-50531,
-50844,
-51117,
-51339,
-51491,
-51570,
-51566,
-51478,
-51314,
-51085,
-50821,
-50540,
-50282,
-50060,
-49912,
-49840,
-49865,
-49969,
-50168,
-50411,
-50721,
-51045,
-51387,
-51738,
-52066,
-52402,
-52709,
-53012,
-53294,
-53550,
-53778,
-53948,
-54063,
-54091,
-54029,
-53867,
-53597,
-53243,
-52807,
-52322,
-51815,
-51305,
-50828,
-50397,
-50028,
-49725,
-49479,
-49283,
-49118,
-48971,
-48829,
-48680,
-48518,
-48347,
-48163,
-47984,
-47800,
-47633,
-47456,
-47293,
-47110,
-46919,
-46702,
-46450,
-46166,
-45860,
-45527,
-45216,
-44912,
-44675,
-44487,
-44399,
-44383,
-44475,
-44630,
-44869,
-45136,
-45434,
-45726,
-45995,
-46231,
-46413,
-46543,
-46612,
-46617,
-46558,
-46430,
-46223,
-45944,
-45565,
-45105,
-44540,
-43892,
-43162,
-42370,
-41532,
-40677,
-39829,
-39008,
-38243,
-37536,
-36906,
-36338,
-35845,
-35399,
-35014,
-34654,
-34338,
-34033,
-33753,
-33481,
-33225,
-32974,
-32731,
-32478,
-32219,
-31936,
-31630,
-31297,
-30934,
-30557,
-30164,
-29784,
-29419,
-29098,
-28830,
-28620,
-28480,
-28399,
-28371,
-28394,
-28434,
-28504,
-28564,
-28629,
-28678,
-28716,
-28735,
-28730,
-28698,
-28624,
-28499,
-28310,
-28038,
-27677,
-27220,
-26679,
-26044,
-25363,
-24633,
-23906,
-23196,
-22539,
-21948,
-21429,
-20995,
-20620,
-20310,
-20033,
-19786,
-19547,
-19321,
-19090,
-18875,
-18672,
-18486,
-18328,
-18184,
-18045,
-17902,
-17717,
-17484,
-17181,
-16787,
-16322,
-15776,
-15193,
-14592,
-14022,
-13512,
-13104,
-12810,
-12649,
-12614,
-12686,
-12853,
-13068,
-13327,
-13586,
-13851,
-14106,
-14362,
-14623,
-14901,
-15196,
-15510,
-15827,
-16136,
-16392,
-16585,
-16657,
-16612,
-16423,
-16109,
-15683,
-15188,
-14660,
-14152,
-13704,
-13351,
-13107,
-12983,
-12951,
-13004,
-13096,
-13204,
-13302,
-13365,
-13403,
-13414,
-13419,
-13437,
-13480,
-13566,
-13680,
-13830,
-13965,
-14078,
-14121,
-14070,
-13913,
-13647,
-13291,
-12877,
-12451,
-12062,
-11765,
-11587,
-11569,
-11693,
-11971,
-12356,
-12822,
-13328,
-13837,
-14320,
-14769,
-15183,
-15576,
-15963,
-16366,
-16793,
-17247,
-17724,
-18193,
-18628,
-18991,
-19253,
-19396,
-19412,
-19317,
-19132,
-18907,
-18685,
-18525,
-18463,
-18531,
-18742,
-19078,
-19532,
-20056,
-20622,
-21196,
-21739,
-22245,
-22694,
-23110,
-23492,
-23872,
-24246,
-24630,
-25001,
-25357,
-25662,
-25887,
-26020,
-26018,
-25901,
-25655,
-25326,
-24941,
-24555,
-24213,
-23952,
-23817,
-23810,
-23949,
-24218,
-24591,
-25044,
-25548,
-26080,
-26625,
-27185,
-27743,
-28325,
-28922,
-29550,
-30204,
-30877,
-31546,
-32195,
-32784,
-33307,
-33728,
-34053,
-34277,
-34419,
-34504,
-34565,
-34628,
-34739,
-34896,
-35144,
-35451,
-35840,
-36274,
-36739,
-37225,
-37700,
-38171,
-38620,
-39047,
-39463,
-39858,
-40245,
-40618,
-40963,
-41276,
-41539,
-41739,
-41870,
-41921,
-41899,
-41805,
-41676,
-41514,
-41371,
-41248,
-41189,
-41186,
-41275,
-41434,
-41680,
-41994,
-42360,
-42775,
-43217,
-43691,
-44183,
-44690,
-45206,
-45714,
-46216,
-46690,
-47124,
-47509,
-47813,
-48044,
-48179,
-48233,
-48209,
-48115,
-47983,
-47819,
-47661,
-47515,
-47409,
-47341,
-47334,
-47377,
-47480,
-47635,
-47847,
-48108,
-48424,
-48787,
-49198,
-49649,
-50127,
-50626,
-51126,
-51607,
-52050,
-52432,
-52738,
-52958,
-53092,
-53133,
-53100,
-52990,
-52828,
-52625,
-52397,
-52158,
-51910,
-51669,
-51425,
-51197,
-50973,
-50772,
-50589,
-50430,
-50312,
-50216,
-50174,
-50157,
-50171,
-50206,
-50236,
-50265,
-50256,
-50224,
-50129,
-50005,
-49817,
-49605,
-49352,
-49097,
-48829,
-48578,
-48339,
-48127,
-47944,
-47795,
-47680,
-47606,
-47569,
-47579,
-47628,
-47738,
-47885,
-48090,
-48319,
-48579,
-48844,
-49100,
-49328,
-49503,
-49616,
-49653,
-49603,
-49478,
-49266,
-48990,
-48645,
-48246,
-47802,
-47323,
-46817,
-46287,
-45745,
-45200,
-44660,
-44144,
-43657,
-43222,
-42843,
-42536,
-42298,
-42126,
-42014,
-41950,
-41912,
-41893,
-41863,
-41814,
-41733,
-41615,
-41456,
-41264,
-41037,
-40783,
-40501,
-40201,
-39876,
-39538,
-39175,
-38796,
-38407,
-38008,
-37629,
-37267,
-36952,
-36692,
-36498,
-36382,
-36339,
-36367,
-36444,
-36560,
-36688,
-36810,
-36912,
-36975,
-36999,
-36974,
-36907,
-36801,
-36652,
-36482,
-36263,
-36020,
-35728,
-35403,
-35022,
-34609,
-34153,
-33675,
-33194,
-32721,
-32287,
-31897,
-31581,
-31322,
-31143,
-31007,
-30929,
-30861,
-30809,
-30737,
-30647,
-30520,
-30359,
-30171,
-29950,
-29716,
-29457,
-29188,
-28894,
-28583,
-28244,
-27872,
-27480,
-27055,
-26627,
-26197,
-25801,
-25444,
-25165,
-24957,
-24848,
-24823,
-24878,
-25002,
-25169,
-25356,
-25555,
-25728,
-25889,
-26003,
-26092,
-26132,
-26144,
-26107,
-26031,
-25899,
-25711,
-25454,
-25120,
-24715,
-24239,
-23704,
-23135,
-22552,
-21981,
-21454,
-20980,
-20587,
-20273,
-20043,
-19879,
-19782,
-19716,
-19687,
-19667,
-19661,
-19651,
-19650,
-19643,
-19645,
-19634,
-19623,
-19575,
-19499,
-19366,
-19164,
-18897,
-18550,
-18141,
-17684,
-17201,
-16723,
-16267,
-15866,
-15527,
-15266,
-15070,
-14943,
-14861,
-14816,
-14788,
-14767,
-14751,
-14731,
-14720,
-14709,
-14713,
-14722,
-14737,
-14736,
-14714,
-14644,
-14516,
-14318,
-14038,
-13700,
-13301,
-12882,
-12462,
-12080,
-11757,
-11525,
-11379,
-11343,
-11383,
-11511,
-11685,
-11902,
-12138,
-12385,
-12637,
-12897,
-13162,
-13435,
-13714,
-13991,
-14248,
-14468,
-14624,
-14689,
-14647,
-14483,
-14196,
-13801,
-13315,
-12773,
-12209,
-11663,
-11165,
-10740,
-10401,
-10148,
-9986,
-9889,
-9864,
-9876,
-9940,
-10044,
-10194,
-10401,
-10667,
-11004,
-11402,
-11854,
-12339,
-12835,
-13309,
-13733,
-14088,
-14349,
-14534,
-14631,
-14677,
-14695,
-14715,
-14773,
-14884,
-15070,
-15331,
-15655,
-16049,
-16466,
-16921,
-17375,
-17841,
-18309,
-18782,
-19278,
-19788,
-20327,
-20875,
-21428,
-21959,
-22436,
-22836,
-23128,
-23293,
-23331,
-23245,
-23050,
-22788,
-22479,
-22176,
-21900,
-21688,
-21545,
-21495,
-21511,
-21611,
-21762,
-21973,
-22232,
-22542,
-22913,
-23353,
-23868,
-24474,
-25149,
-25902,
-26695,
-27499,
-28293,
-29017,
-29665,
-30204,
-30628,
-30948,
-31176,
-31339,
-31479,
-31611,
-31777,
-31979,
-32236,
-32543,
-32891,
-33269,
-33672,
-34082,
-34520,
-34963,
-35458,
-35978,
-36568,
-37207,
-37901,
-38627,
-39361,
-40065,
-40704,
-41241,
-41651,
-41916,
-42035,
-42019,
-41897,
-41695,
-41450,
-41195,
-40957,
-40748,
-40578,
-40451,
-40347,
-40280,
-40222,
-40203,
-40198,
-40265,
-40374,
-40589,
-40888,
-41298,
-41802,
-42378,
-43000,
-43622,
-44213,
-44726,
-45142,
-45441,
-45620,
-45698,
-45691,
-45644,
-45571,
-45510,
-45479,
-45480,
-45528,
-45598,
-45690,
-45796,
-45897,
-46017,
-46139,
-46308,
-46517,
-46809,
-47172,
-47626,
-48147,
-48718,
-49298,
-49846,
-50322,
-50680,
-50904,
-50968,
-50884,
-50663,
-50336,
-49932,
-49488,
-49027,
-48582,
-48141,
-47737,
-47334,
-46947,
-46563,
-46180,
-45819,
-45481,
-45204,
-45004,
-44911,
-44932,
-45079,
-45334,
-45676,
-46070,
-46471,
-46834,
-47130,
-47314,
-47393,
-47348,
-47203,
-46986,
-46710,
-46426,
-46134,
-45867,
-45618,
-45398,
-45182,
-44978,
-44769,
-44557,
-44357,
-44172,
-44040,
-43973,
-43996,
-44123,
-44353,
-44676,
-45063,
-45487,
-45892,
-46257,
-46523,
-46684,
-46715,
-46624,
-46421,
-46134,
-45780,
-45401,
-45006,
-44617,
-44244,
-43872,
-43520,
-43156,
-42804,
-42446,
-42115,
-41803,
-41559,
-41380,
-41310,
-41336,
-41477,
-41704,
-42003,
-42335,
-42658,
-42940,
-43140,
-43237,
-43222,
-43088,
-42851,
-42530,
-42142,
-41718,
-41268,
-40818,
-40357,
-39906,
-39451,
-38995,
-38551,
-38114,
-37709,
-37353,
-37066,
-36875,
-36793,
-36832,
-36985,
-37247,
-37588,
-37977,
-38388,
-38773,
-39113,
-39384,
-39571,
-39674,
-39708,
-39669,
-39585,
-39470,
-39321,
-39170,
-38993,
-38810,
-38610,
-38394,
-38171,
-37939,
-37727,
-37535,
-37393,
-37311,
-37293,
-37358,
-37479,
-37656,
-37858,
-38059,
-38225,
-38336,
-38357,
-38287,
-38106,
-37828,
-37451,
-36995,
-36474,
-35895,
-35289,
-34642,
-33989,
-33312,
-32637,
-31973,
-31320,
-30718,
-30163,
-29696,
-29324,
-29065,
-28932,
-28921,
-29026,
-29231,
-29506,
-29842,
-30186,
-30538,
-30856,
-31140,
-31370,
-31549,
-31673,
-31746,
-31779,
-31757,
-31711,
-31617,
-31489,
-31333,
-31142,
-30935,
-30719,
-30507,
-30315,
-30161,
-30050,
-30000,
-30001,
-30060,
-30154,
-30274,
-30395,
-30497,
-30557,
-30559,
-30483,
-30334,
-30091,
-29771,
-29364,
-28883,
-28331,
-27717,
-27050,
-26337,
-25594,
-24825,
-24057,
-23303,
-22582,
-21927,
-21343,
-20857,
-20482,
-20213,
-20071,
-20026,
-20089,
-20225,
-20427,
-20681,
-20948,
-21245,
-21523,
-21802,
-22050,
-22274,
-22455,
-22598,
-22688,
-22726,
-22719,
-22652,
-22551,
-22418,
-22261,
-22114,
-21975,
-21872,
-21815,
-21801,
-21851,
-21945,
-22083,
-22246,
-22430,
-22611,
-22783,
-22932,
-23045,
-23123,
-23152,
-23129,
-23050,
-22901,
-22681,
-22383,
-21998,
-21538,
-20991,
-20390,
-19739,
-19070,
-18407,
-17782,
-17214,
-16736,
-16349,
-16071,
-15893,
-15811,
-15814,
-15885,
-16015,
-16188,
-16398,
-16641,
-16913,
-17205,
-17526,
-17844,
-18177,
-18470,
-18746,
-18951,
-19095,
-19156,
-19138,
-19052,
-18912,
-18750,
-18590,
-18464,
-18395,
-18406,
-18495,
-18674,
-18919,
-19219,
-19556,
-19899,
-20255,
-20582,
-20912,
-21214,
-21516,
-21809,
-22099,
-22376,
-22632,
-22845,
-22996,
-23063,
-23021,
-22868,
-22603,
-22238,
-21801,
-21321,
-20842,
-20405,
-20031,
-19756,
-19578,
-19507,
-19515,
-19598,
-19719,
-19862,
-20023,
-20167,
-20334,
-20498,
-20692,
-20923,
-21187,
-21497,
-21832,
-22171,
-22496,
-22768,
-22976,
-23089,
-23122,
-23067,
-22968,
-22842,
-22740,
-22695,
-22743,
-22899,
-23181,
-23562,
-24042,
-24578,
-25149,
-25720,
-26275,
-26794,
-27287,
-27749,
-28200,
-28647,
-29096,
-29549,
-29988,
-30400,
-30747,
-31013,
-31159,
-31178,
-31059,
-30819,
-30475,
-30073,
-29647,
-29247,
-28911,
-28663,
-28518,
-28484,
-28533,
-28659,
-28830,
-29020,
-29220,
-29411,
-29606,
-29798,
-30025,
-30274,
-30577,
-30925,
-31314,
-31732,
-32148,
-32537,
-32873,
-33134,
-33312,
-33407,
-33436,
-33424,
-33405,
-33409,
-33477,
-33618,
-33858,
-34182,
-34585,
-35045,
-35530,
-36017,
-36486,
-36916,
-37306,
-37660,
-37974,
-38277,
-38556,
-38842,
-39107,
-39364,
-39581,
-39750,
-39848,
-39856,
-39775,
-39594,
-39344,
-39031,
-38693,
-38368,
-38074,
-37859,
-37716,
-37679,
-37723,
-37856,
-38044,
-38279,
-38535,
-38806,
-39066,
-39338,
-39591,
-39868,
-40138,
-40435,
-40737,
-41045,
-41355,
-41635,
-41883,
-42074,
-42199,
-42255,
-42240,
-42168,
-42057,
-41925,
-41803,
-41699,
-41646,
-41639,
-41688,
-41784,
-41921,
-42077,
-42246,
-42408,
-42551,
-42680,
-42781,
-42870,
-42943,
-43003,
-43071,
-43120,
-43179,
-43207,
-43232,
-43208,
-43167,
-43065,
-42938,
-42766,
-42575,
-42376,
-42184,
-42021,
-41896,
-41827,
-41813,
-41859,
-41955,
-42092,
-42264,
-42449,
-42642,
-42828,
-43004,
-43165,
-43313,
-43440,
-43558,
-43654,
-43742,
-43802,
-43842,
-43847,
-43818,
-43747,
-43635,
-43481,
-43292,
-43075,
-42842,
-42609,
-42380,
-42173,
-41997,
-41849,
-41747,
-41668,
-41626,
-41603,
-41596,
-41601,
-41603,
-41605,
-41597,
-41588,
-41565,
-41542,
-41508,
-41473,
-41432,
-41386,
-41333,
-41271,
-41202,
-41120,
-41031,
-40929,
-40827,
-40721,
-40620,
-40536,
-40460,
-40415,
-40391,
-40395,
-40427,
-40480,
-40547,
-40625,
-40700,
-40768,
-40818,
-40846,
-40840,
-40813,
-40749,
-40667,
-40559,
-40433,
-40301,
-40152,
-39998,
-39840,
-39668,
-39492,
-39299,
-39097,
-38885,
-38665,
-38448,
-38232,
-38039,
-37860,
-37715,
-37601,
-37514,
-37457,
-37412,
-37374,
-37340,
-37276,
-37209,
-37102,
-36980,
-36839,
-36685,
-36539,
-36393,
-36276,
-36171,
-36094,
-36031,
-35975,
-35919,
-35855,
-35775,
-35679,
-35566,
-35448,
-35327,
-35228,
-35142,
-35096,
-35072,
-35078,
-35100,
-35120,
-35131,
-35108,
-35052,
-34944,
-34807,
-34623,
-34438,
-34239,
-34064,
-33910,
-33792,
-33707,
-33645,
-33590,
-33534,
-33446,
-33335,
-33171,
-32978,
-32747,
-32505,
-32258,
-32027,
-31825,
-31648,
-31500,
-31365,
-31221,
-31069,
-30863,
-30624,
-30325,
-29987,
-29624,
-29258,
-28914,
-28618,
-28387,
-28222,
-28140,
-28097,
-28111,
-28124,
-28146,
-28127,
-28096,
-28018,
-27935,
-27843,
-27779,
-27745,
-27772,
-27839,
-27964,
-28107,
-28262,
-28393,
-28487,
-28519,
-28504,
-28429,
-28334,
-28227,
-28146,
-28110,
-28135,
-28216,
-28352,
-28509,
-28666,
-28783,
-28837,
-28794,
-28663,
-28430,
-28124,
-27762,
-27371,
-26976,
-26594,
-26233,
-25881,
-25533,
-25162,
-24751,
-24291,
-23774,
-23214,
-22634,
-22067,
-21552,
-21129,
-20828,
-20658,
-20645,
-20739,
-20951,
-21213,
-21516,
-21802,
-22075,
-22304,
-22517,
-22711,
-22923,
-23174,
-23475,
-23848,
-24270,
-24739,
-25215,
-25676,
-26084,
-26428,
-26690,
-26881,
-27022,
-27136,
-27262,
-27423,
-27640,
-27913,
-28233,
-28563,
-28876,
-29112,
-29244,
-29234,
-29069,
-28750,
-28299,
-27738,
-27119,
-26458,
-25807,
-25164,
-24547,
-23944,
-23338,
-22721,
-22077,
-21410,
-20736,
-20071,
-19486,
-18980,
-18650,
-18475,
-18526,
-18755,
-19182,
-19734,
-20396,
-21089,
-21795,
-22460,
-23081,
-23654,
-24192,
-24722,
-25270,
-25851,
-26489,
-27159,
-27866,
-28563,
-29234,
-29834,
-30355,
-30774,
-31111,
-31381,
-31614,
-31852,
-32113,
-32428,
-32787,
-33182,
-33572,
-33921,
-34168,
-34278,
-34215,
-33957,
-33524,
-32920,
-32197,
-31393,
-30556,
-29719,
-28921,
-28154,
-27435,
-26742,
-26074,
-25411,
-24772,
-24158,
-23599,
-23148,
-22824,
-22694,
-22760,
-23053,
-23551,
-24235,
-25049,
-25948,
-26862,
-27755,
-28575,
-29318,
-29968,
-30557,
-31093,
-31625,
-32157,
-32726,
-33313,
-33930,
-34534,
-35115,
-35640,
-36095,
-36475,
-36790,
-37056,
-37311,
-37576,
-37886,
-38245,
-38660,
-39101,
-39537,
-39926,
-40205,
-40347,
-40309,
-40074,
-39662,
-39077,
-38371,
-37583,
-36756,
-35933,
-35140,
-34394,
-33697,
-33046,
-32435,
-31858,
-31324,
-30833,
-30428,
-30119,
-29955,
-29949,
-30129,
-30489,
-31014,
-31677,
-32423,
-33209,
-33977,
-34684,
-35299,
-35814,
-36222,
-36554,
-36819,
-37066,
-37306,
-37571,
-37859,
-38179,
-38506,
-38845,
-39166,
-39469,
-39757,
-40026,
-40314,
-40622,
-40981,
-41397,
-41872,
-42398,
-42940,
-43470,
-43928,
-44292,
-44503,
-44553,
-44417,
-44115,
-43657,
-43088,
-42429,
-41734,
-41020,
-40318,
-39645,
-38994,
-38385,
-37797,
-37251,
-36741,
-36290,
-35918,
-35641,
-35488,
-35469,
-35587,
-35836,
-36190,
-36617,
-37073,
-37524,
-37921,
-38242,
-38474,
-38606,
-38663,
-38654,
-38615,
-38570,
-38543,
-38546,
-38590,
-38672,
-38789,
-38928,
-39098,
-39275,
-39493,
-39740,
-40037,
-40404,
-40830,
-41330,
-41884,
-42460,
-43039,
-43562,
-44009,
-44321,
-44495,
-44491,
-44335,
-44026,
-43592,
-43062,
-42472,
-41841,
-41205,
-40563,
-39938,
-39317,
-38719,
-38132,
-37574,
-37057,
-36588,
-36209,
-35915,
-35739,
-35679,
-35728,
-35869,
-36079,
-36313,
-36545,
-36736,
-36859,
-36903,
-36869,
-36757,
-36606,
-36425,
-36249,
-36099,
-35993,
-35930,
-35925,
-35951,
-36022,
-36113,
-36233,
-36375,
-36554,
-36776,
-37058,
-37403,
-37815,
-38282,
-38786,
-39294,
-39766,
-40176,
-40466,
-40634,
-40642,
-40500,
-40216,
-39816,
-39324,
-38781,
-38200,
-37626,
-37052,
-36503,
-35968,
-35448,
-34938,
-34451,
-33976,
-33548,
-33172,
-32868,
-32667,
-32560,
-32573,
-32669,
-32850,
-33069,
-33304,
-33509,
-33665,
-33752,
-33762,
-33704,
-33601,
-33465,
-33346,
-33246,
-33197,
-33208,
-33266,
-33378,
-33521,
-33677,
-33846,
-34007,
-34176,
-34351,
-34549,
-34781,
-35051,
-35372,
-35715,
-36081,
-36421,
-36712,
-36914,
-36997,
-36949,
-36749,
-36421,
-35975,
-35451,
-34876,
-34289,
-33720,
-33185,
-32698,
-32252,
-31845,
-31468,
-31105,
-30769,
-30444,
-30165,
-29932,
-29780,
-29716,
-29760,
-29903,
-30142,
-30443,
-30784,
-31119,
-31423,
-31662,
-31829,
-31913,
-31942,
-31919,
-31896,
-31882,
-31911,
-32003,
-32139,
-32337,
-32555,
-32787,
-32996,
-33181,
-33315,
-33420,
-33489,
-33556,
-33621,
-33713,
-33828,
-33967,
-34103,
-34219,
-34270,
-34239,
-34083,
-33804,
-33389,
-32873,
-32263,
-31626,
-30975,
-30370,
-29830,
-29371,
-28996,
-28698,
-28452,
-28243,
-28058,
-27875,
-27717,
-27571,
-27482,
-27451,
-27520,
-27682,
-27952,
-28304,
-28716,
-29152,
-29569,
-29930,
-30212,
-30394,
-30490,
-30511,
-30485,
-30458,
-30448,
-30496,
-30599,
-30764,
-30973,
-31193,
-31407,
-31566,
-31675,
-31706,
-31678,
-31603,
-31507,
-31418,
-31354,
-31331,
-31339,
-31369,
-31380,
-31355,
-31243,
-31033,
-30707,
-30267,
-29747,
-29174,
-28595,
-28057,
-27593,
-27229,
-26982,
-26826,
-26763,
-26741,
-26752,
-26754,
-26756,
-26732,
-26728,
-26737,
-26815,
-26957,
-27204,
-27527,
-27934,
-28378,
-28826,
-29240,
-29572,
-29811,
-29942,
-29973,
-29944,
-29869,
-29815,
-29787,
-29840,
-29955,
-30147,
-30378,
-30624,
-30853,
-31032,
-31143,
-31190,
-31173,
-31127,
-31075,
-31045,
-31061,
-31134,
-31243,
-31394,
-31519,
-31620,
-31630,
-31549,
-31360,
-31073,
-30722,
-30331,
-29959,
-29640,
-29401,
-29269,
-29232,
-29286,
-29396,
-29531,
-29667,
-29777,
-29861,
-29918,
-29972,
-30050,
-30173,
-30372,
-30644,
-30996,
-31400,
-31825,
-32235,
-32595,
-32869,
-33049,
-33131,
-33138,
-33093,
-33043,
-33015,
-33044,
-33146,
-33317,
-33553,
-33818,
-34090,
-34336,
-34530,
-34672,
-34753,
-34799,
-34832,
-34871,
-34953,
-35078,
-35255,
-35467,
-35687,
-35890,
-36031,
-36102,
-36071,
-35952,
-35757,
-35510,
-35255,
-35024,
-34849,
-34754,
-34737,
-34800,
-34919,
-35063,
-35220,
-35349,
-35461,
-35536,
-35603,
-35664,
-35764,
-35894,
-36098,
-36345,
-36647,
-36966,
-37276,
-37545,
-37746,
-37861,
-37884,
-37831,
-37709,
-37572,
-37419,
-37314,
-37243,
-37242,
-37282,
-37372,
-37472,
-37570,
-37648,
-37687,
-37705,
-37686,
-37675,
-37669,
-37708,
-37785,
-37920,
-38094,
-38294,
-38498,
-38671,
-38798,
-38857,
-38844,
-38764,
-38630,
-38474,
-38310,
-38178,
-38078,
-38030,
-38032,
-38063,
-38123,
-38169,
-38210,
-38211,
-38186,
-38130,
-38060,
-37983,
-37928,
-37890,
-37889,
-37900,
-37935,
-37949,
-37946,
-37886,
-37768,
-37580,
-37331,
-37028,
-36701,
-36360,
-36048,
-35761,
-35535,
-35355,
-35232,
-35150,
-35100,
-35072,
-35053,
-35047,
-35047,
-35071,
-35115,
-35205,
-35331,
-35505,
-35715,
-35953,
-36200,
-36435,
-36637,
-36791,
-36887,
-36915,
-36888,
-36797,
-36675,
-36521,
-36352,
-36182,
-36001,
-35830,
-35644,
-35459,
-35244,
-35025,
-34769,
-34506,
-34223,
-33939,
-33659,
-33389,
-33139,
-32910,
-32695,
-32498,
-32300,
-32108,
-31900,
-31685,
-31449,
-31208,
-30964,
-30722,
-30501,
-30302,
-30146,
-30031,
-29966,
-29948,
-29985,
-30060,
-30183,
-30334,
-30524,
-30733,
-30969,
-31216,
-31482,
-31750,
-32025,
-32292,
-32542,
-32774,
-32970,
-33122,
-33229,
-33265,
-33250,
-33159,
-33004,
-32789,
-32515,
-32198,
-31844,
-31463,
-31078,
-30681,
-30301,
-29927,
-29579,
-29242,
-28939,
-28640,
-28379,
-28129,
-27904,
-27713,
-27538,
-27412,
-27311,
-27252,
-27230,
-27236,
-27271,
-27325,
-27383,
-27457,
-27521,
-27586,
-27664,
-27732,
-27840,
-27961,
-28125,
-28330,
-28574,
-28859,
-29172,
-29510,
-29837,
-30180,
-30472,
-30769,
-31004,
-31234,
-31415,
-31585,
-31721,
-31841,
-31927,
-31980,
-31987,
-31933,
-31820,
-31630,
-31372,
-31055,
-30686,
-30294,
-29889,
-29507,
-29149,
-28842,
-28578,
-28368,
-28197,
-28054,
-27939,
-27829,
-27739,
-27656,
-27600,
-27574,
-27590,
-27662,
-27783,
-27958,
-28176,
-28416,
-28669,
-28912,
-29126,
-29317,
-29475,
-29615,
-29748,
-29898,
-30074,
-30304,
-30575,
-30906,
-31264,
-31658,
-32039,
-32411,
-32747,
-33040,
-33291,
-33504,
-33692,
-33864,
-34038,
-34207,
-34385,
-34543,
-34681,
-34765,
-34792,
-34734,
-34591,
-34371,
-34080,
-33752,
-33401,
-33068,
-32758,
-32504,
-32294,
-32131,
-32006,
-31884,
-31778,
-31645,
-31511,
-31353,
-31210,
-31076,
-30992,
-30956,
-30990,
-31090,
-31240,
-31436,
-31641,
-31844,
-32019,
-32166,
-32267,
-32367,
-32436,
-32550,
-32687,
-32893,
-33161,
-33494,
-33878,
-34291,
-34710,
-35108,
-35468,
-35781,
-36041,
-36267,
-36455,
-36646,
-36824,
-37023,
-37219,
-37414,
-37579,
-37698,
-37743,
-37695,
-37555,
-37311,
-36997,
-36615,
-36209,
-35797,
-35407,
-35050,
-34726,
-34441,
-34165,
-33897,
-33610,
-33299,
-32966,
-32612,
-32259,
-31929,
-31639,
-31416,
-31265,
-31189,
-31179,
-31220,
-31285,
-31362,
-31420,
-31470,
-31489,
-31510,
-31539,
-31595,
-31709,
-31878,
-32122,
-32424,
-32772,
-33146,
-33517,
-33866,
-34175,
-34435,
-34650,
-34828,
-34980,
-35131,
-35275,
-35435,
-35591,
-35740,
-35856,
-35923,
-35920,
-35827,
-35649,
-35383,
-35049,
-34665,
-34260,
-33849,
-33457,
-33087,
-32742,
-32414,
-32084,
-31750,
-31390,
-31007,
-30601,
-30184,
-29779,
-29401,
-29075,
-28813,
-28623,
-28506,
-28448,
-28435,
-28449,
-28471,
-28498,
-28512,
-28536,
-28567,
-28628,
-28737,
-28903,
-29135,
-29431,
-29784,
-30164,
-30571,
-30960,
-31336,
-31676,
-31981,
-32260,
-32519,
-32771,
-33031,
-33300,
-33578,
-33862,
-34124,
-34360,
-34536,
-34655,
-34685,
-34648,
-34535,
-34371,
-34172,
-33953,
-33735,
-33517,
-33316,
-33111,
-32901,
-32674,
-32415,
-32122,
-31802,
-31451,
-31102,
-30755,
-30447,
-30187,
-29983,
-29851,
-29772,
-29748,
-29760,
-29796,
-29846,
-29909,
-29979,
-30072,
-30200,
-30367,
-30606,
-30896,
-31268,
-31689,
-32164,
-32666,
-33181,
-33688,
-34180,
-34644,
-35086,
-35510,
-35917,
-36331,
-36734,
-37149,
-37554,
-37944,
-38304,
-38614,
-38863,
-39036,
-39130,
-39147,
-39097,
-38985,
-38834,
-38647,
-38443,
-38221,
-37981,
-37721,
-37436,
-37119,
-36764,
-36386,
-35967,
-35555,
-35122,
-34729,
-34353,
-34034,
-33767,
-33555,
-33402,
-33295,
-33233,
-33204,
-33213,
-33246,
-33322,
-33431,
-33594,
-33802,
-34072,
-34392,
-34761,
-35174,
-35607,
-36062,
-36513,
-36956,
-37380,
-37787,
-38164,
-38526,
-38858,
-39174,
-39459,
-39715,
-39934,
-40099,
-40218,
-40260,
-40247,
-40151,
-40000,
-39772,
-39503,
-39174,
-38811,
-38411,
-37979,
-37520,
-37031,
-36518,
-35985,
-35434,
-34872,
-34315,
-33767,
-33242,
-32755,
-32303,
-31907,
-31551,
-31256,
-30994,
-30796,
-30625,
-30511,
-30431,
-30408,
-30425,
-30503,
-30624,
-30803,
-31014,
-31272,
-31543,
-31833,
-32121,
-32402,
-32670,
-32920,
-33152,
-33365,
-33565,
-33746,
-33904,
-34046,
-34141,
-34215,
-34220,
-34183,
-34078,
-33913,
-33695,
-33427,
-33118,
-32786,
-32431,
-32067,
-31694,
-31309,
-30917,
-30508,
-30082,
-29643,
-29191,
-28734,
-28292,
-27864,
-27482,
-27140,
-26858,
-26631,
-26465,
-26343,
-26262,
-26211,
-26184,
-26171,
-26185,
-26212,
-26281,
-26377,
-26527,
-26716,
-26952,
-27225,
-27509,
-27816,
-28094,
-28364,
-28588,
-28782,
-28940,
-29068,
-29184,
-29286,
-29393,
-29500,
-29603,
-29706,
-29781,
-29826,
-29831,
-29778,
-29686,
-29540,
-29371,
-29181,
-29002,
-28831,
-28693,
-28587,
-28503,
-28446,
-28392,
-28335,
-28265,
-28183,
-28079,
-27987,
-27887,
-27835,
-27810,
-27848,
-27935,
-28083,
-28266,
-28481,
-28696,
-28914,
-29107,
-29281,
-29436,
-29580,
-29731,
-29901,
-30098,
-30335,
-30601,
-30890,
-31194,
-31477,
-31739,
-31955,
-32119,
-32235,
-32308,
-32353,
-32390,
-32428,
-32491,
-32568,
-32672,
-32782,
-32889,
-32974,
-33027,
-33031,
-32999,
-32931,
-32837,
-32750,
-32673,
-32641,
-32645,
-32705,
-32799,
-32933,
-33066,
-33204,
-33317,
-33408,
-33471,
-33517,
-33559,
-33614,
-33696,
-33815,
-33979,
-34176,
-34403,
-34633,
-34853,
-35049,
-35198,
-35307,
-35374,
-35410,
-35435,
-35460,
-35509,
-35575,
-35683,
-35798,
-35937,
-36059,
-36161,
-36227,
-36241,
-36216,
-36148,
-36053,
-35954,
-35852,
-35776,
-35716,
-35685,
-35664,
-35648,
-35615,
-35559,
-35465,
-35333,
-35173,
-34988,
-34799,
-34629,
-34477,
-34377,
-34312,
-34292,
-34304,
-34332,
-34369,
-34393,
-34406,
-34397,
-34375,
-34349,
-34329,
-34325,
-34350,
-34399,
-34480,
-34577,
-34677,
-34775,
-34842,
-34882,
-34884,
-34847,
-34786,
-34704,
-34619,
-34537,
-34476,
-34428,
-34398,
-34378,
-34354,
-34320,
-34261,
-34175,
-34053,
-33911,
-33736,
-33560,
-33370,
-33195,
-33017,
-32860,
-32699,
-32538,
-32370,
-32178,
-31971,
-31735,
-31478,
-31217,
-30947,
-30696,
-30461,
-30265,
-30098,
-29978,
-29887,
-29827,
-29791,
-29768,
-29752,
-29753,
-29746,
-29764,
-29782,
-29827,
-29880,
-29962,
-30045,
-30149,
-30243,
-30335,
-30407,
-30458,
-30483,
-30483,
-30460,
-30424,
-30374,
-30328,
-30279,
-30241,
-30209,
-30181,
-30161,
-30135,
-30111,
-30073,
-30036,
-29983,
-29931,
-29871,
-29813,
-29752,
-29692,
-29630,
-29559,
-29486,
-29388,
-29286,
-29157,
-29013,
-28852,
-28683,
-28503,
-28333,
-28157,
-28006,
-27865,
-27745,
-27651,
-27576,
-27523,
-27499,
-27488,
-27512,
-27551,
-27617,
-27709,
-27823,
-27960,
-28118,
-28287,
-28479,
-28669,
-28876,
-29072,
-29277,
-29478,
-29675,
-29878,
-30078,
-30283,
-30493,
-30705,
-30927,
-31149,
-31385,
-31612,
-31851,
-32084,
-32315,
-32546,
-32761,
-32973,
-33165,
-33336,
-33491,
-33605,
-33694,
-33739,
-33742,
-33708,
-33619,
-33503,
-33333,
-33145,
-32913,
-32676,
-32409,
-32150,
-31877,
-31628,
-31381,
-31170,
-30986,
-30841,
-30748,
-30702,
-30720,
-30796,
-30935,
-31136,
-31396,
-31712,
-32073,
-32480,
-32915,
-33383,
-33868,
-34367,
-34872,
-35384,
-35884,
-36390,
-36868,
-37348,
-37787,
-38219,
-38608,
-38976,
-39299,
-39598,
-39847,
-40077,
-40256,
-40412,
-40530,
-40612,
-40667,
-40673,
-40652,
-40581,
-40475,
-40314,
-40122,
-39875,
-39598,
-39283,
-38939,
-38577,
-38198,
-37817,
-37433,
-37066,
-36709,
-36377,
-36078,
-35810,
-35590,
-35413,
-35296,
-35232,
-35235,
-35297,
-35430,
-35615,
-35863,
-36155,
-36490,
-36857,
-37235,
-37634,
-38019,
-38411,
-38771,
-39121,
-39441,
-39731,
-39994,
-40218,
-40411,
-40564,
-40686,
-40763,
-40811,
-40819,
-40797,
-40748,
-40668,
-40579,
-40458,
-40344,
-40198,
-40061,
-39893,
-39726,
-39528,
-39313,
-39066,
-38788,
-38474,
-38127,
-37739,
-37325,
-36877,
-36403,
-35912,
-35403,
-34885,
-34359,
-33839,
-33311,
-32811,
-32310,
-31848,
-31409,
-31013,
-30662,
-30371,
-30128,
-29957,
-29842,
-29785,
-29793,
-29835,
-29933,
-30057,
-30215,
-30386,
-30581,
-30778,
-30996,
-31203,
-31429,
-31640,
-31857,
-32061,
-32253,
-32429,
-32585,
-32711,
-32816,
-32887,
-32932,
-32950,
-32935,
-32896,
-32824,
-32725,
-32590,
-32417,
-32196,
-31932,
-31609,
-31231,
-30796,
-30297,
-29760,
-29157,
-28535,
-27865,
-27192,
-26498,
-25813,
-25135,
-24480,
-23856,
-23270,
-22738,
-22264,
-21860,
-21541,
-21297,
-21163,
-21115,
-21173,
-21324,
-21570,
-21899,
-22302,
-22761,
-23277,
-23819,
-24390,
-24971,
-25549,
-26123,
-26682,
-27213,
-27723,
-28189,
-28619,
-29005,
-29336,
-29620,
-29846,
-30018,
-30138,
-30209,
-30231,
-30220,
-30165,
-30089,
-29980,
-29852,
-29702,
-29527,
-29339,
-29121,
-28891,
-28631,
-28364,
-28073,
-27782,
-27481,
-27187,
-26904,
-26637,
-26396,
-26183,
-26002,
-25868,
-25762,
-25717,
-25708,
-25759,
-25861,
-26022,
-26242,
-26521,
-26859,
-27254,
-27697,
-28181,
-28702,
-29244,
-29798,
-30358,
-30906,
-31442,
-31952,
-32442,
-32898,
-33325,
-33723,
-34084,
-34425,
-34721,
-35000,
-35240,
-35456,
-35645,
-35804,
-35949,
-36068,
-36182,
-36277,
-36375,
-36464,
-36553,
-36637,
-36714,
-36783,
-36836,
-36865,
-36875,
-36849,
-36798,
-36716,
-36602,
-36466,
-36309,
-36133,
-35953,
-35760,
-35574,
-35389,
-35210,
-35048,
-34900,
-34775,
-34681,
-34614,
-34594,
-34618,
-34689,
-34817,
-34993,
-35222,
-35494,
-35806,
-36145,
-36508,
-36882,
-37258,
-37637,
-37999,
-38356,
-38692,
-39016,
-39313,
-39596,
-39845,
-40073,
-40264,
-40424,
-40540,
-40624,
-40656,
-40663,
-40619,
-40553,
-40451,
-40325,
-40178,
-40002,
-39814,
-39594,
-39356,
-39088,
-38793,
-38468,
-38116,
-37738,
-37342,
-36934,
-36521,
-36113,
-35718,
-35337,
-34991,
-34664,
-34382,
-34125,
-33918,
-33741,
-33616,
-33535,
-33502,
-33525,
-33593,
-33724,
-33895,
-34118,
-34370,
-34653,
-34950,
-35244,
-35539,
-35803,
-36044,
-36249,
-36409,
-36533,
-36608,
-36639,
-36629,
-36572,
-36473,
-36326,
-36142,
-35904,
-35639,
-35323,
-34985,
-34616,
-34235,
-33839,
-33455,
-33063,
-32700,
-32337,
-32008,
-31680,
-31382,
-31081,
-30806,
-30530,
-30268,
-30018,
-29781,
-29563,
-29367,
-29196,
-29055,
-28938,
-28851,
-28792,
-28750,
-28741,
-28737,
-28764,
-28801,
-28864,
-28949,
-29052,
-29188,
-29337,
-29516,
-29707,
-29907,
-30113,
-30305,
-30490,
-30647,
-30781,
-30886,
-30954,
-31001,
-31012,
-31004,
-30964,
-30907,
-30824,
-30718,
-30592,
-30437,
-30261,
-30064,
-29843,
-29620,
-29374,
-29142,
-28904,
-28683,
-28478,
-28282,
-28110,
-27947,
-27798,
-27656,
-27521,
-27389,
-27269,
-27145,
-27045,
-26951,
-26886,
-26843,
-26828,
-26845,
-26891,
-26968,
-27073,
-27204,
-27359,
-27544,
-27752,
-27991,
-28261,
-28559,
-28897,
-29259,
-29653,
-30065,
-30491,
-30918,
-31339,
-31737,
-32112,
-32452,
-32748,
-33009,
-33217,
-33388,
-33508,
-33588,
-33619,
-33604,
-33544,
-33429,
-33276,
-33066,
-32827,
-32541,
-32243,
-31918,
-31598,
-31278,
-30979,
-30701,
-30452,
-30238,
-30054,
-29911,
-29794,
-29722,
-29680,
-29677,
-29719,
-29796,
-29931,
-30103,
-30328,
-30595,
-30906,
-31244,
-31619,
-32002,
-32408,
-32812,
-33225,
-33631,
-34043,
-34439,
-34842,
-35228,
-35609,
-35970,
-36306,
-36617,
-36881,
-37111,
-37283,
-37405,
-37476,
-37490,
-37459,
-37386,
-37268,
-37125,
-36941,
-36737,
-36507,
-36251,
-35982,
-35688,
-35396,
-35084,
-34793,
-34500,
-34241,
-34006,
-33809,
-33656,
-33543,
-33479,
-33448,
-33463,
-33498,
-33571,
-33660,
-33771,
-33903,
-34045,
-34207,
-34380,
-34562,
-34754,
-34939,
-35129,
-35296,
-35457,
-35589,
-35702,
-35787,
-35856,
-35897,
-35934,
-35950,
-35968,
-35979,
-35984,
-35996,
-35990,
-35991,
-35971,
-35949,
-35910,
-35865,
-35805,
-35740,
-35666,
-35588,
-35509,
-35417,
-35325,
-35215,
-35098,
-34957,
-34805,
-34629,
-34433,
-34230,
-34005,
-33784,
-33557,
-33336,
-33122,
-32916,
-32726,
-32541,
-32372,
-32212,
-32061,
-31930,
-31804,
-31701,
-31614,
-31551,
-31514,
-31498,
-31507,
-31541,
-31590,
-31660,
-31739,
-31825,
-31929,
-32025,
-32137,
-32251,
-32368,
-32499,
-32624,
-32764,
-32890,
-33026,
-33136,
-33247,
-33329,
-33391,
-33426,
-33433,
-33407,
-33355,
-33271,
-33154,
-33012,
-32832,
-32627,
-32390,
-32121,
-31832,
-31512,
-31182,
-30833,
-30487,
-30143,
-29812,
-29506,
-29223,
-28986,
-28776,
-28622,
-28510,
-28450,
-28439,
-28483,
-28572,
-28722,
-28910,
-29156,
-29432,
-29756,
-30098,
-30470,
-30846,
-31234,
-31605,
-31972,
-32311,
-32630,
-32914,
-33163,
-33376,
-33551,
-33682,
-33773,
-33822,
-33824,
-33789,
-33712,
-33595,
-33448,
-33272,
-33070,
-32854,
-32626,
-32388,
-32156,
-31913,
-31691,
-31463,
-31253,
-31055,
-30868,
-30710,
-30565,
-30454,
-30369,
-30318,
-30303,
-30325,
-30379,
-30473,
-30591,
-30748,
-30926,
-31130,
-31357,
-31603,
-31869,
-32146,
-32438,
-32737,
-33036,
-33338,
-33621,
-33896,
-34144,
-34362,
-34557,
-34705,
-34830,
-34913,
-34967,
-34993,
-34990,
-34961,
-34912,
-34843,
-34753,
-34651,
-34529,
-34400,
-34268,
-34127,
-33996,
-33873,
-33761,
-33671,
-33594,
-33539,
-33497,
-33473,
-33450,
-33442,
-33426,
-33416,
-33399,
-33382,
-33363,
-33343,
-33323,
-33305,
-33290,
-33273,
-33256,
-33238,
-33217,
-33192,
-33167,
-33137,
-33122,
-33102,
-33110,
-33123,
-33165,
-33222,
-33302,
-33398,
-33505,
-33626,
-33738,
-33863,
-33970,
-34079,
-34173,
-34268,
-34344,
-34423,
-34483,
-34537,
-34578,
-34596,
-34595,
-34566,
-34514,
-34429,
-34324,
-34190,
-34044,
-33883,
-33712,
-33544,
-33370,
-33205,
-33035,
-32871,
-32707,
-32540,
-32380,
-32214,
-32062,
-31911,
-31785,
-31669,
-31586,
-31523,
-31496,
-31491,
-31521,
-31566,
-31642,
-31729,
-31839,
-31964,
-32104,
-32266,
-32439,
-32635,
-32843,
-33063,
-33292,
-33518,
-33738,
-33939,
-34115,
-34261,
-34371,
-34442,
-34474,
-34464,
-34418,
-34338,
-34223,
-34076,
-33903,
-33693,
-33466,
-33208,
-32930,
-32642,
-32338,
-32041,
-31751,
-31480,
-31240,
-31031,
-30867,
-30743,
-30668,
-30641,
-30649,
-30709,
-30798,
-30929,
-31093,
-31285,
-31513,
-31761,
-32039,
-32330,
-32642,
-32953,
-33271,
-33576,
-33867,
-34139,
-34380,
-34599,
-34779,
-34937,
-35054,
-35153,
-35210,
-35251,
-35257,
-35235,
-35187,
-35104,
-34998,
-34860,
-34701,
-34515,
-34317,
-34104,
-33884,
-33664,
-33447,
-33231,
-33032,
-32835,
-32660,
-32494,
-32347,
-32220,
-32116,
-32033,
-31985,
-31961,
-31974,
-32017,
-32095,
-32198,
-32339,
-32488,
-32673,
-32858,
-33063,
-33273,
-33479,
-33698,
-33898,
-34107,
-34298,
-34482,
-34648,
-34801,
-34927,
-35035,
-35117,
-35175,
-35209,
-35221,
-35213,
-35186,
-35148,
-35096,
-35034,
-34970,
-34889,
-34818,
-34730,
-34645,
-34556,
-34461,
-34372,
-34274,
-34184,
-34087,
-33998,
-33902,
-33810,
-33713,
-33616,
-33514,
-33405,
-33296,
-33178,
-33064,
-32944,
-32828,
-32715,
-32610,
-32510,
-32424,
-32345,
-32278,
-32230,
-32184,
-32167,
-32148,
-32160,
-32177,
-32216,
-32271,
-32336,
-32421,
-32512,
-32614,
-32722,
-32830,
-32936,
-33044,
-33136,
-33231,
-33306,
-33378,
-33433,
-33479,
-33509,
-33523,
-33526,
-33506,
-33467,
-33414,
-33336,
-33242,
-33135,
-32996,
-32866,
-32693,
-32541,
-32346,
-32174,
-31968,
-31774,
-31562,
-31355,
-31136,
-30928,
-30708,
-30509,
-30305,
-30125,
-29950,
-29800,
-29666,
-29554,
-29469,
-29397,
-29360,
-29338,
-29341,
-29367,
-29411,
-29482,
-29565,
-29672,
-29786,
-29920,
-30055,
-30199,
-30333,
-30472,
-30588,
-30704,
-30790,
-30866,
-30915,
-30947,
-30954,
-30941,
-30905,
-30847,
-30775,
-30671,
-30564,
-30425,
-30285,
-30122,
-29962,
-29784,
-29619,
-29441,
-29286,
-29121,
-28983,
-28842,
-28730,
-28613,
-28527,
-28441,
-28379,
-28325,
-28289,
-28268,
-28260,
-28271,
-28296,
-28337,
-28392,
-28460,
-28541,
-28632,
-28733,
-28840,
-28956,
-29076,
-29203,
-29334,
-29467,
-29607,
-29743,
-29884,
-30017,
-30151,
-30273,
-30394,
-30495,
-30596,
-30672,
-30747,
-30801,
-30847,
-30881,
-30903,
-30916,
-30925,
-30918,
-30913,
-30899,
-30881,
-30866,
-30848,
-30833,
-30823,
-30822,
-30824,
-30848,
-30867,
-30919,
-30966,
-31035,
-31118,
-31205,
-31314,
-31422,
-31549,
-31682,
-31823,
-31973,
-32131,
-32294,
-32468,
-32644,
-32825,
-33016,
-33201,
-33401,
-33592,
-33793,
-33994,
-34191,
-34398,
-34593,
-34801,
-34999,
-35198,
-35395,
-35584,
-35771,
-35948,
-36118,
-36275,
-36426,
-36556,
-36681,
-36787,
-36879,
-36965,
-37023,
-37087,
-37121,
-37157,
-37179,
-37188,
-37200,
-37198,
-37195,
-37194,
-37185,
-37187,
-37187,
-37194,
-37207,
-37231,
-37259,
-37301,
-37350,
-37410,
-37483,
-37556,
-37647,
-37741,
-37843,
-37953,
-38066,
-38187,
-38312,
-38437,
-38571,
-38701,
-38835,
-38968,
-39098,
-39227,
-39351,
-39467,
-39581,
-39678,
-39774,
-39852,
-39923,
-39975,
-40015,
-40035,
-40042,
-40024,
-39988,
-39930,
-39848,
-39744,
-39621,
-39464,
-39307,
-39105,
-38907,
-38680,
-38447,
-38200,
-37946,
-37687,
-37428,
-37167,
-36911,
-36660,
-36418,
-36187,
-35970,
-35765,
-35582,
-35411,
-35262,
-35130,
-35012,
-34922,
-34833,
-34771,
-34711,
-34671,
-34628,
-34603,
-34572,
-34548,
-34526,
-34497,
-34471,
-34432,
-34393,
-34342,
-34278,
-34209,
-34116,
-34015,
-33897,
-33759,
-33606,
-33436,
-33244,
-33042,
-32816,
-32575,
-32320,
-32045,
-31758,
-31458,
-31140,
-30819,
-30481,
-30144,
-29798,
-29454,
-29112,
-28774,
-28445,
-28127,
-27823,
-27533,
-27264,
-27009,
-26779,
-26568,
-26378,
-26218,
-26070,
-25958,
-25856,
-25786,
-25733,
-25700,
-25683,
-25683,
-25694,
-25716,
-25747,
-25781,
-25821,
-25860,
-25903,
-25940,
-25977,
-26012,
-26037,
-26063,
-26079,
-26081,
-26089,
-26072,
-26063,
-26027,
-26001,
-25949,
-25907,
-25846,
-25790,
-25723,
-25659,
-25587,
-25522,
-25448,
-25382,
-25310,
-25246,
-25182,
-25126,
-25075,
-25034,
-25003,
-24986,
-24978,
-24991,
-25016,
-25062,
-25123,
-25207,
-25303,
-25428,
-25567,
-25728,
-25911,
-26115,
-26332,
-26581,
-26828,
-27112,
-27387,
-27691,
-27988,
-28297,
-28605,
-28915,
-29220,
-29521,
-29818,
-30102,
-30388,
-30651,
-30918,
-31161,
-31403,
-31628,
-31845,
-32047,
-32243,
-32421,
-32602,
-32759,
-32924,
-33071,
-33220,
-33361,
-33498,
-33632,
-33762,
-33891,
-34016,
-34144,
-34265,
-34398,
-34523,
-34666,
-34801,
-34962,
-35117,
-35299,
-35481,
-35689,
-35900,
-36135,
-36376,
-36634,
-36904,
-37182,
-37474,
-37770,
-38070,
-38378,
-38677,
-38984,
-39277,
-39564,
-39842,
-40103,
-40350,
-40581,
-40792,
-40985,
-41160,
-41317,
-41453,
-41572,
-41680,
-41758,
-41837,
-41886,
-41928,
-41955,
-41967,
-41968,
-41958,
-41934,
-41909,
-41868,
-41831,
-41780,
-41733,
-41681,
-41631,
-41585,
-41537,
-41501,
-41462,
-41439,
-41418,
-41408,
-41406,
-41414,
-41427,
-41448,
-41475,
-41500,
-41531,
-41551,
-41578,
-41583,
-41591,
-41577,
-41555,
-41517,
-41461,
-41393,
-41304,
-41206,
-41084,
-40958,
-40810,
-40655,
-40486,
-40310,
-40120,
-39928,
-39725,
-39513,
-39303,
-39075,
-38855,
-38615,
-38385,
-38136,
-37890,
-37639,
-37383,
-37129,
-36867,
-36617,
-36356,
-36118,
-35869,
-35641,
-35417,
-35205,
-35006,
-34813,
-34632,
-34461,
-34287,
-34131,
-33958,
-33796,
-33619,
-33437,
-33243,
-33031,
-32810,
-32564,
-32307,
-32028,
-31735,
-31430,
-31108,
-30782,
-30448,
-30114,
-29778,
-29456,
-29129,
-28827,
-28526,
-28248,
-27978,
-27728,
-27484,
-27261,
-27039,
-26835,
-26626,
-26436,
-26236,
-26049,
-25856,
-25671,
-25484,
-25307,
-25125,
-24959,
-24792,
-24639,
-24491,
-24359,
-24229,
-24123,
-24008,
-23920,
-23822,
-23738,
-23648,
-23559,
-23458,
-23355,
-23235,
-23102,
-22956,
-22790,
-22617,
-22422,
-22229,
-22020,
-21816,
-21617,
-21421,
-21244,
-21086,
-20946,
-20834,
-20752,
-20693,
-20670,
-20669,
-20699,
-20751,
-20824,
-20912,
-21018,
-21127,
-21246,
-21363,
-21483,
-21598,
-21709,
-21817,
-21920,
-22024,
-22125,
-22230,
-22337,
-22453,
-22575,
-22707,
-22848,
-22996,
-23157,
-23314,
-23486,
-23647,
-23818,
-23976,
-24131,
-24277,
-24416,
-24543,
-24667,
-24778,
-24892,
-25000,
-25114,
-25242,
-25370,
-25534,
-25702,
-25914,
-26138,
-26409,
-26695,
-27027,
-27369,
-27750,
-28136,
-28544,
-28957,
-29364,
-29780,
-30167,
-30555,
-30917,
-31260,
-31581,
-31886,
-32164,
-32433,
-32684,
-32929,
-33164,
-33406,
-33641,
-33895,
-34147,
-34419,
-34695,
-34991,
-35292,
-35604,
-35921,
-36238,
-36556,
-36867,
-37174,
-37465,
-37754,
-38025,
-38294,
-38549,
-38807,
-39057,
-39320,
-39582,
-39864,
-40151,
-40465,
-40788,
-41137,
-41492,
-41873,
-42249,
-42645,
-43024,
-43405,
-43766,
-44104,
-44416,
-44690,
-44930,
-45130,
-45286,
-45406,
-45486,
-45538,
-45558,
-45564,
-45556,
-45540,
-45533,
-45529,
-45542,
-45572,
-45623,
-45695,
-45791,
-45898,
-46033,
-46162,
-46316,
-46451,
-46598,
-46719,
-46836,
-46926,
-47005,
-47049,
-47081,
-47091,
-47077,
-47059,
-47020,
-46980,
-46933,
-46887,
-46840,
-46795,
-46748,
-46701,
-46649,
-46586,
-46509,
-46414,
-46295,
-46143,
-45964,
-45740,
-45484,
-45187,
-44852,
-44488,
-44089,
-43669,
-43235,
-42791,
-42353,
-41922,
-41511,
-41125,
-40770,
-40451,
-40164,
-39919,
-39701,
-39517,
-39354,
-39208,
-39072,
-38936,
-38793,
-38641,
-38462,
-38265,
-38037,
-37778,
-37494,
-37171,
-36832,
-36458,
-36077,
-35666,
-35261,
-34833,
-34421,
-33992,
-33583,
-33160,
-32755,
-32337,
-31928,
-31506,
-31077,
-30638,
-30182,
-29711,
-29227,
-28719,
-28214,
-27684,
-27164,
-26639,
-26131,
-25633,
-25169,
-24725,
-24329,
-23964,
-23654,
-23385,
-23161,
-22990,
-22847,
-22748,
-22672,
-22614,
-22568,
-22520,
-22468,
-22389,
-22306,
-22172,
-22029,
-21841,
-21626,
-21387,
-21121,
-20839,
-20544,
-20246,
-19946,
-19655,
-19375,
-19108,
-18866,
-18635,
-18436,
-18246,
-18086,
-17931,
-17798,
-17673,
-17552,
-17446,
-17328,
-17228,
-17121,
-17024,
-16936,
-16857,
-16801,
-16763,
-16762,
-16785,
-16856,
-16964,
-17115,
-17307,
-17540,
-17806,
-18105,
-18426,
-18758,
-19103,
-19439,
-19770,
-20081,
-20365,
-20627,
-20845,
-21040,
-21194,
-21319,
-21418,
-21493,
-21554,
-21614,
-21668,
-21743,
-21829,
-21948,
-22089,
-22274,
-22486,
-22739,
-23023,
-23335,
-23676,
-24034,
-24406,
-24790,
-25176,
-25564,
-25948,
-26331,
-26705,
-27081,
-27450,
-27823,
-28196,
-28580,
-28971,
-29384,
-29802,
-30252,
-30707,
-31192,
-31685,
-32191,
-32702,
-33210,
-33711,
-34195,
-34653,
-35085,
-35480,
-35832,
-36151,
-36426,
-36665,
-36873,
-37052,
-37211,
-37367,
-37509,
-37672,
-37839,
-38038,
-38257,
-38523,
-38809,
-39151,
-39512,
-39918,
-40345,
-40795,
-41261,
-41726,
-42198,
-42649,
-43088,
-43503,
-43886,
-44248,
-44572,
-44866,
-45141,
-45383,
-45615,
-45825,
-46030,
-46226,
-46423,
-46612,
-46810,
-46997,
-47190,
-47372,
-47541,
-47704,
-47839,
-47950,
-48037,
-48080,
-48100,
-48074,
-48016,
-47928,
-47805,
-47670,
-47512,
-47352,
-47196,
-47047,
-46923,
-46823,
-46754,
-46720,
-46722,
-46755,
-46828,
-46914,
-47032,
-47148,
-47276,
-47385,
-47485,
-47549,
-47592,
-47575,
-47535,
-47430,
-47289,
-47101,
-46868,
-46606,
-46310,
-45993,
-45661,
-45320,
-44980,
-44636,
-44302,
-43971,
-43648,
-43327,
-43009,
-42686,
-42359,
-42014,
-41658,
-41277,
-40878,
-40453,
-40005,
-39536,
-39055,
-38554,
-38062,
-37559,
-37078,
-36612,
-36171,
-35766,
-35395,
-35065,
-34770,
-34517,
-34293,
-34095,
-33915,
-33743,
-33564,
-33379,
-33168,
-32926,
-32649,
-32324,
-31961,
-31551,
-31093,
-30607,
-30078,
-29534,
-28970,
-28403,
-27841,
-27290,
-26763,
-26255,
-25788,
-25346,
-24938,
-24560,
-24208,
-23874,
-23554,
-23239,
-22924,
-22603,
-22271,
-21921,
-21561,
-21184,
-20797,
-20407,
-20013,
-19633,
-19266,
-18926,
-18619,
-18347,
-18119,
-17940,
-17801,
-17713,
-17658,
-17640,
-17644,
-17667,
-17694,
-17715,
-17724,
-17707,
-17665,
-17586,
-17473,
-17327,
-17150,
-16951,
-16734,
-16517,
-16299,
-16104,
-15932,
-15801,
-15712,
-15674,
-15688,
-15757,
-15874,
-16035,
-16238,
-16467,
-16720,
-16976,
-17237,
-17483,
-17716,
-17925,
-18104,
-18266,
-18394,
-18511,
-18611,
-18705,
-18815,
-18925,
-19076,
-19244,
-19465,
-19719,
-20029,
-20374,
-20769,
-21194,
-21648,
-22124,
-22600,
-23090,
-23550,
-24005,
-24427,
-24818,
-25181,
-25508,
-25815,
-26091,
-26367,
-26627,
-26911,
-27195,
-27530,
-27884,
-28299,
-28750,
-29262,
-29811,
-30420,
-31047,
-31716,
-32387,
-33068,
-33731,
-34377,
-34980,
-35548,
-36056,
-36518,
-36922,
-37273,
-37584,
-37847,
-38095,
-38315,
-38541,
-38764,
-39013,
-39286,
-39591,
-39935,
-40312,
-40732,
-41173,
-41646,
-42127,
-42613,
-43095,
-43558,
-43993,
-44401,
-44766,
-45094,
-45384,
-45635,
-45861,
-46063,
-46256,
-46441,
-46644,
-46854,
-47101,
-47369,
-47680,
-48021,
-48393,
-48795,
-49207,
-49626,
-50037,
-50425,
-50780,
-51080,
-51327,
-51499,
-51601,
-51627,
-51574,
-51454,
-51272,
-51037,
-50766,
-50470,
-50164,
-49863,
-49578,
-49322,
-49100,
-48919,
-48780,
-48678,
-48617,
-48577,
-48561,
-48549,
-48534,
-48504,
-48451,
-48361,
-48241,
-48069,
-47866,
-47620,
-47343,
-47044,
-46731,
-46409,
-46099,
-45803,
-45527,
-45286,
-45071,
-44889,
-44733,
-44600,
-44474,
-44349,
-44215,
-44046,
-43845,
-43583,
-43266,
-42879,
-42414,
-41883,
-41270,
-40608,
-39879,
-39124,
-38333,
-37539,
-36757,
-35992,
-35275,
-34595,
-33992,
-33433,
-32959,
-32533,
-32174,
-31856,
-31581,
-31328,
-31088,
-30853,
-30594,
-30330,
-30023,
-29698,
-29330,
-28940,
-28514,
-28085,
-27631,
-27191,
-26754,
-26341,
-25957,
-25604,
-25294,
-25017,
-24779,
-24565,
-24379,
-24195,
-24019,
-23821,
-23598,
-23339,
-23036,
-22674,
-22268,
-21793,
-21283,
-20718,
-20135,
-19521,
-18921,
-18317,
-17764,
-17238,
-16787,
-16395,
-16090,
-15858,
-15714,
-15647,
-15647,
-15718,
-15827,
-15981,
-16149,
-16331,
-16499,
-16664,
-16789,
-16902,
-16967,
-17013,
-17028,
-17024,
-17009,
-16994,
-16981,
-16993,
-17023,
-17088,
-17191,
-17322,
-17496,
-17694,
-17918,
-18157,
-18398,
-18633,
-18854,
-19045,
-19209,
-19327,
-19411,
-19451,
-19461,
-19434,
-19400,
-19346,
-19311,
-19291,
-19303,
-19369,
-19484,
-19674,
-19927,
-20259,
-20656,
-21128,
-21644,
-22222,
-22820,
-23446,
-24076,
-24697,
-25298,
-25867,
-26401,
-26889,
-27331,
-27735,
-28089,
-28422,
-28720,
-29007,
-29284,
-29568,
-29859,
-30169,
-30501,
-30852,
-31230,
-31625,
-32032,
-32454,
-32863,
-33274,
-33657,
-34020,
-34352,
-34642,
-34901,
-35117,
-35303,
-35462,
-35601,
-35732,
-35866,
-36008,
-36183,
-36385,
-36633,
-36928,
-37273,
-37667,
-38110,
-38593,
-39106,
-39645,
-40184,
-40731,
-41249,
-41748,
-42202,
-42609,
-42963,
-43258,
-43495,
-43679,
-43811,
-43898,
-43951,
-43980,
-43988,
-43999,
-44000,
-44022,
-44051,
-44097,
-44163,
-44242,
-44332,
-44428,
-44522,
-44610,
-44677,
-44727,
-44746,
-44737,
-44690,
-44619,
-44511,
-44383,
-44240,
-44077,
-43930,
-43775,
-43649,
-43542,
-43464,
-43427,
-43421,
-43455,
-43517,
-43611,
-43721,
-43842,
-43967,
-44071,
-44166,
-44215,
-44239,
-44203,
-44123,
-43987,
-43800,
-43563,
-43282,
-42964,
-42617,
-42254,
-41879,
-41505,
-41139,
-40788,
-40454,
-40147,
-39858,
-39595,
-39350,
-39122,
-38901,
-38688,
-38467,
-38243,
-38006,
-37749,
-37479,
-37184,
-36881,
-36554,
-36227,
-35890,
-35558,
-35242,
-34933,
-34656,
-34403,
-34179,
-33991,
-33833,
-33703,
-33599,
-33512,
-33441,
-33368,
-33296,
-33205,
-33100,
-32965,
-32799,
-32600,
-32365,
-32098,
-31795,
-31470,
-31121,
-30763,
-30392,
-30032,
-29671,
-29338,
-29014,
-28731,
-28459,
-28232,
-28022,
-27845,
-27687,
-27547,
-27420,
-27301,
-27185,
-27063,
-26940,
-26809,
-26670,
-26525,
-26371,
-26222,
-26066,
-25928,
-25791,
-25681,
-25583,
-25518,
-25469,
-25464,
-25470,
-25514,
-25573,
-25655,
-25746,
-25848,
-25942,
-26040,
-26119,
-26188,
-26228,
-26256,
-26248,
-26231,
-26182,
-26122,
-26046,
-25965,
-25879,
-25803,
-25725,
-25678,
-25630,
-25623,
-25622,
-25656,
-25703,
-25778,
-25864,
-25968,
-26076,
-26193,
-26310,
-26421,
-26534,
-26632,
-26727,
-26817,
-26893,
-26978,
-27054,
-27137,
-27233,
-27333,
-27459,
-27594,
-27759,
-27939,
-28150,
-28370,
-28618,
-28878,
-29143,
-29424,
-29692,
-29965,
-30223,
-30465,
-30692,
-30894,
-31076,
-31234,
-31370,
-31486,
-31585,
-31669,
-31746,
-31817,
-31885,
-31961,
-32036,
-32126,
-32222,
-32331,
-32450,
-32575,
-32714,
-32849,
-32995,
-33129,
-33271,
-33394,
-33520,
-33629,
-33729,
-33824,
-33906,
-33985,
-34065,
-34137,
-34225,
-34311,
-34415,
-34531,
-34663,
-34816,
-34982,
-35171,
-35369,
-35587,
-35804,
-36037,
-36259,
-36482,
-36693,
-36888,
-37067,
-37220,
-37353,
-37459,
-37538,
-37595,
-37626,
-37640,
-37629,
-37613,
-37581,
-37540,
-37501,
-37454,
-37413,
-37374,
-37338,
-37306,
-37273,
-37247,
-37219,
-37189,
-37158,
-37118,
-37076,
-37022,
-36970,
-36900,
-36837,
-36758,
-36690,
-36616,
-36550,
-36492,
-36444,
-36410,
-36391,
-36388,
-36402,
-36434,
-36478,
-36538,
-36602,
-36682,
-36750,
-36827,
-36889,
-36944,
-36979,
-36996,
-36993,
-36960,
-36911,
-36830,
-36728,
-36609,
-36461,
-36311,
-36136,
-35959,
-35778,
-35589,
-35409,
-35222,
-35049,
-34873,
-34708,
-34545,
-34389,
-34236,
-34085,
-33938,
-33786,
-33640,
-33489,
-33339,
-33189,
-33040,
-32895,
-32753,
-32621,
-32495,
-32387,
-32287,
-32208,
-32144,
-32100,
-32072,
-32061,
-32063,
-32079,
-32102,
-32128,
-32157,
-32181,
-32197,
-32203,
-32194,
-32163,
-32125,
-32054,
-31971,
-31867,
-31744,
-31608,
-31459,
-31301,
-31134,
-30972,
-30800,
-30643,
-30484,
-30338,
-30198,
-30068,
-29950,
-29839,
-29736,
-29639,
-29552,
-29461,
-29383,
-29300,
-29223,
-29154,
-29078,
-29017,
-28957,
-28907,
-28868,
-28840,
-28826,
-28831,
-28846,
-28884,
-28933,
-29001,
-29084,
-29176,
-29278,
-29384,
-29495,
-29601,
-29704,
-29797,
-29875,
-29946,
-29991,
-30031,
-30039,
-30047,
-30027,
-30001,
-29964,
-29918,
-29866,
-29820,
-29763,
-29725,
-29678,
-29647,
-29622,
-29605,
-29598,
-29597,
-29606,
-29618,
-29642,
-29659,
-29693,
-29716,
-29752,
-29783,
-29817,
-29860,
-29896,
-29948,
-30001,
-30064,
-30139,
-30220,
-30319,
-30422,
-30547,
-30673,
-30818,
-30960,
-31117,
-31270,
-31425,
-31578,
-31721,
-31860,
-31984,
-32101,
-32192,
-32286,
-32342,
-32409,
-32440,
-32476,
-32490,
-32506,
-32511,
-32515,
-32519,
-32523,
-32534,
-32545,
-32568,
-32589,
-32626,
-32656,
-32704,
-32747,
-32795,
-32850,
-32898,
-32952,
-33003,
-33057,
-33106,
-33164,
-33212,
-33270,
-33327,
-33388,
-33453,
-33526,
-33598,
-33683,
-33768,
-33862,
-33958,
-34059,
-34159,
-34263,
-34360,
-34456,
-34546,
-34627,
-34700,
-34759,
-34811,
-34846,
-34876,
-34885,
-34893,
-34885,
-34873,
-34855,
-34830,
-34804,
-34781,
-34752,
-34733,
-34711,
-34695,
-34687,
-34677,
-34680,
-34678,
-34689,
-34694,
-34713,
-34719,
-34742,
-34750,
-34769,
-34782,
-34796,
-34810,
-34823,
-34836,
-34849,
-34863,
-34877,
-34895,
-34910,
-34931,
-34946,
-34968,
-34984,
-35003,
-35017,
-35028,
-35037,
-35036,
-35037,
-35021,
-35008,
-34978,
-34947,
-34907,
-34859,
-34804,
-34746,
-34681,
-34613,
-34548,
-34475,
-34408,
-34343,
-34278,
-34220,
-34167,
-34113,
-34078,
-34034,
-34009,
-33977,
-33963,
-33940,
-33933,
-33920,
-33914,
-33911,
-33904,
-33901,
-33897,
-33891,
-33887,
-33876,
-33868,
-33853,
-33839,
-33820,
-33801,
-33769,
-33751,
-33707,
-33682,
-33637,
-33593,
-33548,
-33494,
-33439,
-33380,
-33316,
-33247,
-33180,
-33102,
-33029,
-32950,
-32871,
-32794,
-32714,
-32637,
-32562,
-32493,
-32424,
-32364,
-32306,
-32259,
-32215,
-32182,
-32154,
-32134,
-32124,
-32119,
-32123,
-32131,
-32144,
-32166,
-32184,
-32212,
-32231,
-32259,
-32278,
-32297,
-32312,
-32316,
-32325,
-32314,
-32308,
-32286,
-32260,
-32231,
-32185,
-32146,
-32088,
-32036,
-31972,
-31911,
-31843,
-31775,
-31706,
-31636,
-31571,
-31501,
-31439,
-31374,
-31319,
-31260,
-31212,
-31166,
-31123,
-31091,
-31061,
-31041,
-31028,
-31026,
-31026,
-31045,
-31067,
-31099,
-31146,
-31193,
-31259,
-31324,
-31399,
-31477,
-31561,
-31640,
-31729,
-31805,
-31882,
-31955,
-32016,
-32068,
-32117,
-32142,
-32170,
-32171,
-32174,
-32151,
-32135,
-32092,
-32054,
-32005,
-31945,
-31894,
-31829,
-31771,
-31712,
-31653,
-31600,
-31546,
-31503,
-31459,
-31426,
-31395,
-31374,
-31356,
-31353,
-31348,
-31363,
-31376,
-31406,
-31442,
-31492,
-31549,
-31619,
-31699,
-31789,
-31892,
-32000,
-32119,
-32243,
-32377,
-32505,
-32641,
-32772,
-32896,
-33018,
-33127,
-33223,
-33314,
-33376,
-33438,
-33470,
-33497,
-33498,
-33491,
-33464,
-33428,
-33379,
-33321,
-33256,
-33183,
-33110,
-33032,
-32957,
-32884,
-32809,
-32746,
-32683,
-32626,
-32580,
-32533,
-32501,
-32473,
-32454,
-32443,
-32443,
-32448,
-32472,
-32500,
-32541,
-32600,
-32662,
-32748,
-32834,
-32943,
-33051,
-33182,
-33304,
-33445,
-33580,
-33718,
-33855,
-33982,
-34105,
-34215,
-34310,
-34394,
-34454,
-34500,
-34525,
-34527,
-34513,
-34482,
-34423,
-34365,
-34275,
-34186,
-34084,
-33972,
-33860,
-33740,
-33621,
-33505,
-33387,
-33275,
-33167,
-33062,
-32967,
-32877,
-32790,
-32725,
-32650,
-32602,
-32554,
-32520,
-32500,
-32492,
-32493,
-32520,
-32543,
-32603,
-32653,
-32740,
-32823,
-32926,
-33037,
-33153,
-33278,
-33399,
-33524,
-33640,
-33752,
-33850,
-33935,
-34007,
-34057,
-34091,
-34104,
-34097,
-34066,
-34025,
-33953,
-33876,
-33777,
-33666,
-33544,
-33419,
-33277,
-33145,
-32996,
-32858,
-32718,
-32578,
-32447,
-32317,
-32192,
-32081,
-31966,
-31875,
-31773,
-31703,
-31625,
-31575,
-31526,
-31499,
-31487,
-31484,
-31510,
-31540,
-31596,
-31663,
-31749,
-31843,
-31961,
-32073,
-32205,
-32333,
-32467,
-32599,
-32721,
-32841,
-32944,
-33039,
-33113,
-33174,
-33211,
-33235,
-33236,
-33217,
-33185,
-33127,
-33065,
-32982,
-32891,
-32789,
-32682,
-32567,
-32452,
-32332,
-32212,
-32099,
-31977,
-31870,
-31760,
-31658,
-31561,
-31474,
-31389,
-31323,
-31257,
-31211,
-31172,
-31147,
-31143,
-31144,
-31178,
-31210,
-31274,
-31344,
-31440,
-31542,
-31665,
-31795,
-31934,
-32082,
-32232,
-32381,
-32531,
-32673,
-32804,
-32930,
-33036,
-33130,
-33209,
-33266,
-33308,
-33332,
-33337,
-33328,
-33302,
-33264,
-33213,
-33152,
-33084,
-33004,
-32927,
-32838,
-32753,
-32664,
-32574,
-32489,
-32402,
-32319,
-32242,
-32165,
-32095,
-32035,
-31976,
-31932,
-31894,
-31867,
-31856,
-31853,
-31872,
-31898,
-31946,
-32009,
-32085,
-32179,
-32286,
-32401,
-32532,
-32665,
-32807,
-32947,
-33088,
-33228,
-33354,
-33479,
-33588,
-33684,
-33768,
-33836,
-33885,
-33921,
-33940,
-33946,
-33933,
-33918,
-33877,
-33841,
-33786,
-33732,
-33670,
-33603,
-33536,
-33464,
-33392,
-33318,
-33241,
-33171,
-33091,
-33023,
-32947,
-32879,
-32812,
-32749,
-32699,
-32647,
-32614,
-32581,
-32572,
-32563,
-32580,
-32602,
-32642,
-32699,
-32763,
-32845,
-32933,
-33034,
-33134,
-33245,
-33349,
-33456,
-33553,
-33642,
-33724,
-33787,
-33847,
-33880,
-33908,
-33917,
-33910,
-33899,
-33865,
-33834,
-33785,
-33734,
-33680,
-33619,
-33561,
-33498,
-33438,
-33377,
-33317,
-33259,
-33200,
-33143,
-33086,
-33024,
-32969,
-32907,
-32847,
-32789,
-32729,
-32673,
-32622,
-32572,
-32536,
-32501,
-32483,
-32470,
-32474,
-32486,
-32514,
-32550,
-32598,
-32654,
-32716,
-32784,
-32848,
-32920,
-32978,
-33037,
-33084,
-33120,
-33145,
-33158,
-33156,
-33141,
-33118,
-33077,
-33033,
-32982,
-32923,
-32867,
-32810,
-32752,
-32705,
-32659,
-32621,
-32591,
-32567,
-32545,
-32536,
-32520,
-32517,
-32506,
-32498,
-32487,
-32473,
-32451,
-32434,
-32400,
-32376,
-32341,
-32304,
-32275,
-32239,
-32215,
-32191,
-32178,
-32169,
-32176,
-32184,
-32210,
-32237,
-32274,
-32316,
-32360,
-32404,
-32449,
-32487,
-32521,
-32542,
-32562,
-32564,
-32561,
-32546,
-32523,
-32492,
-32460,
-32418,
-32384,
-32342,
-32315,
-32285,
-32271,
-32262,
-32265,
-32278,
-32300,
-32332,
-32370,
-32413,
-32463,
-32505,
-32554,
-32589,
-32628,
-32650,
-32670,
-32674,
-32673,
-32666,
-32643,
-32628,
-32593,
-32572,
-32541,
-32520,
-32501,
-32488,
-32483,
-32490,
-32498,
-32524,
-32548,
-32580,
-32622,
-32655,
-32699,
-32731,
-32764,
-32792,
-32807,
-32823,
-32821,
-32820,
-32807,
-32792,
-32770,
-32749,
-32730,
-32710,
-32699,
-32693,
-32694,
-32707,
-32725,
-32757,
-32795,
-32841,
-32892,
-32949,
-33002,
-33064,
-33113,
-33163,
-33206,
-33237,
-33265,
-33279,
-33282,
-33286,
-33267,
-33258,
-33231,
-33209,
-33183,
-33156,
-33138,
-33115,
-33104,
-33095,
-33089,
-33096,
-33095,
-33109,
-33115,
-33128,
-33136,
-33143,
-33144,
-33143,
-33131,
-33120,
-33094,
-33073,
-33038,
-33006,
-32970,
-32932,
-32900,
-32866,
-32846,
-32819,
-32816,
-32805,
-32818,
-32832,
-32853,
-32891,
-32922,
-32972,
-33018,
-33066,
-33116,
-33163,
-33204,
-33246,
-33277,
-33301,
-33319,
-33327,
-33329,
-33320,
-33306,
-33284,
-33251,
-33223,
-33176,
-33137,
-33085,
-33034,
-32982,
-32923,
-32868,
-32810,
-32748,
-32694,
-32633,
-32576,
-32520,
-32467,
-32411,
-32367,
-32318,
-32279,
-32246,
-32213,
-32193,
-32174,
-32171,
-32164,
-32179,
-32188,
-32214,
-32243,
-32278,
-32320,
-32369,
-32415,
-32473,
-32523,
-32585,
-32633,
-32693,
-32738,
-32784,
-32829,
-32854,
-32887,
-32897,
-32906,
-32898,
-32885,
-32850,
-32815,
-32758,
-32692,
-32619,
-32529,
-32438,
-32334,
-32228,
-32118,
-32010,
-31905,
-31804,
-31714,
-31632,
-31569,
-31515,
-31486,
-31470,
-31474,
-31500,
-31540,
-31601,
-31675,
-31760,
-31861,
-31962,
-32072,
-32182,
-32287,
-32394,
-32487,
-32579,
-32652,
-32723,
-32775,
-32820,
-32851,
-32874,
-32887,
-32892,
-32888,
-32880,
-32866,
-32849,
-32825,
-32802,
-32765,
-32736,
-32688,
-32648,
-32590,
-32532,
-32466,
-32392,
-32317,
-32233,
-32152,
-32070,
-31991,
-31923,
-31859,
-31820,
-31786,
-31784,
-31798,
-31841,
-31905,
-32001,
-32113,
-32256,
-32410,
-32585,
-32765,
-32949,
-33135,
-33310,
-33473,
-33619,
-33738,
-33837,
-33901,
-33942,
-33948,
-33930,
-33884,
-33817,
-33731,
-33633,
-33525,
-33416,
-33306,
-33203,
-33110,
-33028,
-32960,
-32906,
-32866,
-32844,
-32828,
-32825,
-32830,
-32836,
-32850,
-32860,
-32871,
-32878,
-32887,
-32890,
-32896,
-32908,
-32915,
-32941,
-32970,
-33014,
-33076,
-33148,
-33242,
-33349,
-33469,
-33605,
-33738,
-33889,
-34019,
-34158,
-34268,
-34365,
-34440,
-34474,
-34490,
-34459,
-34402,
-34310,
-34184,
-34037,
-33866,
-33685,
-33493,
-33305,
-33121,
-32957,
-32811,
-32696,
-32604,
-32549,
-32526,
-32533,
-32569,
-32636,
-32711,
-32816,
-32915,
-33029,
-33130,
-33230,
-33313,
-33382,
-33434,
-33465,
-33480,
-33481,
-33465,
-33441,
-33412,
-33379,
-33347,
-33324,
-33302,
-33294,
-33291,
-33299,
-33311,
-33331,
-33344,
-33363,
-33363,
-33360,
-33336,
-33293,
-33233,
-33149,
-33043,
-32924,
-32781,
-32636,
-32480,
-32329,
-32181,
-32052,
-31938,
-31856,
-31797,
-31777,
-31787,
-31833,
-31909,
-32015,
-32142,
-32287,
-32439,
-32597,
-32744,
-32879,
-32995,
-33083,
-33141,
-33169,
-33161,
-33122,
-33050,
-32956,
-32836,
-32705,
-32563,
-32419,
-32281,
-32152,
-32039,
-31944,
-31869,
-31818,
-31788,
-31779,
-31784,
-31807,
-31833,
-31873,
-31903,
-31937,
-31959,
-31977,
-31978,
-31976,
-31956,
-31938,
-31909,
-31884,
-31857,
-31844,
-31838,
-31851,
-31878,
-31925,
-31990,
-32072,
-32171,
-32278,
-32393,
-32510,
-32618,
-32719,
-32801,
-32861,
-32896,
-32901,
-32875,
-32819,
-32736,
-32622,
-32493,
-32340,
-32187,
-32026,
-31876,
-31732,
-31614,
-31512,
-31452,
-31410,
-31412,
-31440,
-31500,
-31591,
-31701,
-31832,
-31973,
-32121,
-32268,
-32409,
-32539,
-32654,
-32752,
-32830,
-32890,
-32929,
-32951,
-32961,
-32955,
-32949,
-32933,
-32917,
-32908,
-32899,
-32900,
-32905,
-32915,
-32936,
-32954,
-32973,
-32993,
-32999,
-33008,
-32993,
-32975,
-32937,
-32888,
-32824,
-32752,
-32667,
-32584,
-32496,
-32418,
-32345,
-32291,
-32252,
-32239,
-32247,
-32286,
-32346,
-32436,
-32544,
-32677,
-32820,
-32974,
-33134,
-33289,
-33437,
-33573,
-33687,
-33784,
-33854,
-33898,
-33917,
-33907,
-33877,
-33824,
-33757,
-33673,
-33585,
-33491,
-33397,
-33309,
-33230,
-33153,
-33103,
-33047,
-33019,
-32997,
-32981,
-32983,
-32985,
-32990,
-33006,
-33012,
-33024,
-33031,
-33038,
-33037,
-33045,
-33042,
-33046,
-33053,
-33061,
-33080,
-33103,
-33134,
-33175,
-33225,
-33281,
-33344,
-33408,
-33475,
-33540,
-33599,
-33654,
-33690,
-33721,
-33731,
-33722,
-33705,
-33657,
-33603,
-33529,
-33441,
-33347,
-33242,
-33141,
-33033,
-32938,
-32843,
-32765,
-32699,
-32648,
-32614,
-32598,
-32594,
-32611,
-32636,
-32680,
-32725,
-32782,
-32837,
-32900,
-32953,
-33013,
-33054,
-33105,
-33127,
-33163,
-33170,
-33186,
-33178,
-33176,
-33157,
-33139,
-33112,
-33082,
-33046,
-33009,
-32968,
-32924,
-32876,
-32828,
-32771,
-32723,
-32660,
-32604,
-32545,
-32482,
-32426,
-32367,
-32316,
-32267,
-32226,
-32193,
-32168,
-32155,
-32153,
-32161,
-32182,
-32214,
-32257,
-32308,
-32368,
-32434,
-32503,
-32577,
-32647,
-32716,
-32780,
-32837,
-32883,
-32924,
-32944,
-32962,
-32958,
-32945,
-32918,
-32877,
-32824,
-32766,
-32689,
-32613,
-32527,
-32430,
-32347,
-32242,
-32158,
-32062,
-31978,
-31899,
-31828,
-31769,
-31719,
-31682,
-31661,
-31653,
-31662,
-31686,
-31728,
-31781,
-31853,
-31938,
-32031,
-32144,
-32252,
-32376,
-32497,
-32620,
-32739,
-32854,
-32955,
-33053,
-33128,
-33197,
-33238,
-33274,
-33277,
-33276,
-33241,
-33205,
-33138,
-33070,
-32977,
-32884,
-32774,
-32667,
-32548,
-32436,
-32316,
-32209,
-32098,
-32001,
-31911,
-31827,
-31765,
-31706,
-31668,
-31646,
-31634,
-31652,
-31677,
-31729,
-31797,
-31881,
-31992,
-32113,
-32252,
-32410,
-32572,
-32748,
-32931,
-33109,
-33295,
-33463,
-33628,
-33775,
-33903,
-34008,
-34090,
-34136,
-34162,
-34148,
-34110,
-34037,
-33938,
-33811,
-33669,
-33496,
-33323,
-33131,
-32937,
-32750,
-32558,
-32383,
-32222,
-32074,
-31953,
-31845,
-31772,
-31713,
-31689,
-31683,
-31705,
-31749,
-31815,
-31902,
-32008,
-32129,
-32270,
-32420,
-32584,
-32756,
-32937,
-33125,
-33311,
-33503,
-33690,
-33870,
-34047,
-34202,
-34353,
-34470,
-34579,
-34648,
-34697,
-34707,
-34684,
-34626,
-34535,
-34403,
-34242,
-34052,
-33829,
-33594,
-33332,
-33070,
-32798,
-32533,
-32280,
-32038,
-31828,
-31640,
-31488,
-31377,
-31296,
-31265,
-31268,
-31315,
-31397,
-31516,
-31661,
-31835,
-32029,
-32240,
-32462,
-32687,
-32916,
-33138,
-33361,
-33560,
-33758,
-33930,
-34089,
-34228,
-34342,
-34437,
-34505,
-34551,
-34570,
-34563,
-34528,
-34468,
-34376,
-34263,
-34115,
-33946,
-33749,
-33531,
-33292,
-33041,
-32768,
-32502,
-32225,
-31956,
-31701,
-31459,
-31248,
-31061,
-30915,
-30804,
-30744,
-30724,
-30753,
-30832,
-30949,
-31117,
-31314,
-31548,
-31805,
-32081,
-32367,
-};
@@ -1,1018 +0,0 @@
-/**********************************************************************
-* Written by WAVToCode
-* Date:				Thu Mar 31 02:26:55 PM
-* FileName:			got_shot_wav.C
-* Interleaved:		N/A
-* Signed:			No
-* No. of channels:	1
-* No. of samples:	8032
-* Bits/Sample:		16
-**********************************************************************/
-
-#define ROBLOX_OOF_NUM_ELEMENTS 8032
-
-unsigned long robloxOof[ROBLOX_OOF_NUM_ELEMENTS] = {
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 0-7 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 8-15 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 16-23 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 24-31 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 32-39 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 40-47 */
-32768, 32768, 32768, 32770, 32768, 32768, 32768, 32768, /* 48-55 */
-32768, 32768, 32768, 32768, 32766, 32768, 32768, 32768, /* 56-63 */
-32768, 32768, 32770, 32768, 32768, 32768, 32768, 32770, /* 64-71 */
-32768, 32768, 32766, 32766, 32768, 32768, 32768, 32770, /* 72-79 */
-32768, 32768, 32766, 32768, 32770, 32768, 32766, 32766, /* 80-87 */
-32766, 32766, 32768, 32768, 32766, 32766, 32768, 32768, /* 88-95 */
-32766, 32766, 32766, 32766, 32768, 32764, 32764, 32766, /* 96-103 */
-32770, 32772, 32770, 32772, 32770, 32768, 32766, 32766, /* 104-111 */
-32766, 32772, 32776, 32772, 32766, 32766, 32766, 32768, /* 112-119 */
-32770, 32764, 32762, 32762, 32764, 32762, 32758, 32766, /* 120-127 */
-32772, 32776, 32780, 32778, 32774, 32772, 32772, 32766, /* 128-135 */
-32760, 32758, 32762, 32760, 32762, 32766, 32770, 32772, /* 136-143 */
-32770, 32764, 32758, 32758, 32756, 32748, 32738, 32738, /* 144-151 */
-32750, 32766, 32780, 32778, 32772, 32776, 32790, 32812, /* 152-159 */
-32830, 32838, 32822, 32800, 32788, 32786, 32786, 32774, /* 160-167 */
-32748, 32732, 32744, 32768, 32772, 32742, 32732, 32766, /* 168-175 */
-32822, 32860, 32850, 32836, 32906, 33060, 33160, 33062, /* 176-183 */
-32792, 32524, 32404, 32432, 32508, 32500, 32406, 32384, /* 184-191 */
-32460, 32562, 32664, 32756, 32838, 32922, 32962, 32928, /* 192-199 */
-32846, 32774, 32774, 32770, 32700, 32624, 32564, 32546, /* 200-207 */
-32664, 32864, 33002, 33112, 33196, 33220, 33240, 33264, /* 208-215 */
-33232, 33096, 32936, 32862, 32804, 32648, 32518, 32482, /* 216-223 */
-32462, 32550, 32696, 32750, 32720, 32720, 32830, 33044, /* 224-231 */
-33296, 33518, 33630, 33394, 32884, 32344, 31890, 31728, /* 232-239 */
-31780, 31826, 31798, 31748, 31840, 32176, 32632, 33044, /* 240-247 */
-33376, 33524, 33454, 33284, 33078, 32886, 32738, 32576, /* 248-255 */
-32410, 32254, 32092, 32090, 32290, 32608, 33048, 33454, /* 256-263 */
-33652, 33736, 33818, 33878, 33862, 33730, 33446, 33010, /* 264-271 */
-32532, 32198, 32056, 32042, 32088, 32230, 32426, 32626, /* 272-279 */
-32928, 33216, 33550, 34026, 34418, 34530, 34048, 33028, /* 280-287 */
-31886, 31084, 30858, 30816, 30822, 30824, 30748, 30920, /* 288-295 */
-31446, 32276, 33140, 33852, 34388, 34348, 33868, 33396, /* 296-303 */
-33048, 32858, 32684, 32420, 31816, 31110, 31002, 31516, /* 304-311 */
-32322, 33134, 33892, 34430, 34654, 34892, 35044, 35008, /* 312-319 */
-34794, 34362, 33656, 32656, 31750, 31118, 30870, 31018, /* 320-327 */
-31354, 31796, 32414, 33402, 34578, 35702, 36304, 35856, /* 328-335 */
-34576, 32948, 31518, 30450, 29516, 28782, 28416, 28532, /* 336-343 */
-29168, 30164, 31286, 32492, 33856, 35016, 35534, 35444, /* 344-351 */
-34972, 34494, 34062, 33390, 32462, 31396, 30546, 30308, /* 352-359 */
-30632, 31190, 31994, 33078, 34284, 35462, 36288, 36638, /* 360-367 */
-36514, 36126, 35584, 34696, 33560, 32362, 31316, 30484, /* 368-375 */
-30256, 30940, 32118, 33472, 34398, 34472, 33978, 33388, /* 376-383 */
-33100, 32666, 31788, 30730, 29636, 28882, 28526, 28668, /* 384-391 */
-29186, 29942, 31216, 32290, 32924, 33398, 34076, 35218, /* 392-399 */
-35824, 35716, 34950, 33818, 33020, 32486, 32306, 32110, /* 400-407 */
-31920, 32092, 32544, 33156, 33846, 34694, 35412, 35934, /* 408-415 */
-36052, 35694, 35026, 34144, 33408, 32962, 33102, 33360, /* 416-423 */
-33438, 33108, 32108, 31366, 30824, 30760, 30830, 30108, /* 424-431 */
-29676, 29638, 29878, 30196, 30354, 30832, 31156, 31682, /* 432-439 */
-32148, 32082, 32112, 32284, 33156, 33938, 33926, 33784, /* 440-447 */
-33462, 33578, 34138, 34502, 34586, 34406, 34442, 34688, /* 448-455 */
-34842, 34930, 34842, 34842, 34896, 34624, 34238, 33564, /* 456-463 */
-33330, 33878, 34622, 35600, 35702, 34928, 33694, 32238, /* 464-471 */
-31170, 30068, 28888, 27480, 26608, 26322, 26484, 27448, /* 472-479 */
-28322, 29538, 30924, 32302, 33682, 34250, 34196, 34054, /* 480-487 */
-34362, 34458, 33856, 32808, 31838, 31844, 32256, 32536, /* 488-495 */
-33006, 33646, 34600, 35876, 36908, 37468, 37528, 37374, /* 496-503 */
-37242, 36816, 35544, 34002, 33450, 33646, 34304, 34380, /* 504-511 */
-33720, 32930, 31738, 31058, 30374, 29558, 28326, 26998, /* 512-519 */
-26708, 26532, 27278, 27982, 28462, 29676, 30608, 31996, /* 520-527 */
-32950, 33206, 33522, 33940, 34620, 34680, 34252, 33416, /* 528-535 */
-32960, 33430, 33768, 34088, 34184, 34196, 35032, 36284, /* 536-543 */
-37074, 37226, 36990, 36800, 36858, 36306, 35476, 35128, /* 544-551 */
-35174, 35804, 35764, 34948, 33504, 31604, 30464, 29124, /* 552-559 */
-27860, 26442, 24868, 24366, 24588, 25968, 27440, 28534, /* 560-567 */
-29670, 30826, 32380, 33606, 34320, 34374, 34098, 33924, /* 568-575 */
-33758, 33278, 32672, 32448, 32768, 33804, 34530, 35318, /* 576-583 */
-35884, 36490, 37938, 38716, 39136, 38680, 37896, 37304, /* 584-591 */
-36304, 35878, 35486, 35694, 35764, 35028, 34406, 32924, /* 592-599 */
-31240, 29884, 28482, 27388, 25904, 23976, 22966, 23084, /* 600-607 */
-24382, 26240, 27490, 28454, 29164, 30626, 32608, 33974, /* 608-615 */
-34800, 34408, 34186, 34380, 34026, 33622, 33082, 33348, /* 616-623 */
-34316, 35118, 35620, 35876, 36646, 37798, 39160, 39866, /* 624-631 */
-39450, 38636, 37688, 37604, 37738, 37680, 37478, 36418, /* 632-639 */
-35462, 34186, 32424, 30586, 28514, 26752, 25278, 23848, /* 640-647 */
-22076, 21066, 21634, 23644, 26282, 27708, 28500, 29440, /* 648-655 */
-30936, 33018, 34598, 34890, 34022, 33648, 33846, 33856, /* 656-663 */
-33582, 33330, 34014, 35298, 36492, 37266, 37760, 38308, /* 664-671 */
-39592, 41246, 41448, 40318, 38614, 37800, 38154, 38268, /* 672-679 */
-38126, 36944, 35720, 34616, 33026, 31554, 28998, 27086, /* 680-687 */
-25726, 24218, 22660, 20002, 19422, 20804, 23386, 26152, /* 688-695 */
-26838, 27606, 28702, 30720, 33386, 34768, 34764, 34034, /* 696-703 */
-34028, 34088, 34052, 33950, 33998, 35284, 36640, 37300, /* 704-711 */
-37780, 38384, 39552, 41640, 42938, 42370, 40942, 39440, /* 712-719 */
-39150, 39918, 39948, 38846, 37222, 35132, 33126, 31350, /* 720-727 */
-28932, 26666, 25002, 23308, 21522, 19272, 17842, 18734, /* 728-735 */
-21370, 24522, 26016, 26628, 27736, 29462, 32620, 34496, /* 736-743 */
-34998, 34712, 33728, 34230, 34246, 34124, 34412, 35208, /* 744-751 */
-37002, 37618, 38278, 38956, 39936, 41862, 43344, 43858, /* 752-759 */
-42176, 40074, 39362, 39886, 40554, 39808, 38182, 36058, /* 760-767 */
-33588, 31420, 29492, 27134, 25204, 23330, 21334, 19510, /* 768-775 */
-17182, 17252, 19546, 22614, 25266, 25806, 26590, 27968, /* 776-783 */
-30588, 33544, 35178, 35460, 34220, 34248, 34220, 34096, /* 784-791 */
-34682, 35120, 36998, 37860, 38370, 39260, 39800, 41570, /* 792-799 */
-43292, 44700, 43870, 41368, 40368, 40454, 41362, 41126, /* 800-807 */
-39290, 36992, 34016, 31488, 29538, 27116, 24582, 22334, /* 808-815 */
-20626, 19054, 16464, 15396, 17148, 20374, 24204, 25796, /* 816-823 */
-26294, 27442, 29036, 32384, 35172, 35820, 35186, 34190, /* 824-831 */
-34448, 34916, 34822, 35232, 36416, 38336, 39684, 39956, /* 832-839 */
-40680, 41652, 43134, 45128, 45170, 43634, 41794, 40978, /* 840-847 */
-42120, 42012, 40374, 38092, 35178, 32814, 29920, 27436, /* 848-855 */
-24796, 21956, 20442, 18472, 16606, 14296, 13840, 17146, /* 856-863 */
-20882, 24328, 25646, 26102, 27978, 30674, 34236, 36590, /* 864-871 */
-36496, 35304, 35066, 35514, 35788, 35812, 36258, 38038, /* 872-879 */
-39560, 40248, 40662, 41502, 42754, 44608, 46166, 45388, /* 880-887 */
-43580, 41914, 42470, 43766, 42830, 40798, 37332, 33966, /* 888-895 */
-30664, 27586, 25274, 22460, 20412, 17998, 16474, 14426, /* 896-903 */
-12290, 14584, 17484, 22068, 25180, 24816, 26498, 27550, /* 904-911 */
-31118, 35278, 36212, 35984, 34022, 34624, 35350, 35806, /* 912-919 */
-36782, 36744, 39508, 41076, 41632, 42826, 42806, 44656, /* 920-927 */
-46824, 46768, 45600, 43778, 42754, 43806, 43886, 42428, /* 928-935 */
-39588, 35324, 31788, 28242, 25978, 23586, 21076, 19472, /* 936-943 */
-16532, 15080, 13154, 12152, 15114, 18292, 22670, 24908, /* 944-951 */
-24612, 26336, 28896, 32948, 36052, 36780, 36108, 34718, /* 952-959 */
-35466, 35682, 36296, 37030, 37312, 40570, 41638, 41866, /* 960-967 */
-42918, 43430, 46024, 47390, 47168, 45918, 44224, 44326, /* 968-975 */
-45032, 44602, 41776, 37624, 33974, 30784, 27774, 25024, /* 976-983 */
-21880, 19556, 17292, 15374, 14038, 11306, 11970, 14624, /* 984-991 */
-18636, 23524, 23912, 25014, 26952, 29718, 34434, 36314, /* 992-999 */
-36212, 34730, 34194, 35286, 36196, 37314, 37214, 38990, /* 1000-1007 */
-42250, 43350, 44356, 44482, 45432, 47906, 48494, 47988, /* 1008-1015 */
-46490, 45644, 45556, 45542, 44422, 40080, 35662, 31596, /* 1016-1023 */
-28116, 25654, 22152, 18810, 16528, 14170, 12780, 11436, /* 1024-1031 */
-9676, 11146, 14558, 20186, 24232, 24580, 25964, 27344, /* 1032-1039 */
-31706, 35476, 36806, 37116, 34576, 35094, 35972, 37274, /* 1040-1047 */
-38958, 38780, 42030, 44108, 44844, 45846, 45820, 47494, /* 1048-1055 */
-48976, 49634, 49416, 47926, 46638, 46170, 45846, 43326, /* 1056-1063 */
-38306, 33176, 28622, 24840, 22048, 18850, 15796, 13272, /* 1064-1071 */
-11370, 10886, 9066, 9102, 11528, 16552, 22762, 23508, /* 1072-1079 */
-24724, 25952, 28788, 34954, 36922, 37672, 35324, 34030, /* 1080-1087 */
-36634, 37938, 39736, 39616, 41686, 44786, 45418, 46312, /* 1088-1095 */
-46646, 47878, 49984, 51230, 50626, 49220, 46880, 46720, /* 1096-1103 */
-46860, 44078, 40562, 34480, 30092, 25434, 21334, 19160, /* 1104-1111 */
-15548, 13578, 10928, 9954, 7708, 5992, 8822, 13112, /* 1112-1119 */
-20720, 22384, 22760, 24624, 26702, 32902, 36316, 38842, /* 1120-1127 */
-37502, 35744, 37646, 38354, 41084, 40978, 41576, 45508, /* 1128-1135 */
-46204, 46892, 47524, 48008, 50030, 51882, 52648, 51794, /* 1136-1143 */
-49736, 47586, 46944, 46172, 41984, 36346, 31398, 26126, /* 1144-1151 */
-21214, 18134, 15100, 12780, 10608, 8280, 6774, 4638, /* 1152-1159 */
-5308, 9586, 17730, 22946, 22392, 23866, 24328, 28934, /* 1160-1167 */
-34996, 38020, 39690, 36574, 36552, 38118, 40184, 41576, /* 1168-1175 */
-41408, 46248, 48718, 48550, 49130, 49156, 50218, 53642, /* 1176-1183 */
-55662, 56492, 55320, 49588, 46956, 45186, 41374, 36646, /* 1184-1191 */
-31102, 25152, 18594, 15058, 11748, 9638, 7674, 5576, /* 1192-1199 */
-4716, 4374, 5898, 9226, 17468, 20414, 22238, 24876, /* 1200-1207 */
-25168, 31040, 33156, 35650, 36744, 35864, 37906, 38536, /* 1208-1215 */
-41512, 41602, 44494, 49512, 50956, 52410, 51714, 52808, /* 1216-1223 */
-55174, 56888, 57190, 55950, 52356, 48158, 46474, 43730, /* 1224-1231 */
-39280, 32656, 27346, 21862, 18212, 14584, 11790, 10908, /* 1232-1239 */
-6894, 5824, 2980, 3088, 6012, 10148, 18100, 19140, /* 1240-1247 */
-21106, 21892, 24880, 31968, 34152, 38796, 38338, 37644, /* 1248-1255 */
-39274, 40172, 43752, 45064, 47726, 51034, 51928, 52268, /* 1256-1263 */
-52670, 53888, 56544, 57652, 58840, 58174, 52554, 48696, /* 1264-1271 */
-44702, 41994, 37740, 29830, 24734, 17766, 13392, 10076, /* 1272-1279 */
-7570, 6172, 3722, 2364, 1314, 3330, 6758, 13900, /* 1280-1287 */
-18958, 20412, 22260, 22888, 28288, 31844, 35076, 37252, /* 1288-1295 */
-36098, 38216, 38932, 41882, 44210, 46160, 51396, 54720, /* 1296-1303 */
-56406, 56232, 56012, 58732, 62060, 62790, 61730, 55828, /* 1304-1311 */
-49492, 45974, 42672, 39094, 30104, 22976, 16922, 13344, /* 1312-1319 */
-11428, 7010, 5640, 3164, 2844, 2196, 1970, 5396, /* 1320-1327 */
-9060, 15658, 17562, 18920, 20508, 22992, 29260, 32856, /* 1328-1335 */
-36758, 36784, 37554, 40704, 43146, 48004, 50322, 54376, /* 1336-1343 */
-58118, 59240, 59254, 58510, 59632, 61812, 63590, 61912, /* 1344-1351 */
-56402, 49462, 45438, 43252, 39956, 33248, 24836, 18588, /* 1352-1359 */
-13414, 10496, 7378, 4696, 2894, 482,   0,  38, /* 1360-1367 */
- 92, 4468, 12158, 16500, 17236, 18702, 21870, 28146, /* 1368-1375 */
-34418, 38654, 40480, 40446, 41990, 44012, 46940, 49152, /* 1376-1383 */
-53382, 58330, 60226, 58974, 57104, 58350, 63316, 65502, /* 1384-1391 */
-65424, 60702, 52990, 47804, 45450, 41988, 34724, 26048, /* 1392-1399 */
-18350, 13130, 8026, 3284, 642,   0,  42,   0, /* 1400-1407 */
-102,   0, 1942, 9424, 15004, 17804, 19024, 21030, /* 1408-1415 */
-26718, 32300, 37100, 39524, 40046, 43064, 45182, 48266, /* 1416-1423 */
-51570, 55022, 60156, 62032, 61664, 61180, 62290, 65226, /* 1424-1431 */
-65436, 65220, 60988, 53742, 48754, 45070, 40740, 33934, /* 1432-1439 */
-25718, 19192, 13732, 8210, 3886, 1468, 1020, 178, /* 1440-1447 */
- 14,   0,  76,   8, 5638, 13974, 16118, 16502, /* 1448-1455 */
-18432, 23786, 31906, 37984, 40752, 41698, 42978, 46496, /* 1456-1463 */
-48982, 52086, 54728, 58636, 63206, 63428, 64020, 64180, /* 1464-1471 */
-65096, 65386, 65422, 63752, 56788, 49666, 45038, 40098, /* 1472-1479 */
-33864, 26150, 17908, 12666, 7110, 3254, 1370,  48, /* 1480-1487 */
-  0,  56,   0, 154,   0, 3722, 11262, 13474, /* 1488-1495 */
-15790, 16742, 22884, 30388, 36998, 41910, 42754, 45122, /* 1496-1503 */
-47644, 50584, 55190, 57486, 61092, 64734, 65342, 65444, /* 1504-1511 */
-65430, 65370, 65034, 65064, 61688, 55156, 49110, 43626, /* 1512-1519 */
-38172, 33258, 25842, 19064, 13172, 8636, 5432, 2854, /* 1520-1527 */
-800,  14, 152,   0, 238,   0, 3812, 11062, /* 1528-1535 */
-12768, 15678, 18480, 23978, 31794, 37132, 41366, 42048, /* 1536-1543 */
-45364, 48654, 51850, 56320, 57484, 61184, 64498, 65508, /* 1544-1551 */
-65464,   0, 65400, 65250, 64900, 60706, 53992, 47440, /* 1552-1559 */
-41424, 37006, 31356, 23502, 15512, 10794, 6174, 4760, /* 1560-1567 */
-2168,   0, 232,  84,  62, 214,  52, 5096, /* 1568-1575 */
-10156, 12976, 16094, 18482, 25446, 31150, 37916, 42302, /* 1576-1583 */
-44130, 47412, 49534, 54104, 58330, 60852, 64480, 65206, /* 1584-1591 */
-65300, 65348, 65392, 65150, 65300, 63114, 58816, 52484, /* 1592-1599 */
-46220, 39712, 33598, 27562, 21138, 15510, 10350, 5500, /* 1600-1607 */
-2496, 342, 154, 102,   0,  24,   0, 1388, /* 1608-1615 */
-7486, 9014, 12466, 16018, 20504, 29896, 34412, 38824, /* 1616-1623 */
-41772, 44034, 49406, 52328, 56624, 58530, 61802,   0, /* 1624-1631 */
-65444,   0, 65334,   0, 65510, 65376, 62452, 56946, /* 1632-1639 */
-49172, 43066, 36342, 30282, 22478, 14294, 10064, 6208, /* 1640-1647 */
-3680, 980,   0,  62,   0,  72,  84, 496, /* 1648-1655 */
-4344, 8764, 10458, 14582, 18778, 24076, 31930, 35908, /* 1656-1663 */
-41368, 43214, 46200, 51256, 53788, 58910, 60626, 64272, /* 1664-1671 */
-  0, 65482, 65456, 65154, 65370, 65446, 63178, 58720, /* 1672-1679 */
-51160, 43948, 38070, 32434, 26728, 19490, 13336, 10226, /* 1680-1687 */
-5888, 2916, 826, 234, 404,   0, 174, 266, /* 1688-1695 */
-464, 5872, 9902, 13460, 17446, 20690, 27978, 33786, /* 1696-1703 */
-39706, 43718, 45826, 49734, 53090, 56708, 59722, 62818, /* 1704-1711 */
-  0, 65344,   0, 65434,   0, 65448, 65142, 61850, /* 1712-1719 */
-55384, 47920, 41288, 35424, 29232, 22634, 15582, 11146, /* 1720-1727 */
-6244, 3102, 944, 362, 556, 134,   0, 178, /* 1728-1735 */
-  0, 3756, 8446, 11352, 15084, 18724, 25788, 31530, /* 1736-1743 */
-37536, 42306, 45422, 49956, 52260, 55952, 58872, 62160, /* 1744-1751 */
-  0, 65440,   0, 65384, 65262, 65526, 65088, 61968, /* 1752-1759 */
-55974, 48328, 43162, 37592, 31660, 24576, 17500, 12606, /* 1760-1767 */
-8130, 4578, 2004, 180,   2, 134, 132,  20, /* 1768-1775 */
-  0, 2568, 8214, 11300, 16020, 19576, 24310, 31234, /* 1776-1783 */
-36172, 41960, 44796, 48402, 52022, 54020, 57624, 61776, /* 1784-1791 */
-65384, 65504,   0, 65472,   0, 65420,   0, 63048, /* 1792-1799 */
-57380, 50578, 43588, 38360, 31220, 24678, 18312, 12550, /* 1800-1807 */
-8260, 3994, 808,   0,   0,  12,   0,  22, /* 1808-1815 */
-  0, 420, 5398, 9840, 13390, 18748, 22098, 28490, /* 1816-1823 */
-34884, 40034, 45922, 48436, 52348, 55104, 58352, 63582, /* 1824-1831 */
-  0, 65520,   0, 65514,   0, 65486,   0, 62790, /* 1832-1839 */
-57654, 52018, 45502, 39434, 32728, 26172, 20746, 15586, /* 1840-1847 */
-10328, 5984, 1810,  98,   0,  10,   0,   0, /* 1848-1855 */
-  0, 210, 5138, 10626, 13208, 16722, 21448, 27768, /* 1856-1863 */
-34828, 40874, 45332, 48426, 50896, 53880, 56818, 60338, /* 1864-1871 */
-64368,   0, 65452,   0, 65494,   0, 65512, 64164, /* 1872-1879 */
-60268, 54732, 47860, 41002, 34378, 28466, 22254, 16178, /* 1880-1887 */
-9852, 4972, 896,   0,  28,   0,   0,  10, /* 1888-1895 */
-  0, 228, 3956, 8858, 12882, 18018, 23252, 28606, /* 1896-1903 */
-34388, 39714, 44624, 48266, 50488, 52616, 55966, 60824, /* 1904-1911 */
-65244,   0,   0, 65524,   0, 65510,   0, 64932, /* 1912-1919 */
-60086, 54304, 47346, 40292, 34106, 27160, 20140, 14334, /* 1920-1927 */
-9256, 4262, 448,   0,  34,   0,  32,   0, /* 1928-1935 */
- 50,  32, 3944, 9452, 13630, 17232, 21016, 26906, /* 1936-1943 */
-34156, 41324, 45876, 48034, 50108, 53548, 58388, 63470, /* 1944-1951 */
-  0, 65454,   0, 65480,   0, 65462,   0, 63484, /* 1952-1959 */
-58970, 53576, 45646, 38126, 31612, 26180, 21108, 15864, /* 1960-1967 */
-9642, 3762, 268,   0,   0,  12,   0,  36, /* 1968-1975 */
-  0, 900, 6358, 10688, 14276, 18290, 23788, 30542, /* 1976-1983 */
-36538, 41810, 45750, 48418, 51502, 53694, 57514, 60642, /* 1984-1991 */
-64602,   0, 65470,   0, 65520, 65534,   0, 64186, /* 1992-1999 */
-59638, 52718, 44620, 37166, 30988, 25082, 19046, 12618, /* 2000-2007 */
-6884, 3036, 166,   0, 308, 392,   0,  64, /* 2008-2015 */
-122, 2570, 7558, 11354, 14484, 19616, 23720, 29972, /* 2016-2023 */
-35766, 40164, 45410, 48000, 51484, 53980, 57064, 61794, /* 2024-2031 */
-65276, 65450,   0, 65466,   0, 65306, 65514, 63260, /* 2032-2039 */
-57300, 50460, 43584, 37560, 32396, 24914, 19094, 13314, /* 2040-2047 */
-7678, 4374, 270,   0,   0,   0, 138,   0, /* 2048-2055 */
-332, 958, 5720, 12168, 14348, 19342, 22892, 28700, /* 2056-2063 */
-35824, 40288, 46382, 49126, 51072, 54808, 56928, 61350, /* 2064-2071 */
-64774, 65396, 65532,   0, 65268, 64994, 65308, 63186, /* 2072-2079 */
-58716, 53372, 46252, 38666, 32428, 26078, 20886, 16178, /* 2080-2087 */
-9514, 5338, 1578,   0,  66,   0,   8,  16, /* 2088-2095 */
-  0, 814, 4996, 10604, 14388, 18400, 22868, 27352, /* 2096-2103 */
-35092, 40620, 45254, 48608, 50388, 53110, 56808, 60694, /* 2104-2111 */
-64348, 65438, 65248, 65514, 65384, 65364, 64848, 62668, /* 2112-2119 */
-59588, 54458, 48878, 41660, 34390, 28148, 22278, 17200, /* 2120-2127 */
-10830, 6980, 2080,   0, 112,   0,  56, 188, /* 2128-2135 */
-146,   0, 3186, 9472, 12768, 17124, 20922, 25396, /* 2136-2143 */
-32562, 38674, 44118, 47770, 50536, 52218, 55832, 59200, /* 2144-2151 */
-63456,   0, 65106, 65512, 65422,   0, 64834, 63522, /* 2152-2159 */
-61116, 56034, 50128, 43054, 36812, 31476, 26490, 19982, /* 2160-2167 */
-13642, 8350, 4626, 1268, 150, 120,   0,   0, /* 2168-2175 */
- 40,   0, 898, 5206, 11342, 14850, 18240, 23156, /* 2176-2183 */
-28014, 36182, 40856, 45954, 48144, 50172, 54450, 57048, /* 2184-2191 */
-61332, 64962,   0, 65526,   0, 65528, 65506, 64188, /* 2192-2199 */
-62858, 60098, 54180, 47442, 39296, 33804, 29088, 24052, /* 2200-2207 */
-18898, 11332, 6860, 3322, 408,  30,   0,  48, /* 2208-2215 */
-  0,  90,   0, 1742, 7508, 11338, 16420, 19798, /* 2216-2223 */
-24756, 31176, 37146, 43678, 47372, 50958, 52278, 54580, /* 2224-2231 */
-57822, 62076, 65464, 65512,   0, 65528,   0,   0, /* 2232-2239 */
-65116, 62750, 58130, 53218, 46916, 39560, 33420, 27378, /* 2240-2247 */
-21574, 16208, 10346, 4562, 1072,   0,  88,   0, /* 2248-2255 */
- 80,   0, 124,   0, 2926, 8762, 13588, 16708, /* 2256-2263 */
-19974, 24872, 30472, 37976, 42392, 46310, 49210, 51626, /* 2264-2271 */
-55108, 57866, 62062, 65162,   0, 65522,   0,   0, /* 2272-2279 */
-65498, 64674, 61916, 57048, 51976, 45092, 38588, 33640, /* 2280-2287 */
-27524, 22478, 17242, 11870, 7630, 4752, 1924,   0, /* 2288-2295 */
- 62,   0,  66,   0,  88,  20, 4886, 11154, /* 2296-2303 */
-14400, 19218, 23204, 29748, 37908, 43504, 48262, 50660, /* 2304-2311 */
-52882, 55460, 58260, 61926, 63702, 65346,   0, 65478, /* 2312-2319 */
-  0, 65022, 63658, 62630, 59372, 54614, 48612, 41148, /* 2320-2327 */
-35072, 30528, 26028, 18970, 11912, 6488, 2614, 692, /* 2328-2335 */
-  0,  24,   0,   0,  26,   0, 678, 5134, /* 2336-2343 */
-11028, 15506, 19852, 23648, 28498, 34012, 40206, 46772, /* 2344-2351 */
-49502, 52032, 53970, 55762, 60292, 62756, 64824,   0, /* 2352-2359 */
-65452,   0, 65498, 65092, 63116, 60560, 55932, 50236, /* 2360-2367 */
-44278, 37202, 31532, 26146, 20200, 14378, 9360, 5648, /* 2368-2375 */
-2806, 492,   0,  48,   0, 496, 456, 264, /* 2376-2383 */
-1056, 6556, 13904, 16176, 21488, 25160, 30944, 38858, /* 2384-2391 */
-43150, 49628, 51198, 53926, 58064, 60600, 63954, 65288, /* 2392-2399 */
-  0, 65370, 65296, 65256, 64440, 62754, 60250, 56596, /* 2400-2407 */
-51044, 46004, 39096, 33996, 30014, 24080, 18308, 11874, /* 2408-2415 */
-7450, 3458, 520,   0,  10, 244, 414,  60, /* 2416-2423 */
-392, 630, 3034, 9190, 15154, 19230, 23082, 27690, /* 2424-2431 */
-34310, 40884, 46350, 51006, 53808, 56034, 58568, 61734, /* 2432-2439 */
-63078, 64404, 65140, 64728, 65014, 64670, 63230, 60816, /* 2440-2447 */
-58630, 56070, 51798, 46494, 40000, 34200, 29262, 23934, /* 2448-2455 */
-18148, 12454, 8488, 4404, 1068, 198, 292, 322, /* 2456-2463 */
-492, 100, 324,   0, 1330, 7440, 14718, 19594, /* 2464-2471 */
-24054, 27632, 32996, 39748, 45720, 52124, 54018, 55504, /* 2472-2479 */
-56828, 58724, 61480, 62738, 64512, 65016, 64824, 64678, /* 2480-2487 */
-63092, 60798, 59116, 57156, 53562, 48342, 41048, 35516, /* 2488-2495 */
-30272, 25310, 20244, 12838, 8376, 3976, 816, 922, /* 2496-2503 */
-476,  96, 326, 170, 322, 756, 2384, 5912, /* 2504-2511 */
-11988, 17466, 22300, 26172, 30002, 35980, 40888, 46136, /* 2512-2519 */
-50478, 54074, 57680, 59836, 61772, 63058, 63090, 64266, /* 2520-2527 */
-65032, 65106, 63922, 60588, 57582, 55602, 53974, 51248, /* 2528-2535 */
-46474, 41078, 35200, 30246, 24948, 18438, 13188, 8666, /* 2536-2543 */
-5308, 2202, 748, 824, 514, 474, 328, 860, /* 2544-2551 */
-664, 644, 7552, 14888, 20872, 26638, 31268, 37908, /* 2552-2559 */
-43688, 48836, 53186, 55518, 56880, 59206, 59368, 59098, /* 2560-2567 */
-59312, 60848, 63910, 63546, 63530, 61758, 60002, 59492, /* 2568-2575 */
-56396, 53582, 47156, 42156, 36170, 29790, 24216, 14188, /* 2576-2583 */
-8142, 3354, 1178, 980, 398, 1008, 532, 3206, /* 2584-2591 */
-7050, 10676, 13468, 15526, 19848, 22894, 26088, 28004, /* 2592-2599 */
-28726, 29492, 32210, 36870, 39748, 42704, 44314, 47676, /* 2600-2607 */
-51652, 54816, 57196, 57434, 58042, 57454, 56814, 54920, /* 2608-2615 */
-50340, 47000, 44026, 41168, 36872, 31272, 26970, 24342, /* 2616-2623 */
-24108, 23880, 22044, 20156, 19000, 20682, 23286, 24376, /* 2624-2631 */
-25180, 23830, 24116, 25796, 26350, 26588, 25934, 25566, /* 2632-2639 */
-26448, 27550, 28402, 28116, 28326, 29798, 30978, 33506, /* 2640-2647 */
-33718, 32872, 33194, 32624, 33576, 33248, 32936, 33052, /* 2648-2655 */
-32840, 34656, 33964, 34108, 34694, 35928, 38950, 39602, /* 2656-2663 */
-39934, 38678, 39574, 42422, 43574, 45580, 45024, 44010, /* 2664-2671 */
-44706, 44492, 44156, 42394, 39752, 38526, 37578, 35962, /* 2672-2679 */
-34084, 30294, 28454, 26744, 24536, 24114, 20678, 18378, /* 2680-2687 */
-16484, 13922, 12960, 10978, 11004, 12092, 13558, 15388, /* 2688-2695 */
-16384, 19044, 21662, 25892, 29974, 32284, 36074, 39940, /* 2696-2703 */
-44834, 49148, 51536, 53392, 54772, 56702, 57184, 56212, /* 2704-2711 */
-54178, 51876, 51338, 51158, 50494, 49332, 47144, 45710, /* 2712-2719 */
-44964, 42476, 39396, 34222, 30136, 27692, 23274, 19676, /* 2720-2727 */
-15088, 12112, 11222, 10428, 10554, 10188, 10630, 10868, /* 2728-2735 */
-13528, 15668, 15180, 15504, 14822, 15874, 16840, 16044, /* 2736-2743 */
-15980, 16696, 19054, 24892, 31256, 35906, 42136, 48324, /* 2744-2751 */
-55678, 61946, 64388, 65152, 64362, 64686, 62132, 57636, /* 2752-2759 */
-53006, 48342, 47736, 47588, 47324, 46550, 45322, 45758, /* 2760-2767 */
-46594, 46728, 44028, 38232, 31960, 26698, 20924, 14648, /* 2768-2775 */
-7382, 1618, 242, 402, 1010, 1142, 856, 508, /* 2776-2783 */
-3772, 11102, 15786, 19560, 23412, 27560, 33922, 37436, /* 2784-2791 */
-39128, 40922, 42180, 46364, 49828, 51616, 53126, 53942, /* 2792-2799 */
-56906, 59330, 60294, 59552, 58760, 59236, 58946, 57824, /* 2800-2807 */
-53940, 50316, 46560, 43170, 40050, 33874, 26976, 19814, /* 2808-2815 */
-16124, 13986, 11208, 9346, 8432, 9206, 11568, 15924, /* 2816-2823 */
-17516, 18420, 19216, 20586, 23046, 22552, 22894, 22072, /* 2824-2831 */
-22306, 23320, 24930, 27006, 25868, 28672, 31188, 34292, /* 2832-2839 */
-37812, 37546, 39756, 40248, 40006, 41604, 41178, 38628, /* 2840-2847 */
-37510, 38620, 39714, 41000, 40540, 40626, 42360, 43718, /* 2848-2855 */
-45160, 45826, 45074, 43902, 44358, 44924, 44252, 42694, /* 2856-2863 */
-40754, 39672, 38440, 36414, 34020, 31222, 29278, 28206, /* 2864-2871 */
-27306, 25694, 20932, 17824, 17126, 16080, 16704, 13766, /* 2872-2879 */
-9790, 8178, 6440, 6950, 7898, 8794, 10384, 14366, /* 2880-2887 */
-20948, 26740, 32988, 39150, 44760, 50024, 52672, 54302, /* 2888-2895 */
-55950, 56202, 56314, 56560, 55560, 53890, 53108, 54590, /* 2896-2903 */
-56830, 57688, 58476, 58572, 57606, 56796, 54760, 51572, /* 2904-2911 */
-46206, 38928, 31618, 24110, 17132, 9914, 4414, 1038, /* 2912-2919 */
-  0, 138, 116, 614, 122, 1826, 5148, 6416, /* 2920-2927 */
-8270, 9784, 11142, 12816, 15344, 18964, 23200, 28912, /* 2928-2935 */
-34878, 42038, 48404, 52872, 57120, 60550, 63612, 65008, /* 2936-2943 */
-64794, 65178, 65406, 64566, 62440, 59880, 57418, 55508, /* 2944-2951 */
-54624, 52826, 49774, 45114, 40130, 35330, 30270, 25566, /* 2952-2959 */
-20016, 16500, 11222, 7216, 6522, 2314, 1792, 1456, /* 2960-2967 */
-506, 2498, 3990, 6576, 9154, 12628, 14158, 16148, /* 2968-2975 */
-17330, 17432, 20274, 21304, 24174, 26350, 29744, 34814, /* 2976-2983 */
-38998, 44612, 47150, 50916, 54312, 58196, 63038, 64634, /* 2984-2991 */
-  0, 63124, 60138, 58658, 58306, 57232, 54578, 52846, /* 2992-2999 */
-50926, 48438, 45000, 42628, 41450, 41310, 40352, 37010, /* 3000-3007 */
-33112, 28354, 24294, 20550, 15410, 9826, 5636, 2648, /* 3008-3015 */
-1488, 884,   2,  50,   0, 688, 852, 3372, /* 3016-3023 */
-6682, 10936, 17286, 23858, 32570, 37586, 44676, 50678, /* 3024-3031 */
-53664, 57728, 56176, 57728, 58048, 57316, 58848, 57900, /* 3032-3039 */
-58592, 58366, 61396, 63862, 64142, 64870, 63116, 61590, /* 3040-3047 */
-57402, 52248, 46902, 39176, 29882, 21746, 14670, 7628, /* 3048-3055 */
-2998,  66, 130, 130, 782, 2976, 4354, 7700, /* 3056-3063 */
-11504, 15838, 19058, 20432, 22356, 23796, 24724, 26092, /* 3064-3071 */
-27246, 28810, 32586, 35830, 40228, 44078, 45062, 47204, /* 3072-3079 */
-49448, 51816, 52672, 52434, 50882, 48134, 46762, 42278, /* 3080-3087 */
-38176, 33980, 29258, 28790, 25270, 21224, 18668, 15546, /* 3088-3095 */
-15858, 14960, 15508, 18192, 19162, 23018, 27826, 32040, /* 3096-3103 */
-34648, 36090, 39684, 42280, 43738, 43428, 42430, 43526, /* 3104-3111 */
-43636, 45058, 47122, 46622, 47732, 50528, 54102, 55510, /* 3112-3119 */
-53722, 53084, 50768, 46768, 42798, 36410, 29150, 22946, /* 3120-3127 */
-17998, 13148, 7786, 2750, 598, 290,   0,  50, /* 3128-3135 */
- 12, 1092, 3556, 7216, 11788, 16576, 20550, 25460, /* 3136-3143 */
-32354, 38258, 43194, 46766, 49748, 53230, 56368, 59800, /* 3144-3151 */
-62596, 64792, 65272, 65176,   0, 65478,   0, 65356, /* 3152-3159 */
-64966, 64018, 60774, 55730, 50970, 46034, 39808, 33454, /* 3160-3167 */
-26318, 17932, 9930, 4400, 874,   0, 106,   0, /* 3168-3175 */
-212,   0, 1356, 4802, 7226, 9438, 12256, 15494, /* 3176-3183 */
-17924, 19974, 22816, 24878, 28394, 33850, 37320, 40246, /* 3184-3191 */
-42238, 44280, 49438, 52180, 52976, 53546, 53396, 54588, /* 3192-3199 */
-54250, 52334, 48684, 44018, 41402, 39326, 36182, 31410, /* 3200-3207 */
-27486, 26304, 25604, 24632, 23394, 21344, 21956, 24864, /* 3208-3215 */
-26916, 28516, 26812, 26100, 29022, 30468, 31792, 32232, /* 3216-3223 */
-32310, 34038, 37256, 40352, 40618, 40832, 41882, 44508, /* 3224-3231 */
-47872, 48444, 46898, 45410, 44996, 43710, 42560, 38782, /* 3232-3239 */
-32402, 29110, 26690, 25842, 22994, 16806, 14002, 11252, /* 3240-3247 */
-9186, 9046, 5076, 1682, 2562, 3928, 7390, 11288, /* 3248-3255 */
-13978, 18648, 25948, 34656, 40782, 45920, 49450, 50706, /* 3256-3263 */
-54686, 56758, 56178, 55400, 54670, 56172, 57604, 57246, /* 3264-3271 */
-56380, 57310, 59826, 62222, 63542, 61392, 57796, 54892, /* 3272-3279 */
-51346, 46150, 37848, 27532, 18566, 10844, 5854, 2346, /* 3280-3287 */
-  2,  22,   0,  80, 2938, 6668, 11358, 17120, /* 3288-3295 */
-20548, 22808, 23374, 23184, 23994, 26874, 28956, 28320, /* 3296-3303 */
-27382, 26060, 29192, 34778, 37382, 40332, 41568, 43434, /* 3304-3311 */
-47226, 51396, 53846, 51772, 50176, 47878, 44256, 41874, /* 3312-3319 */
-38466, 36688, 35290, 31886, 30190, 27554, 26274, 29060, /* 3320-3327 */
-30408, 33674, 34090, 32476, 35556, 36560, 38242, 39026, /* 3328-3335 */
-37728, 37172, 36334, 36432, 34906, 34616, 33354, 32806, /* 3336-3343 */
-35832, 35928, 35402, 35630, 35556, 35222, 34942, 34150, /* 3344-3351 */
-32572, 31040, 30478, 28564, 24310, 21702, 17572, 16574, /* 3352-3359 */
-15676, 11958, 11122, 7764, 9258, 10544, 10910, 15452, /* 3360-3367 */
-15574, 20826, 27246, 31788, 38426, 41704, 46302, 51346, /* 3368-3375 */
-53374, 53584, 53722, 53082, 51508, 51556, 51782, 50028, /* 3376-3383 */
-49496, 50792, 51314, 54102, 55088, 54878, 56010, 54142, /* 3384-3391 */
-52052, 47580, 41952, 36498, 29850, 24502, 17614, 10404, /* 3392-3399 */
-4842, 1164, 496, 888, 2326, 5694, 8970, 13414, /* 3400-3407 */
-18748, 22810, 26850, 28764, 30418, 31462, 31184, 31254, /* 3408-3415 */
-29824, 29596, 29212, 30200, 32832, 34500, 38374, 41922, /* 3416-3423 */
-44946, 48754, 50950, 52808, 55676, 55656, 53760, 51446, /* 3424-3431 */
-47762, 43926, 39154, 36686, 33164, 29618, 28066, 25260, /* 3432-3439 */
-25956, 26278, 26614, 28120, 29158, 29842, 29032, 30338, /* 3440-3447 */
-29618, 27768, 26048, 23032, 21298, 18706, 16222, 16044, /* 3448-3455 */
-16024, 15504, 18070, 20532, 24514, 28366, 29126, 34138, /* 3456-3463 */
-36540, 37804, 39310, 38314, 39104, 37288, 36250, 36276, /* 3464-3471 */
-36128, 35698, 34962, 37062, 37804, 39992, 43676, 45560, /* 3472-3479 */
-47530, 48394, 48042, 48200, 47464, 44994, 42920, 39362, /* 3480-3487 */
-35556, 31858, 29402, 29176, 27116, 27372, 27284, 25474, /* 3488-3495 */
-25532, 24688, 24954, 24940, 24180, 23554, 22254, 20516, /* 3496-3503 */
-17608, 16810, 16460, 16060, 17374, 17688, 19894, 22566, /* 3504-3511 */
-24184, 28634, 32762, 36294, 40052, 42450, 44542, 45502, /* 3512-3519 */
-46732, 47936, 47826, 48340, 48826, 49236, 50058, 50494, /* 3520-3527 */
-50176, 50498, 52150, 52578, 52202, 52000, 49670, 47046, /* 3528-3535 */
-44812, 40690, 36482, 31602, 26514, 23206, 19698, 15858, /* 3536-3543 */
-12646, 10358, 9264, 9500, 9316, 8976, 9292, 9384, /* 3544-3551 */
-11316, 13438, 14810, 16668, 17406, 17306, 18624, 21780, /* 3552-3559 */
-24950, 28924, 33150, 36662, 39824, 42998, 46662, 50986, /* 3560-3567 */
-55622, 57774, 60086, 61246, 60094, 60556, 60340, 60458, /* 3568-3575 */
-59730, 58184, 55948, 52488, 49824, 46374, 44930, 42284, /* 3576-3583 */
-38804, 37748, 34704, 31966, 29406, 25018, 21420, 18958, /* 3584-3591 */
-15344, 12050, 7892, 4124, 2344, 176, 1250, 534, /* 3592-3599 */
-736, 3930, 5294, 10904, 13868, 15070, 18312, 20820, /* 3600-3607 */
-25740, 30856, 37118, 41650, 45614, 49058, 50164, 53662, /* 3608-3615 */
-55650, 57866, 60798, 60704, 60606, 59892, 58322, 58384, /* 3616-3623 */
-59062, 58894, 59362, 57596, 54492, 52672, 49534, 46364, /* 3624-3631 */
-41416, 35520, 30662, 25798, 21674, 16450, 12536, 8518, /* 3632-3639 */
-5742, 7382, 7034, 7284, 8092, 8314, 11380, 13612, /* 3640-3647 */
-15380, 16626, 18038, 19754, 20630, 22722, 22254, 22684, /* 3648-3655 */
-25514, 26316, 29646, 32534, 34354, 38542, 40988, 43688, /* 3656-3663 */
-46122, 46766, 48582, 49922, 50270, 49916, 49860, 49570, /* 3664-3671 */
-48252, 49108, 48322, 45658, 45792, 44600, 43610, 43646, /* 3672-3679 */
-41630, 41122, 40576, 40052, 39698, 38824, 38802, 36354, /* 3680-3687 */
-35894, 34402, 29156, 27306, 24710, 22450, 21840, 20580, /* 3688-3695 */
-20060, 18432, 16888, 16384, 15888, 15626, 16398, 15870, /* 3696-3703 */
-15272, 15674, 14326, 15676, 18276, 19010, 19970, 21962, /* 3704-3711 */
-24064, 27400, 33000, 35510, 40342, 45400, 45580, 50144, /* 3712-3719 */
-53620, 54414, 56084, 55796, 55664, 54810, 53126, 52602, /* 3720-3727 */
-52626, 50542, 48762, 49106, 48304, 46786, 44480, 42502, /* 3728-3735 */
-40310, 36030, 32820, 30982, 26942, 21630, 17782, 14004, /* 3736-3743 */
-11028, 9206, 8134, 8198, 7812, 7894, 9046, 12308, /* 3744-3751 */
-15034, 16240, 19998, 21996, 22966, 25770, 27978, 30246, /* 3752-3759 */
-31860, 33748, 34744, 35538, 38086, 39982, 42990, 45116, /* 3760-3767 */
-45348, 47420, 49546, 49778, 50204, 50782, 49496, 48344, /* 3768-3775 */
-47804, 46374, 43624, 40522, 37812, 35710, 34004, 31390, /* 3776-3783 */
-30884, 29042, 26404, 26414, 24486, 25010, 24970, 22972, /* 3784-3791 */
-23202, 21454, 19504, 18656, 18060, 16202, 14902, 14154, /* 3792-3799 */
-13432, 15678, 16204, 17452, 19888, 21036, 24142, 27228, /* 3800-3807 */
-30524, 34226, 36108, 36918, 39220, 40760, 41750, 43860, /* 3808-3815 */
-43884, 43372, 43276, 44292, 45010, 46046, 47830, 47336, /* 3816-3823 */
-48522, 49020, 48876, 49946, 48470, 45808, 43906, 42036, /* 3824-3831 */
-37646, 34834, 32300, 27826, 25226, 21358, 19008, 18150, /* 3832-3839 */
-16188, 15786, 15690, 14886, 14094, 14712, 15294, 15632, /* 3840-3847 */
-16350, 16680, 18040, 19424, 19662, 21136, 22612, 22472, /* 3848-3855 */
-25080, 27674, 29186, 32170, 34474, 38016, 40694, 42988, /* 3856-3863 */
-44750, 45738, 48476, 48066, 49260, 50376, 47678, 48758, /* 3864-3871 */
-48430, 46142, 46194, 44826, 43738, 43266, 40984, 38794, /* 3872-3879 */
-37028, 35524, 34446, 33892, 32490, 29580, 28802, 27208, /* 3880-3887 */
-25506, 24860, 21316, 19724, 18528, 16616, 15000, 11868, /* 3888-3895 */
-10904, 10832, 11576, 12586, 13294, 14514, 14222, 15974, /* 3896-3903 */
-19430, 22068, 24320, 26586, 30304, 33864, 36928, 40056, /* 3904-3911 */
-42332, 44206, 45368, 46706, 48304, 48422, 49380, 50584, /* 3912-3919 */
-50908, 51660, 51496, 52542, 53532, 53488, 53804, 52236, /* 3920-3927 */
-50528, 48378, 45760, 43048, 38906, 34712, 30492, 27162, /* 3928-3935 */
-23818, 19822, 16644, 15034, 14256, 13406, 14056, 14806, /* 3936-3943 */
-15632, 17380, 18872, 19628, 19964, 20332, 20246, 21758, /* 3944-3951 */
-22864, 23010, 24088, 24966, 26468, 27538, 30064, 32236, /* 3952-3959 */
-33280, 36406, 38124, 39788, 40540, 39640, 40036, 41124, /* 3960-3967 */
-42326, 41212, 40904, 41154, 39380, 40262, 41624, 42212, /* 3968-3975 */
-42914, 42440, 44014, 45090, 43582, 42952, 42662, 42540, /* 3976-3983 */
-41834, 40336, 39284, 38236, 37690, 37618, 37714, 37604, /* 3984-3991 */
-36714, 36200, 36956, 35554, 33492, 33428, 31316, 29516, /* 3992-3999 */
-27348, 24278, 22708, 20466, 19286, 17312, 15786, 14080, /* 4000-4007 */
-11520, 13200, 14692, 16100, 16638, 16410, 18872, 19516, /* 4008-4015 */
-21484, 25556, 29452, 33472, 35396, 38454, 40962, 41290, /* 4016-4023 */
-43944, 46484, 47902, 49640, 50290, 50922, 51634, 51796, /* 4024-4031 */
-52498, 53732, 53946, 53906, 54438, 53324, 51608, 49806, /* 4032-4039 */
-47410, 45188, 41048, 36136, 32648, 28194, 23424, 20564, /* 4040-4047 */
-17308, 14498, 13250, 12224, 12732, 12998, 13002, 15166, /* 4048-4055 */
-17400, 17644, 18142, 19786, 19756, 20844, 23294, 23688, /* 4056-4063 */
-25910, 28628, 29414, 33052, 36524, 37530, 40556, 44244, /* 4064-4071 */
-47520, 50006, 50792, 51292, 50902, 50920, 51416, 50278, /* 4072-4079 */
-49110, 47916, 45344, 43396, 41736, 39174, 37176, 35726, /* 4080-4087 */
-34698, 32638, 30110, 28618, 27456, 26690, 24546, 22800, /* 4088-4095 */
-21860, 20616, 20612, 19344, 17684, 16506, 16294, 18216, /* 4096-4103 */
-19756, 21528, 20878, 20098, 23246, 24228, 27026, 31758, /* 4104-4111 */
-32334, 35412, 39606, 40232, 42410, 45822, 46644, 48968, /* 4112-4119 */
-51352, 49560, 50204, 50990, 50288, 52054, 51652, 50784, /* 4120-4127 */
-50998, 50792, 51400, 50794, 48394, 47024, 46452, 43646, /* 4128-4135 */
-41190, 39150, 34200, 30006, 27618, 24452, 21190, 18092, /* 4136-4143 */
-16426, 16088, 15128, 15158, 15004, 14608, 15048, 14338, /* 4144-4151 */
-13816, 14484, 14808, 13608, 15134, 16744, 14348, 15520, /* 4152-4159 */
-17830, 20076, 24396, 27252, 30494, 33644, 37030, 40532, /* 4160-4167 */
-43892, 47472, 48584, 49988, 51246, 51916, 52592, 50196, /* 4168-4175 */
-49420, 49900, 47716, 47088, 47160, 45826, 45238, 45216, /* 4176-4183 */
-44156, 42524, 40520, 37866, 35934, 32906, 28944, 25884, /* 4184-4191 */
-22892, 19938, 17066, 14782, 12112, 11042, 11290, 11350, /* 4192-4199 */
-12784, 12596, 13282, 14916, 15150, 16812, 18168, 18394, /* 4200-4207 */
-18572, 19722, 20564, 21298, 21586, 20082, 21288, 22680, /* 4208-4215 */
-23296, 26358, 28690, 31158, 34598, 36846, 39192, 42004, /* 4216-4223 */
-44478, 47716, 49890, 49952, 50532, 50014, 48702, 49168, /* 4224-4231 */
-48104, 46120, 45932, 45152, 44826, 45190, 43746, 42878, /* 4232-4239 */
-43534, 43364, 43600, 43380, 40588, 38630, 36458, 33354, /* 4240-4247 */
-31262, 28040, 24738, 21480, 18452, 16334, 14170, 13050, /* 4248-4255 */
-11870, 11522, 12232, 12090, 13260, 14866, 15826, 17832, /* 4256-4263 */
-18402, 17856, 17754, 16906, 17476, 19542, 21054, 22230, /* 4264-4271 */
-25054, 28670, 32048, 35454, 37606, 42316, 47146, 50410, /* 4272-4279 */
-54486, 55350, 55998, 56460, 56228, 56980, 55912, 54470, /* 4280-4287 */
-52964, 52490, 51032, 48064, 47140, 45562, 44552, 44086, /* 4288-4295 */
-42296, 40618, 37474, 34832, 33038, 29134, 25262, 22104, /* 4296-4303 */
-18712, 16322, 15138, 13608, 12500, 12350, 12252, 13836, /* 4304-4311 */
-14730, 14912, 17016, 18788, 20858, 22978, 23910, 24984, /* 4312-4319 */
-26524, 27518, 28760, 29672, 28984, 30190, 32126, 33508, /* 4320-4327 */
-34932, 36364, 38708, 40412, 42824, 44636, 45720, 47092, /* 4328-4335 */
-47464, 48394, 48014, 46376, 45478, 45122, 44174, 42918, /* 4336-4343 */
-41370, 39312, 39224, 38932, 38596, 38472, 37178, 37236, /* 4344-4351 */
-37282, 37188, 37098, 35868, 34704, 34136, 33088, 30750, /* 4352-4359 */
-29396, 28206, 26152, 25592, 24604, 24026, 25146, 25252, /* 4360-4367 */
-26302, 27320, 27542, 28692, 28752, 28720, 28236, 26876, /* 4368-4375 */
-25854, 25346, 25668, 24924, 23424, 22818, 22398, 22632, /* 4376-4383 */
-24738, 25702, 26824, 29824, 31920, 35340, 38300, 40398, /* 4384-4391 */
-42686, 43962, 45432, 46090, 46668, 45842, 45348, 45038, /* 4392-4399 */
-43262, 44326, 44664, 44586, 45902, 46208, 47322, 48040, /* 4400-4407 */
-48102, 48318, 47762, 46604, 44556, 42058, 39914, 37282, /* 4408-4415 */
-34030, 30330, 26646, 23376, 20466, 19296, 18178, 17290, /* 4416-4423 */
-18058, 18462, 19986, 22290, 22750, 23424, 25114, 25268, /* 4424-4431 */
-25240, 25926, 25038, 23974, 24376, 24320, 24068, 25442, /* 4432-4439 */
-25818, 26972, 30084, 31640, 33832, 36316, 38990, 41738, /* 4440-4447 */
-42948, 44806, 46066, 46456, 46530, 45274, 44364, 43394, /* 4448-4455 */
-41154, 40284, 39616, 37864, 37446, 37154, 37658, 37858, /* 4456-4463 */
-37998, 39666, 39112, 38856, 39414, 38832, 38080, 36070, /* 4464-4471 */
-34018, 31726, 29030, 27392, 25972, 24170, 22512, 21392, /* 4472-4479 */
-21486, 22548, 23380, 24666, 26354, 27522, 28900, 30712, /* 4480-4487 */
-31602, 31502, 31252, 30970, 30468, 29548, 29106, 28424, /* 4488-4495 */
-27510, 26786, 26348, 27278, 27924, 28976, 30050, 30344, /* 4496-4503 */
-32074, 33570, 34460, 35580, 35556, 35582, 36800, 36864, /* 4504-4511 */
-37454, 38372, 36512, 36320, 36646, 36220, 38224, 38934, /* 4512-4519 */
-38696, 39560, 40106, 40946, 42004, 42902, 43762, 43650, /* 4520-4527 */
-43158, 43504, 43102, 41494, 39924, 38004, 35936, 34594, /* 4528-4535 */
-33544, 32516, 31070, 28660, 27344, 27430, 26356, 25844, /* 4536-4543 */
-26360, 25858, 26068, 25750, 25300, 25188, 22972, 21820, /* 4544-4551 */
-21056, 20272, 20212, 19462, 19220, 18424, 18446, 18912, /* 4552-4559 */
-20166, 22868, 25296, 28062, 29826, 33158, 35416, 36592, /* 4560-4567 */
-39700, 40206, 41396, 42836, 43996, 45024, 43954, 44368, /* 4568-4575 */
-43810, 43098, 43614, 43864, 44660, 45188, 45238, 44614, /* 4576-4583 */
-44804, 44596, 43594, 42646, 41262, 39382, 36222, 34542, /* 4584-4591 */
-31980, 28134, 26356, 24232, 22812, 22082, 21176, 20404, /* 4592-4599 */
-19698, 19448, 19300, 20282, 20328, 20636, 21824, 21920, /* 4600-4607 */
-22904, 22472, 23048, 24610, 23460, 23636, 23610, 23528, /* 4608-4615 */
-24442, 24866, 26088, 27246, 28552, 30406, 34010, 35892, /* 4616-4623 */
-36770, 40604, 41400, 42716, 45354, 45078, 46600, 47440, /* 4624-4631 */
-46474, 47406, 47882, 45838, 45268, 45576, 44004, 44128, /* 4632-4639 */
-44106, 43904, 44874, 43928, 43430, 43766, 42730, 41166, /* 4640-4647 */
-40368, 38224, 34824, 33072, 29854, 27018, 25742, 22616, /* 4648-4655 */
-20902, 19646, 17562, 17180, 17358, 17130, 17080, 17230, /* 4656-4663 */
-17264, 17754, 17822, 18168, 18886, 19150, 19890, 20078, /* 4664-4671 */
-20872, 21226, 23070, 26552, 27542, 30480, 33000, 35166, /* 4672-4679 */
-38568, 40890, 44802, 46304, 47624, 49260, 49318, 50606, /* 4680-4687 */
-49962, 50552, 51876, 51428, 50912, 50340, 50122, 48796, /* 4688-4695 */
-47914, 46880, 45662, 44640, 42922, 41404, 39040, 36904, /* 4696-4703 */
-34144, 32018, 30098, 26878, 25130, 22664, 20750, 19260, /* 4704-4711 */
-17596, 17322, 16570, 16444, 15842, 16146, 17050, 16566, /* 4712-4719 */
-17216, 17320, 18116, 18766, 18456, 19928, 20504, 21346, /* 4720-4727 */
-22566, 22828, 24140, 25718, 26882, 28852, 32540, 34978, /* 4728-4735 */
-37062, 40068, 41218, 43454, 46008, 47968, 50044, 49800, /* 4736-4743 */
-49530, 49834, 49896, 49490, 48956, 48618, 48308, 48406, /* 4744-4751 */
-47034, 47098, 46828, 44270, 44030, 42914, 40982, 39620, /* 4752-4759 */
-37574, 35564, 32956, 30320, 27526, 25482, 23336, 20626, /* 4760-4767 */
-18792, 17214, 16238, 15750, 15778, 15354, 14548, 14722, /* 4768-4775 */
-15892, 16800, 16732, 16870, 16256, 16520, 17482, 18058, /* 4776-4783 */
-19302, 19400, 20364, 22140, 24294, 27126, 29482, 32858, /* 4784-4791 */
-35050, 37070, 40176, 42470, 45146, 47122, 48106, 49560, /* 4792-4799 */
-50518, 50432, 50824, 50852, 49788, 49464, 49122, 48410, /* 4800-4807 */
-47690, 46646, 45764, 45124, 44366, 43534, 42656, 40492, /* 4808-4815 */
-38144, 36232, 33590, 31868, 29674, 26328, 24266, 21696, /* 4816-4823 */
-19262, 18572, 17394, 16230, 15552, 14930, 14654, 14670, /* 4824-4831 */
-15298, 15360, 15456, 16626, 17900, 18772, 19262, 19724, /* 4832-4839 */
-19606, 20420, 21744, 22292, 24168, 26016, 27400, 29706, /* 4840-4847 */
-32696, 35062, 37502, 40912, 42790, 45250, 47278, 47982, /* 4848-4855 */
-50120, 50154, 49870, 50588, 50032, 49892, 49656, 48940, /* 4856-4863 */
-48334, 47788, 46448, 45366, 45168, 43676, 42090, 41378, /* 4864-4871 */
-40290, 38664, 36778, 34386, 31900, 29442, 26784, 25026, /* 4872-4879 */
-22870, 20140, 18332, 17058, 16450, 15600, 14896, 15338, /* 4880-4887 */
-15600, 15882, 16828, 17994, 19144, 20112, 20814, 21202, /* 4888-4895 */
-21872, 22530, 22992, 24254, 24828, 25276, 26648, 27892, /* 4896-4903 */
-30716, 33420, 34956, 37558, 39398, 40974, 44578, 47450, /* 4904-4911 */
-48420, 50108, 50942, 50866, 51738, 51192, 50302, 49784, /* 4912-4919 */
-48592, 47938, 46846, 45236, 44442, 43980, 42930, 42204, /* 4920-4927 */
-42016, 40826, 39506, 38274, 36218, 34360, 32450, 30174, /* 4928-4935 */
-28198, 25874, 23244, 21114, 19992, 18742, 16942, 16370, /* 4936-4943 */
-15966, 15796, 16742, 17420, 18142, 18954, 19720, 20462, /* 4944-4951 */
-21064, 21488, 21734, 22750, 23968, 24680, 25778, 27238, /* 4952-4959 */
-28210, 29312, 31078, 33270, 35564, 38156, 41016, 42776, /* 4960-4967 */
-44722, 46668, 47790, 49154, 49516, 49894, 50476, 50276, /* 4968-4975 */
-49840, 48978, 47720, 46412, 45624, 44662, 44148, 43374, /* 4976-4983 */
-41692, 41028, 39938, 38314, 37140, 35876, 34356, 32420, /* 4984-4991 */
-30738, 29194, 27154, 25124, 23348, 21672, 20614, 19392, /* 4992-4999 */
-18196, 17856, 17708, 17822, 18340, 19406, 19868, 20328, /* 5000-5007 */
-21460, 21882, 22334, 23050, 24110, 24684, 24986, 25810, /* 5008-5015 */
-26428, 27562, 28904, 30364, 31392, 32948, 35420, 36946, /* 5016-5023 */
-39562, 42096, 43212, 44980, 46288, 46906, 47832, 48054, /* 5024-5031 */
-47414, 47494, 47552, 47114, 46756, 45720, 44666, 43840, /* 5032-5039 */
-43270, 43010, 42358, 41340, 40310, 39420, 37710, 36272, /* 5040-5047 */
-35300, 33192, 31756, 30630, 28448, 26498, 24668, 22566, /* 5048-5055 */
-20880, 19892, 18930, 18106, 18012, 18196, 18156, 18266, /* 5056-5063 */
-18922, 19390, 20118, 21176, 21488, 22010, 22726, 23150, /* 5064-5071 */
-23632, 24082, 24704, 25588, 27534, 29358, 30352, 32366, /* 5072-5079 */
-33652, 34776, 37816, 40302, 42480, 44910, 46070, 46876, /* 5080-5087 */
-47942, 48286, 48476, 49006, 48502, 48160, 47976, 46556, /* 5088-5095 */
-45652, 44542, 43320, 42926, 41962, 41108, 40400, 39018, /* 5096-5103 */
-37642, 36724, 35162, 33166, 31934, 30308, 28294, 26846, /* 5104-5111 */
-25464, 23716, 22250, 20968, 19624, 18832, 18064, 17944, /* 5112-5119 */
-18182, 18258, 18968, 19380, 19816, 20404, 20692, 21500, /* 5120-5127 */
-22726, 23442, 23772, 24182, 24846, 25886, 26420, 27878, /* 5128-5135 */
-29924, 31040, 32902, 34888, 36752, 38376, 40264, 42814, /* 5136-5143 */
-43964, 45150, 46562, 47112, 47916, 48266, 47676, 47252, /* 5144-5151 */
-47000, 46208, 45700, 45686, 45088, 43894, 43084, 42772, /* 5152-5159 */
-41758, 40510, 39854, 38796, 37152, 35646, 34186, 32254, /* 5160-5167 */
-30384, 28838, 26938, 25398, 24114, 22744, 21544, 20090, /* 5168-5175 */
-19220, 18734, 18612, 18874, 19160, 19682, 19742, 20354, /* 5176-5183 */
-20748, 21060, 22026, 22484, 23582, 24004, 24166, 25420, /* 5184-5191 */
-26376, 27112, 28584, 30548, 31538, 33386, 34990, 36260, /* 5192-5199 */
-39064, 40464, 42240, 44280, 45114, 46110, 46512, 46872, /* 5200-5207 */
-47170, 46998, 46548, 46878, 46476, 45086, 45012, 44166, /* 5208-5215 */
-43398, 43470, 42980, 42402, 41458, 40320, 39154, 38178, /* 5216-5223 */
-36474, 34584, 33530, 31972, 30130, 28530, 27178, 25660, /* 5224-5231 */
-24072, 23072, 22014, 20842, 20576, 20634, 20310, 20664, /* 5232-5239 */
-21090, 21404, 21962, 22302, 23028, 23476, 23612, 24010, /* 5240-5247 */
-23982, 23804, 24112, 24346, 25124, 26916, 27826, 29178, /* 5248-5255 */
-31310, 32294, 33714, 35738, 37490, 39508, 41430, 42740, /* 5256-5263 */
-43980, 44576, 44730, 45432, 45160, 44786, 44580, 43948, /* 5264-5271 */
-44020, 43326, 42602, 42798, 42568, 42078, 41904, 41960, /* 5272-5279 */
-41312, 40654, 40096, 38754, 37324, 35788, 34428, 33054, /* 5280-5287 */
-31228, 29712, 28298, 27084, 26140, 24778, 23494, 22594, /* 5288-5295 */
-21612, 21476, 22252, 22478, 22778, 23102, 22902, 23024, /* 5296-5303 */
-23100, 23384, 23654, 23444, 23648, 24008, 24266, 24306, /* 5304-5311 */
-24652, 25494, 26352, 27796, 29340, 30870, 32296, 33312, /* 5312-5319 */
-34954, 36790, 38280, 40114, 41612, 42238, 43090, 43556, /* 5320-5327 */
-43460, 43706, 43090, 42666, 43010, 42716, 42744, 42720, /* 5328-5335 */
-42374, 42508, 42074, 41620, 41668, 40684, 39946, 39624, /* 5336-5343 */
-37906, 36804, 35846, 33692, 32472, 31288, 29232, 27980, /* 5344-5351 */
-27338, 26308, 25358, 24530, 23852, 23830, 23788, 24160, /* 5352-5359 */
-24560, 24176, 24580, 24888, 24214, 24232, 24258, 23870, /* 5360-5367 */
-24222, 24114, 23914, 24538, 24398, 24804, 25768, 25966, /* 5368-5375 */
-27274, 29130, 30260, 31560, 32830, 33858, 35610, 37032, /* 5376-5383 */
-37934, 39766, 40258, 39902, 40894, 40990, 40638, 41014, /* 5384-5391 */
-40978, 41190, 41378, 41072, 41504, 41708, 41360, 41586, /* 5392-5399 */
-41550, 41568, 41682, 40858, 40188, 39540, 38088, 37094, /* 5400-5407 */
-36276, 34562, 32950, 31670, 30212, 29104, 28208, 27224, /* 5408-5415 */
-26568, 25872, 25320, 25250, 24940, 25082, 25232, 24580, /* 5416-5423 */
-24514, 24528, 24062, 23862, 23932, 23782, 23630, 23920, /* 5424-5431 */
-23542, 23172, 23286, 23376, 24576, 25898, 27088, 28736, /* 5432-5439 */
-29680, 30682, 32342, 33556, 34974, 36746, 37806, 38946, /* 5440-5447 */
-39582, 39850, 40844, 40902, 40712, 41042, 40908, 40824, /* 5448-5455 */
-41324, 41578, 41076, 41094, 41488, 41952, 42224, 41848, /* 5456-5463 */
-41764, 41348, 40812, 40398, 39012, 37532, 36444, 34778, /* 5464-5471 */
-33192, 32310, 30704, 29484, 29164, 28046, 27140, 26598, /* 5472-5479 */
-26098, 26066, 25938, 25872, 26000, 25958, 25844, 25618, /* 5480-5487 */
-25120, 24884, 24670, 24212, 24008, 23862, 23786, 23706, /* 5488-5495 */
-23808, 23978, 24114, 24968, 25984, 27186, 28566, 29322, /* 5496-5503 */
-30328, 31786, 32754, 33864, 35654, 36920, 37730, 38642, /* 5504-5511 */
-39120, 39322, 39486, 39840, 40310, 40488, 40690, 41218, /* 5512-5519 */
-41586, 41422, 41368, 41752, 42228, 42538, 42686, 42760, /* 5520-5527 */
-42586, 41930, 41028, 40180, 39054, 37742, 36556, 35310, /* 5528-5535 */
-33994, 32818, 31610, 30398, 29434, 28328, 27730, 27598, /* 5536-5543 */
-27246, 27080, 26658, 26480, 26616, 26266, 25744, 24960, /* 5544-5551 */
-24410, 24268, 23800, 23416, 23352, 22858, 22598, 22870, /* 5552-5559 */
-22960, 23510, 24382, 25506, 26676, 27512, 28576, 29764, /* 5560-5567 */
-31154, 32310, 33682, 35056, 35748, 36820, 37508, 38002, /* 5568-5575 */
-38680, 39036, 39748, 40362, 40486, 40778, 41470, 41624, /* 5576-5583 */
-41816, 42296, 42474, 43086, 43124, 42850, 42906, 42406, /* 5584-5591 */
-41670, 41104, 40494, 39320, 38056, 36820, 35694, 34460, /* 5592-5599 */
-32826, 31874, 30968, 29948, 29454, 28998, 28418, 27968, /* 5600-5607 */
-27612, 27114, 26906, 26536, 26184, 26136, 25794, 25670, /* 5608-5615 */
-25606, 25512, 25136, 24604, 24490, 24208, 24256, 24686, /* 5616-5623 */
-24952, 25302, 25686, 26342, 26962, 27338, 28246, 29320, /* 5624-5631 */
-30318, 31598, 32554, 33214, 33760, 34252, 35240, 36186, /* 5632-5639 */
-36824, 37746, 38222, 38320, 38940, 39256, 39602, 40082, /* 5640-5647 */
-40122, 40880, 41654, 41816, 42000, 41918, 41724, 41484, /* 5648-5655 */
-41172, 40916, 40486, 39648, 38832, 38108, 37100, 35940, /* 5656-5663 */
-34784, 33866, 32962, 32362, 31942, 31272, 30868, 30160, /* 5664-5671 */
-29312, 28790, 28324, 27824, 27336, 27014, 26376, 26042, /* 5672-5679 */
-26014, 25630, 25456, 25280, 24978, 25048, 25488, 25578, /* 5680-5687 */
-25558, 25902, 26078, 26378, 26668, 26914, 27736, 28500, /* 5688-5695 */
-28956, 29710, 30278, 30594, 31342, 31846, 32292, 33276, /* 5696-5703 */
-34010, 34796, 35852, 36308, 36906, 37858, 37984, 38198, /* 5704-5711 */
-38578, 38602, 39280, 39960, 40102, 40130, 40180, 40348, /* 5712-5719 */
-40366, 40232, 40104, 39704, 39118, 38920, 38602, 37888, /* 5720-5727 */
-37284, 36686, 36064, 35510, 35050, 34584, 34124, 33442, /* 5728-5735 */
-32556, 31794, 31226, 30922, 30378, 29774, 29270, 28688, /* 5736-5743 */
-28430, 28192, 27548, 26966, 26836, 26570, 26492, 26718, /* 5744-5751 */
-26436, 26214, 26402, 26614, 26758, 26932, 26974, 27024, /* 5752-5759 */
-27078, 27068, 27518, 27930, 28322, 29024, 29564, 29996, /* 5760-5767 */
-30800, 31620, 32016, 32794, 33514, 34334, 35310, 35584, /* 5768-5775 */
-36318, 36984, 37304, 38096, 38480, 38392, 38538, 38860, /* 5776-5783 */
-39158, 39406, 38996, 38942, 39476, 39450, 39686, 39542, /* 5784-5791 */
-39092, 39052, 38610, 38472, 38462, 37636, 36884, 36536, /* 5792-5799 */
-35680, 34872, 34372, 33688, 33296, 32678, 31902, 31404, /* 5800-5807 */
-30796, 30216, 29816, 29598, 29390, 29198, 28928, 28664, /* 5808-5815 */
-28452, 28150, 28174, 28228, 28078, 28026, 27996, 27968, /* 5816-5823 */
-27834, 27522, 27428, 27616, 27660, 27722, 27778, 27752, /* 5824-5831 */
-28016, 28434, 28924, 29552, 29920, 30200, 30898, 31420, /* 5832-5839 */
-31684, 32200, 32966, 33700, 34158, 34766, 35152, 35216, /* 5840-5847 */
-35626, 36064, 36392, 36772, 37042, 37260, 37680, 37786, /* 5848-5855 */
-37916, 38438, 38522, 38738, 39030, 38960, 38906, 38652, /* 5856-5863 */
-38454, 38480, 38188, 37592, 37214, 36642, 36060, 35728, /* 5864-5871 */
-34974, 34238, 33536, 32938, 32708, 32272, 31688, 31254, /* 5872-5879 */
-31094, 30906, 30588, 30234, 29668, 29124, 28660, 28272, /* 5880-5887 */
-27950, 27522, 27118, 26870, 26802, 26846, 26826, 26808, /* 5888-5895 */
-26988, 27114, 26994, 27080, 27314, 27378, 27688, 28008, /* 5896-5903 */
-28218, 28586, 28882, 29322, 29712, 29932, 30302, 30878, /* 5904-5911 */
-31468, 31922, 32638, 33136, 33548, 34314, 34834, 35340, /* 5912-5919 */
-35928, 36392, 36806, 37344, 37594, 37716, 38170, 38152, /* 5920-5927 */
-38320, 38598, 38486, 38646, 38530, 38416, 38436, 38122, /* 5928-5935 */
-37778, 37670, 37396, 36954, 36830, 36344, 35800, 35316, /* 5936-5943 */
-34668, 34274, 33632, 33150, 32760, 32178, 31748, 31226, /* 5944-5951 */
-30838, 30466, 29922, 29512, 29346, 28966, 28568, 28530, /* 5952-5959 */
-28226, 28026, 27956, 27736, 27804, 27794, 27718, 27754, /* 5960-5967 */
-27738, 27774, 27946, 28146, 28194, 28274, 28438, 28718, /* 5968-5975 */
-29160, 29494, 29790, 30110, 30494, 30998, 31466, 31890, /* 5976-5983 */
-32468, 33162, 33634, 34076, 34332, 34348, 34656, 34916, /* 5984-5991 */
-35318, 35874, 36066, 36386, 36828, 36966, 37022, 37160, /* 5992-5999 */
-37208, 37478, 37784, 37780, 37914, 37784, 37482, 37372, /* 6000-6007 */
-37058, 36732, 36360, 35934, 35724, 35500, 35084, 34766, /* 6008-6015 */
-34410, 33906, 33694, 33452, 33232, 33112, 32746, 32648, /* 6016-6023 */
-32514, 31960, 31550, 31240, 30846, 30618, 30414, 30128, /* 6024-6031 */
-29980, 29658, 29368, 29328, 28962, 28684, 28748, 28848, /* 6032-6039 */
-29044, 29238, 29420, 29430, 29344, 29408, 29428, 29388, /* 6040-6047 */
-29354, 29354, 29368, 29568, 29838, 29862, 30008, 30190, /* 6048-6055 */
-30262, 30590, 31112, 31616, 32090, 32600, 33046, 33436, /* 6056-6063 */
-33930, 34396, 34690, 35130, 35738, 35998, 36196, 36508, /* 6064-6071 */
-36546, 36396, 36338, 36608, 36872, 36998, 37138, 36988, /* 6072-6079 */
-36878, 37186, 37282, 37090, 37106, 37020, 36910, 36930, /* 6080-6087 */
-36634, 36166, 35786, 35510, 35176, 34796, 34442, 33886, /* 6088-6095 */
-33290, 32956, 32666, 32392, 32404, 32304, 32140, 32002, /* 6096-6103 */
-31636, 31506, 31386, 31138, 30932, 30626, 30478, 30318, /* 6104-6111 */
-30014, 29738, 29468, 29078, 28856, 28936, 28748, 28566, /* 6112-6119 */
-28716, 28792, 28754, 28782, 28892, 29044, 29176, 29216, /* 6120-6127 */
-29300, 29526, 29730, 29908, 30044, 30084, 30308, 30766, /* 6128-6135 */
-31296, 31890, 32190, 32208, 32570, 33090, 33314, 33752, /* 6136-6143 */
-34338, 34656, 35094, 35522, 35858, 36152, 36174, 36276, /* 6144-6151 */
-36658, 37014, 37210, 37412, 37340, 37136, 37136, 37060, /* 6152-6159 */
-37210, 37250, 36916, 36770, 36650, 36454, 36142, 35822, /* 6160-6167 */
-35684, 35566, 35378, 35202, 35012, 34516, 34074, 33750, /* 6168-6175 */
-33284, 33068, 32900, 32690, 32450, 32052, 31760, 31510, /* 6176-6183 */
-31238, 31028, 30846, 30640, 30524, 30422, 30186, 30034, /* 6184-6191 */
-29846, 29654, 29640, 29662, 29646, 29588, 29550, 29456, /* 6192-6199 */
-29396, 29346, 29278, 29412, 29480, 29542, 29632, 29644, /* 6200-6207 */
-29774, 29870, 30034, 30206, 30266, 30620, 31104, 31530, /* 6208-6215 */
-31950, 32162, 32328, 32596, 32908, 33196, 33422, 33734, /* 6216-6223 */
-34124, 34466, 34750, 35074, 35308, 35426, 35658, 35906, /* 6224-6231 */
-36268, 36660, 36800, 36818, 36734, 36732, 36920, 37042, /* 6232-6239 */
-36964, 36806, 36714, 36614, 36486, 36254, 35862, 35542, /* 6240-6247 */
-35348, 35256, 35192, 34918, 34604, 34340, 34004, 33828, /* 6248-6255 */
-33694, 33416, 33154, 32816, 32514, 32438, 32322, 32106, /* 6256-6263 */
-31862, 31574, 31328, 31146, 31090, 30882, 30570, 30506, /* 6264-6271 */
-30414, 30300, 30142, 29984, 29956, 29808, 29772, 29842, /* 6272-6279 */
-29796, 29764, 29700, 29586, 29642, 29822, 29922, 30022, /* 6280-6287 */
-29992, 29908, 30006, 30160, 30412, 30600, 30732, 31038, /* 6288-6295 */
-31198, 31318, 31698, 31876, 31912, 32180, 32488, 32796, /* 6296-6303 */
-33088, 33238, 33424, 33772, 34014, 34182, 34362, 34484, /* 6304-6311 */
-34566, 34568, 34838, 35162, 35186, 35198, 35228, 35260, /* 6312-6319 */
-35346, 35462, 35392, 35414, 35544, 35414, 35356, 35302, /* 6320-6327 */
-35274, 35196, 34990, 35036, 34980, 34756, 34600, 34380, /* 6328-6335 */
-34188, 34058, 33868, 33792, 33798, 33608, 33380, 33274, /* 6336-6343 */
-33190, 32876, 32576, 32514, 32346, 32128, 32034, 31966, /* 6344-6351 */
-31786, 31680, 31534, 31224, 31144, 31014, 30834, 30890, /* 6352-6359 */
-30786, 30530, 30362, 30258, 30188, 30110, 30104, 30202, /* 6360-6367 */
-30180, 30068, 30076, 30080, 30066, 30180, 30244, 30260, /* 6368-6375 */
-30400, 30458, 30452, 30488, 30448, 30450, 30630, 30884, /* 6376-6383 */
-31056, 31200, 31356, 31536, 31748, 31950, 32198, 32436, /* 6384-6391 */
-32632, 32878, 33116, 33262, 33370, 33460, 33630, 33882, /* 6392-6399 */
-34068, 34234, 34322, 34424, 34508, 34438, 34534, 34736, /* 6400-6407 */
-34822, 34904, 34982, 34994, 34998, 34940, 34906, 35104, /* 6408-6415 */
-35196, 35096, 35080, 35034, 34968, 34942, 34758, 34590, /* 6416-6423 */
-34510, 34364, 34360, 34322, 34094, 33914, 33804, 33736, /* 6424-6431 */
-33672, 33500, 33256, 33236, 33234, 33166, 33148, 32858, /* 6432-6439 */
-32532, 32226, 31982, 31950, 31752, 31544, 31338, 31066, /* 6440-6447 */
-30942, 30806, 30628, 30420, 30294, 30274, 30240, 30284, /* 6448-6455 */
-30192, 30062, 30078, 30046, 30140, 30262, 30308, 30396, /* 6456-6463 */
-30472, 30656, 30792, 30820, 30876, 30922, 30998, 31150, /* 6464-6471 */
-31352, 31506, 31642, 31736, 31890, 32168, 32366, 32556, /* 6472-6479 */
-32778, 32954, 33094, 33206, 33316, 33430, 33532, 33558, /* 6480-6487 */
-33630, 33814, 33986, 34112, 34104, 34070, 34160, 34244, /* 6488-6495 */
-34290, 34358, 34418, 34500, 34592, 34606, 34638, 34696, /* 6496-6503 */
-34724, 34814, 34790, 34762, 34856, 34758, 34676, 34620, /* 6504-6511 */
-34398, 34362, 34430, 34414, 34456, 34396, 34262, 34148, /* 6512-6519 */
-34024, 33992, 33902, 33778, 33708, 33634, 33620, 33612, /* 6520-6527 */
-33534, 33332, 33170, 33054, 32924, 32886, 32766, 32622, /* 6528-6535 */
-32514, 32424, 32382, 32208, 32056, 31982, 31848, 31804, /* 6536-6543 */
-31728, 31582, 31586, 31526, 31362, 31268, 31212, 31214, /* 6544-6551 */
-31194, 31112, 31056, 31014, 30982, 31026, 30946, 30834, /* 6552-6559 */
-30888, 30858, 30926, 31050, 31080, 31164, 31204, 31318, /* 6560-6567 */
-31482, 31592, 31756, 31892, 31998, 32162, 32256, 32328, /* 6568-6575 */
-32460, 32510, 32620, 32760, 32944, 33202, 33292, 33294, /* 6576-6583 */
-33264, 33296, 33440, 33628, 33758, 33798, 33838, 33870, /* 6584-6591 */
-33980, 34016, 33970, 33936, 33868, 33922, 33992, 34034, /* 6592-6599 */
-34042, 33978, 33974, 34008, 34006, 33962, 33926, 33908, /* 6600-6607 */
-33926, 33992, 34024, 33982, 33930, 33886, 33810, 33816, /* 6608-6615 */
-33862, 33856, 33888, 33872, 33764, 33698, 33692, 33654, /* 6616-6623 */
-33558, 33448, 33348, 33276, 33230, 33178, 33056, 32846, /* 6624-6631 */
-32712, 32676, 32622, 32566, 32442, 32268, 32148, 32008, /* 6632-6639 */
-31884, 31826, 31696, 31582, 31570, 31530, 31504, 31416, /* 6640-6647 */
-31300, 31262, 31190, 31200, 31226, 31214, 31206, 31154, /* 6648-6655 */
-31166, 31264, 31324, 31324, 31442, 31592, 31638, 31700, /* 6656-6663 */
-31774, 31810, 31858, 31946, 31990, 32024, 32072, 32102, /* 6664-6671 */
-32206, 32356, 32438, 32434, 32428, 32488, 32614, 32708, /* 6672-6679 */
-32806, 32860, 32834, 32918, 32992, 33078, 33146, 33092, /* 6680-6687 */
-33110, 33158, 33234, 33310, 33368, 33390, 33340, 33392, /* 6688-6695 */
-33468, 33526, 33546, 33520, 33538, 33516, 33512, 33550, /* 6696-6703 */
-33558, 33536, 33508, 33558, 33648, 33716, 33706, 33692, /* 6704-6711 */
-33676, 33636, 33708, 33768, 33762, 33740, 33690, 33702, /* 6712-6719 */
-33684, 33624, 33574, 33508, 33464, 33410, 33366, 33384, /* 6720-6727 */
-33354, 33258, 33176, 33084, 32998, 32916, 32826, 32792, /* 6728-6735 */
-32766, 32706, 32658, 32586, 32446, 32342, 32252, 32152, /* 6736-6743 */
-32072, 31974, 31922, 31856, 31800, 31774, 31698, 31676, /* 6744-6751 */
-31730, 31790, 31780, 31730, 31680, 31660, 31732, 31832, /* 6752-6759 */
-31884, 31892, 31918, 31944, 32032, 32120, 32116, 32108, /* 6760-6767 */
-32096, 32188, 32324, 32402, 32440, 32484, 32580, 32656, /* 6768-6775 */
-32790, 32912, 32932, 32940, 32968, 33022, 33050, 33068, /* 6776-6783 */
-33058, 33056, 33078, 33052, 33050, 33060, 33046, 33026, /* 6784-6791 */
-33038, 33056, 33060, 33086, 33142, 33208, 33218, 33224, /* 6792-6799 */
-33244, 33222, 33204, 33188, 33190, 33220, 33206, 33196, /* 6800-6807 */
-33180, 33088, 33058, 33112, 33196, 33322, 33426, 33502, /* 6808-6815 */
-33598, 33668, 33692, 33722, 33736, 33760, 33810, 33836, /* 6816-6823 */
-33826, 33750, 33638, 33550, 33514, 33492, 33434, 33408, /* 6824-6831 */
-33368, 33304, 33288, 33250, 33206, 33170, 33102, 33092, /* 6832-6839 */
-33072, 33002, 32934, 32818, 32702, 32568, 32474, 32408, /* 6840-6847 */
-32296, 32230, 32142, 32092, 32060, 31990, 31968, 31932, /* 6848-6855 */
-31932, 31976, 32002, 32040, 32074, 32088, 32140, 32168, /* 6856-6863 */
-32146, 32142, 32138, 32196, 32244, 32234, 32230, 32184, /* 6864-6871 */
-32160, 32212, 32282, 32350, 32434, 32490, 32584, 32716, /* 6872-6879 */
-32774, 32856, 32950, 33010, 33072, 33152, 33200, 33164, /* 6880-6887 */
-33138, 33138, 33126, 33114, 33126, 33116, 33108, 33134, /* 6888-6895 */
-33148, 33196, 33214, 33224, 33254, 33276, 33354, 33380, /* 6896-6903 */
-33364, 33350, 33296, 33282, 33280, 33226, 33162, 33072, /* 6904-6911 */
-33004, 33010, 33002, 32984, 32962, 32936, 32936, 32936, /* 6912-6919 */
-32932, 32918, 32910, 32910, 32934, 32942, 32922, 32876, /* 6920-6927 */
-32830, 32838, 32810, 32790, 32778, 32716, 32678, 32658, /* 6928-6935 */
-32666, 32682, 32692, 32716, 32720, 32698, 32688, 32716, /* 6936-6943 */
-32734, 32754, 32774, 32782, 32798, 32802, 32782, 32746, /* 6944-6951 */
-32708, 32698, 32700, 32672, 32656, 32624, 32574, 32546, /* 6952-6959 */
-32510, 32494, 32482, 32498, 32536, 32560, 32580, 32558, /* 6960-6967 */
-32566, 32576, 32548, 32540, 32538, 32538, 32542, 32546, /* 6968-6975 */
-32548, 32546, 32548, 32552, 32554, 32552, 32560, 32572, /* 6976-6983 */
-32590, 32644, 32680, 32666, 32696, 32734, 32748, 32780, /* 6984-6991 */
-32792, 32790, 32802, 32806, 32806, 32790, 32768, 32762, /* 6992-6999 */
-32776, 32794, 32790, 32766, 32760, 32772, 32780, 32808, /* 7000-7007 */
-32854, 32876, 32890, 32932, 32968, 32982, 32988, 32976, /* 7008-7015 */
-32968, 32976, 32984, 32982, 32966, 32948, 32928, 32906, /* 7016-7023 */
-32896, 32892, 32884, 32884, 32904, 32930, 32958, 33000, /* 7024-7031 */
-33018, 33014, 33010, 32982, 32954, 32938, 32932, 32914, /* 7032-7039 */
-32872, 32834, 32794, 32742, 32698, 32670, 32666, 32670, /* 7040-7047 */
-32658, 32646, 32640, 32630, 32622, 32602, 32586, 32586, /* 7048-7055 */
-32580, 32582, 32600, 32604, 32594, 32562, 32542, 32540, /* 7056-7063 */
-32528, 32548, 32576, 32596, 32628, 32640, 32650, 32664, /* 7064-7071 */
-32674, 32700, 32726, 32762, 32786, 32798, 32804, 32808, /* 7072-7079 */
-32840, 32848, 32842, 32850, 32838, 32836, 32834, 32812, /* 7080-7087 */
-32806, 32810, 32814, 32824, 32842, 32862, 32886, 32912, /* 7088-7095 */
-32922, 32930, 32932, 32936, 32950, 32948, 32956, 32974, /* 7096-7103 */
-32958, 32936, 32916, 32912, 32922, 32908, 32896, 32872, /* 7104-7111 */
-32860, 32890, 32908, 32910, 32904, 32894, 32902, 32914, /* 7112-7119 */
-32928, 32916, 32900, 32916, 32936, 32938, 32906, 32870, /* 7120-7127 */
-32852, 32838, 32838, 32824, 32788, 32752, 32728, 32738, /* 7128-7135 */
-32750, 32756, 32756, 32752, 32762, 32770, 32770, 32754, /* 7136-7143 */
-32748, 32752, 32724, 32716, 32720, 32692, 32668, 32650, /* 7144-7151 */
-32636, 32626, 32622, 32626, 32626, 32630, 32634, 32650, /* 7152-7159 */
-32656, 32662, 32690, 32692, 32692, 32694, 32682, 32684, /* 7160-7167 */
-32682, 32674, 32660, 32654, 32654, 32640, 32644, 32652, /* 7168-7175 */
-32656, 32660, 32652, 32676, 32708, 32736, 32770, 32780, /* 7176-7183 */
-32786, 32802, 32824, 32820, 32804, 32806, 32788, 32772, /* 7184-7191 */
-32760, 32734, 32704, 32682, 32682, 32678, 32690, 32704, /* 7192-7199 */
-32702, 32718, 32720, 32734, 32762, 32760, 32772, 32782, /* 7200-7207 */
-32784, 32790, 32778, 32760, 32748, 32736, 32702, 32680, /* 7208-7215 */
-32682, 32664, 32658, 32660, 32642, 32636, 32640, 32660, /* 7216-7223 */
-32682, 32698, 32700, 32700, 32712, 32704, 32694, 32690, /* 7224-7231 */
-32674, 32676, 32662, 32636, 32628, 32608, 32600, 32598, /* 7232-7239 */
-32586, 32576, 32576, 32580, 32594, 32606, 32602, 32612, /* 7240-7247 */
-32628, 32634, 32654, 32662, 32656, 32664, 32664, 32658, /* 7248-7255 */
-32652, 32642, 32642, 32636, 32642, 32656, 32652, 32662, /* 7256-7263 */
-32680, 32696, 32720, 32724, 32734, 32764, 32772, 32782, /* 7264-7271 */
-32804, 32800, 32806, 32824, 32826, 32824, 32818, 32808, /* 7272-7279 */
-32808, 32802, 32790, 32778, 32776, 32786, 32786, 32792, /* 7280-7287 */
-32794, 32780, 32774, 32762, 32760, 32764, 32750, 32740, /* 7288-7295 */
-32736, 32726, 32724, 32718, 32704, 32698, 32690, 32682, /* 7296-7303 */
-32686, 32694, 32702, 32700, 32686, 32684, 32684, 32692, /* 7304-7311 */
-32712, 32718, 32726, 32728, 32724, 32734, 32742, 32758, /* 7312-7319 */
-32768, 32764, 32766, 32766, 32786, 32800, 32792, 32796, /* 7320-7327 */
-32800, 32802, 32806, 32804, 32802, 32806, 32812, 32810, /* 7328-7335 */
-32810, 32810, 32810, 32808, 32798, 32794, 32790, 32784, /* 7336-7343 */
-32776, 32764, 32774, 32776, 32762, 32762, 32764, 32758, /* 7344-7351 */
-32754, 32758, 32756, 32744, 32744, 32746, 32744, 32742, /* 7352-7359 */
-32744, 32748, 32750, 32752, 32758, 32764, 32770, 32770, /* 7360-7367 */
-32770, 32764, 32766, 32776, 32776, 32770, 32772, 32776, /* 7368-7375 */
-32776, 32784, 32784, 32782, 32792, 32792, 32792, 32800, /* 7376-7383 */
-32800, 32798, 32796, 32802, 32808, 32800, 32792, 32792, /* 7384-7391 */
-32792, 32794, 32794, 32788, 32784, 32782, 32780, 32784, /* 7392-7399 */
-32784, 32780, 32776, 32764, 32762, 32764, 32756, 32760, /* 7400-7407 */
-32756, 32752, 32756, 32750, 32748, 32748, 32750, 32748, /* 7408-7415 */
-32740, 32742, 32744, 32740, 32738, 32742, 32742, 32742, /* 7416-7423 */
-32748, 32744, 32746, 32752, 32750, 32744, 32748, 32748, /* 7424-7431 */
-32748, 32754, 32756, 32754, 32754, 32754, 32758, 32762, /* 7432-7439 */
-32758, 32762, 32764, 32764, 32770, 32764, 32758, 32758, /* 7440-7447 */
-32756, 32762, 32768, 32770, 32774, 32772, 32760, 32756, /* 7448-7455 */
-32762, 32764, 32766, 32766, 32768, 32766, 32766, 32768, /* 7456-7463 */
-32768, 32768, 32766, 32768, 32770, 32766, 32770, 32764, /* 7464-7471 */
-32762, 32764, 32762, 32764, 32764, 32766, 32768, 32764, /* 7472-7479 */
-32766, 32768, 32764, 32764, 32768, 32770, 32770, 32772, /* 7480-7487 */
-32772, 32772, 32774, 32774, 32772, 32770, 32772, 32770, /* 7488-7495 */
-32766, 32770, 32772, 32770, 32772, 32768, 32768, 32770, /* 7496-7503 */
-32772, 32770, 32764, 32764, 32766, 32770, 32772, 32768, /* 7504-7511 */
-32766, 32768, 32766, 32768, 32766, 32762, 32762, 32764, /* 7512-7519 */
-32764, 32768, 32764, 32764, 32768, 32768, 32766, 32764, /* 7520-7527 */
-32764, 32762, 32766, 32766, 32764, 32764, 32760, 32766, /* 7528-7535 */
-32772, 32770, 32768, 32770, 32772, 32768, 32766, 32768, /* 7536-7543 */
-32768, 32768, 32768, 32768, 32768, 32766, 32764, 32768, /* 7544-7551 */
-32768, 32768, 32768, 32770, 32772, 32770, 32766, 32766, /* 7552-7559 */
-32770, 32764, 32762, 32762, 32762, 32764, 32764, 32762, /* 7560-7567 */
-32764, 32766, 32766, 32766, 32766, 32764, 32766, 32770, /* 7568-7575 */
-32766, 32766, 32766, 32764, 32768, 32770, 32766, 32768, /* 7576-7583 */
-32768, 32768, 32770, 32770, 32768, 32766, 32766, 32770, /* 7584-7591 */
-32768, 32768, 32770, 32770, 32770, 32770, 32770, 32768, /* 7592-7599 */
-32766, 32768, 32770, 32770, 32770, 32772, 32772, 32770, /* 7600-7607 */
-32770, 32770, 32768, 32770, 32770, 32766, 32766, 32768, /* 7608-7615 */
-32770, 32766, 32768, 32768, 32766, 32766, 32766, 32768, /* 7616-7623 */
-32766, 32766, 32768, 32766, 32770, 32768, 32768, 32770, /* 7624-7631 */
-32768, 32770, 32770, 32768, 32768, 32768, 32768, 32770, /* 7632-7639 */
-32768, 32766, 32766, 32770, 32770, 32770, 32770, 32766, /* 7640-7647 */
-32766, 32766, 32766, 32768, 32768, 32768, 32768, 32768, /* 7648-7655 */
-32766, 32766, 32766, 32764, 32764, 32766, 32766, 32766, /* 7656-7663 */
-32764, 32764, 32766, 32764, 32764, 32766, 32766, 32766, /* 7664-7671 */
-32766, 32764, 32766, 32766, 32764, 32764, 32766, 32766, /* 7672-7679 */
-32764, 32766, 32764, 32764, 32766, 32766, 32768, 32766, /* 7680-7687 */
-32768, 32770, 32768, 32770, 32770, 32768, 32770, 32770, /* 7688-7695 */
-32772, 32772, 32770, 32770, 32770, 32770, 32772, 32770, /* 7696-7703 */
-32768, 32768, 32770, 32770, 32770, 32770, 32768, 32768, /* 7704-7711 */
-32770, 32770, 32768, 32768, 32768, 32766, 32766, 32768, /* 7712-7719 */
-32768, 32768, 32768, 32768, 32768, 32770, 32766, 32766, /* 7720-7727 */
-32768, 32768, 32770, 32768, 32768, 32768, 32766, 32766, /* 7728-7735 */
-32766, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7736-7743 */
-32768, 32768, 32768, 32768, 32766, 32768, 32766, 32766, /* 7744-7751 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7752-7759 */
-32768, 32768, 32768, 32770, 32770, 32768, 32768, 32768, /* 7760-7767 */
-32768, 32768, 32768, 32770, 32770, 32768, 32768, 32768, /* 7768-7775 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7776-7783 */
-32768, 32768, 32768, 32768, 32768, 32768, 32770, 32768, /* 7784-7791 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7792-7799 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7800-7807 */
-32768, 32768, 32768, 32768, 32768, 32768, 32770, 32770, /* 7808-7815 */
-32770, 32768, 32770, 32770, 32770, 32768, 32768, 32768, /* 7816-7823 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7824-7831 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7832-7839 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7840-7847 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7848-7855 */
-32768, 32768, 32768, 32766, 32768, 32768, 32768, 32768, /* 7856-7863 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7864-7871 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7872-7879 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7880-7887 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7888-7895 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7896-7903 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7904-7911 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7912-7919 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7920-7927 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7928-7935 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7936-7943 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7944-7951 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7952-7959 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7960-7967 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7968-7975 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7976-7983 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7984-7991 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 7992-7999 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 8000-8007 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 8008-8015 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, /* 8016-8023 */
-32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768}; /* 8024-8031 */
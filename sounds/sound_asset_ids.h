@@ -0,0 +1,15 @@
+// This file was generated by executing this statement: wav2c -m sounds.manifest
+#ifndef SOUND_ASSET_IDS_H_
+#define SOUND_ASSET_IDS_H_
+
+#define SOUND_ASSET_GAMEBOYSTARTUP 0
+#define SOUND_ASSET_GAMEOVER48K 1
+#define SOUND_ASSET_JOHNCENA 2
+#define SOUND_ASSET_MISSIONFAILED 3
+#define SOUND_ASSET_OUCH48K 4
+#define SOUND_ASSET_PACMANDEATH 5
+#define SOUND_ASSET_ROBLOXOOF 6
+#define SOUND_ASSET_SCREAMANDDIE48K 7
+#define SOUND_ASSET_COUNT 8
+
+#endif /* SOUND_ASSET_IDS_H_ */
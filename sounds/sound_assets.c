@@ -0,0 +1,75 @@
+#include "sound_assets.h"
+
+#include "../adpcm.h"
+
+// Link the blob written by wav2c -b into read-only data.  SOUND_ASSETS_BLOB is
+// the path of the blob, set by the build.
+__asm__(".section .rodata\n"
+        ".balign 4\n"
+        ".global sound_assets_blob\n"
+        "sound_assets_blob:\n"
+        ".incbin \"" SOUND_ASSETS_BLOB "\"\n"
+        ".previous\n");
+
+extern const uint8_t sound_assets_blob[];
+
+static const uint8_t *sound_assets = sound_assets_blob;
+
+// Returns true if asset's samples fit in its data and it can be played.
+static bool sound_assets_validEntry(const sound_asset_t *asset) {
+  if (asset->sample_rate == 0 || asset->sample_rate > SOUND_ASSETS_MAX_RATE)
+    return false;
+  switch (asset->format) {
+  case SOUND_ASSET_FORMAT_PCM16:
+    return asset->sample_count <= asset->length / sizeof(uint16_t);
+  case SOUND_ASSET_FORMAT_ADPCM:
+    return asset->sample_count / ADPCM_SAMPLES_PER_BLOCK +
+               (asset->sample_count % ADPCM_SAMPLES_PER_BLOCK != 0) <=
+           asset->length / ADPCM_BLOCK_SIZE;
+  default:
+    return false;
+  }
+}
+
+// Returns true if the index fits in size bytes and every sound's data lies
+// inside the blob and holds its samples.
+static bool sound_assets_valid(const uint8_t *blob, size_t size) {
+  const sound_assets_header_t *header = (const sound_assets_header_t *)blob;
+  if (size < sizeof(*header) || header->magic != SOUND_ASSETS_MAGIC)
+    return false;
+  // Bound count before multiplying, a corrupt one could wrap the product.
+  if (header->count > (size - sizeof(*header)) / sizeof(sound_asset_t))
+    return false;
+  size_t indexEnd = sizeof(*header) + header->count * sizeof(sound_asset_t);
+  const sound_asset_t *index = (const sound_asset_t *)(header + 1);
+  for (uint32_t i = 0; i < header->count; i++)
+    if (index[i].offset < indexEnd || index[i].offset > size ||
+        index[i].length > size - index[i].offset ||
+        !sound_assets_validEntry(&index[i]))
+      return false;
+  return true;
+}
+
+// Use blob instead of the linked-in sounds.  Returns false, and keeps the
+// current sounds, if blob is not a valid sound blob of size bytes.
+bool sound_assets_use(const void *blob, size_t size) {
+  if (!blob || ((uintptr_t)blob % SOUND_ASSETS_ALIGNMENT) ||
+      !sound_assets_valid(blob, size))
+    return false;
+  sound_assets = blob;
+  return true;
+}
+
+// Returns the index entry of sound id, NULL if there is no such sound.
+const sound_asset_t *sound_assets_get(uint32_t id) {
+  const sound_assets_header_t *header =
+      (const sound_assets_header_t *)sound_assets;
+  if (header->magic != SOUND_ASSETS_MAGIC || id >= header->count)
+    return NULL;
+  return (const sound_asset_t *)(header + 1) + id;
+}
+
+// Returns the sample data of a sound.
+const void *sound_assets_data(const sound_asset_t *asset) {
+  return sound_assets + asset->offset;
+}
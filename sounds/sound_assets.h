@@ -0,0 +1,48 @@
+#ifndef SOUND_ASSETS_H_
+#define SOUND_ASSETS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Every sound is packed into one binary blob by wav2c -b.  The blob starts
+// with a sound_assets_header_t, followed by one sound_asset_t per sound and
+// then the sample data.  Offsets are from the start of the blob and aligned to
+// SOUND_ASSETS_ALIGNMENT, all fields are little-endian.  The blob is linked
+// into the program by sound_assets.c; on Linux the file can also be mapped
+// straight into memory and used in its place.
+#define SOUND_ASSETS_MAGIC 0x31444E53 // "SND1"
+#define SOUND_ASSETS_ALIGNMENT 4
+
+// Sample formats.
+#define SOUND_ASSET_FORMAT_PCM16 0 // 16-bit offset-binary samples.
+#define SOUND_ASSET_FORMAT_ADPCM 1 // IMA-ADPCM blocks, see adpcm.h.
+
+// The CODEC's rate. wav2c rejects sounds recorded faster, and so does
+// sound_assets_use().
+#define SOUND_ASSETS_MAX_RATE 48000
+
+typedef struct {
+  uint32_t magic; // SOUND_ASSETS_MAGIC.
+  uint32_t count; // Number of sounds in the index.
+} sound_assets_header_t;
+
+typedef struct {
+  uint32_t offset;       // Start of the data.
+  uint32_t length;       // Bytes of data.
+  uint32_t sample_count; // Number of samples.
+  uint32_t sample_rate;  // Samples per second.
+  uint32_t format;       // One of SOUND_ASSET_FORMAT_*.
+} sound_asset_t;
+
+// Use blob instead of the linked-in sounds.  Returns false, and keeps the
+// current sounds, if blob is not a valid sound blob of size bytes.
+bool sound_assets_use(const void *blob, size_t size);
+
+// Returns the index entry of sound id, NULL if there is no such sound.
+const sound_asset_t *sound_assets_get(uint32_t id);
+
+// Returns the sample data of a sound.
+const void *sound_assets_data(const sound_asset_t *asset);
+
+#endif /* SOUND_ASSETS_H_ */
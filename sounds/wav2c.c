@@ -4,6 +4,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "../adpcm.h"
+#include "sound_assets.h"
+
+// Build from this directory: gcc -o wav2c wav2c.c ../adpcm.c
 
 
 // Leave the following line uncommented unless you want to generate a simple tone.
@@ -15,6 +24,24 @@
 #define C_FILE_SUFFIX ".c"      // .c files have this suffix.
 #define EXTERN_STATEMENT "extern"  // Just the C extern statement.
 #define C_DATA_TYPE "uint16_t"  // Type for data in the .c file
+#define ADPCM_C_DATA_TYPE "uint8_t"  // Type for IMA-ADPCM data in the .c file
+#define ADPCM_OPTION "-a"       // Emit IMA-ADPCM blocks instead of PCM.
+#define BLOB_OPTION "-b"        // Pack several files into one sound blob.
+#define MANIFEST_OPTION "-m"    // Pack the files listed in a manifest.
+#define JOBS_OPTION "-j"        // Number of files converted at once.
+#define CACHE_OPTION "-C"       // Where converted files are kept between runs.
+#define CACHE_SUFFIX ".cache"   // Default cache directory is the blob name plus this.
+#define CACHE_MAGIC 0x43433257  // "W2CC"
+#define CACHE_VERSION 1         // Bump when the converted data changes.
+#define ADPCM_FORMAT_NAME "adpcm"  // Manifest name of SOUND_ASSET_FORMAT_ADPCM.
+#define PCM_FORMAT_NAME "pcm"   // Manifest name of SOUND_ASSET_FORMAT_PCM16.
+#define MAX_SOUNDS 256          // Most sounds in one manifest.
+#define MAX_LINE_LENGTH 1024    // Longest manifest line.
+#define MAX_IDS_LENGTH (MAX_SOUNDS * 80 + 1024)  // Size of the generated ids header.
+#define CODEC_SAMPLE_RATE 48000 // The CODEC plays everything at this rate.
+#define NANOSECONDS_PER_SECOND 1000000000LL
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
 #define SUPPORTED_WAVE_DATA_BIT_SIZE 16  // Program can only handle this size of data for now.
 
 // Header-specific defines. All sizes are numbered in bytes.
@@ -34,6 +61,10 @@
 #define SUBCHUNK2ID "data"      // String
 #define SUBCHUNK2ID_SIZE 5      // Make room for NULL>
 #define SUBCHUNK2SIZE 4         // Number.
+#define RIFF_HEADER_SIZE 12     // "RIFF", chunkSize, "WAVE".
+#define CHUNK_HEADER_SIZE 8     // Chunk id and size.
+#define FMT_CHUNK_SIZE 16       // Smallest fmt chunk.
+#define PCM_AUDIO_FORMAT 1      // audioFormat of PCM data.
 
 // This is the header for the wave vile.
 typedef struct  {
@@ -124,47 +155,595 @@ const char *get_filename_extension(const char* fileName) {
   return dot + 1;                            // Advance to the string that follows "."
 }
 
-int main(int argc, char* argv[]) {
-  // Print a helpful error message and exit if a file-name was not provided on the command line.
-  if (argc != 2) {
-    fprintf(stderr, "Usage: wav2c filename.wav\n");
-    exit(-1);
-  }
-  char inputFileName[MAX_FILENAME_LENGTH];         // Create a working buffer.
-  strncpy(inputFileName, argv[1], MAX_FILENAME_LENGTH);  // Copy the argv[1] filename into the working buffer.
+// Opens a .wav file and reads its header, leaving the file at the first sample.
+// Exits with an error message unless it is a 16-bit mono PCM .wav file.
+FILE* openWaveFile(const char* inputFileName, waveFileHeader_t* header) {
   // Make sure that the file-name has a .wav suffix.
   const char* extension = get_filename_extension(inputFileName);  // Get the suffix.
   // Compare the suffix and generate an error message if it is incorrect.
-  if (strncmp(extension, WAV_SUFFIX, MAX_FILENAME_LENGTH)) {              
+  if (strncmp(extension, WAV_SUFFIX, MAX_FILENAME_LENGTH)) {
     fprintf(stderr, "ERROR: input file-name \"%s\" does not have a %s suffix.\n", inputFileName, WAV_SUFFIX);
     exit(-1);  // Exit because of the error.
   }
-  
+
   // Try to open the file.
   FILE* inputFileFp = fopen(inputFileName, "rb");
   if (inputFileFp == NULL) {
-    printf("unable to find file:%s\n", argv[1]);
+    printf("unable to find file:%s\n", inputFileName);
     exit(-1);
   }
   // File is present and has correct extension if you get this far.
-  waveFileHeader_t header;
-  readWaveFileHeader(inputFileFp, &header);  // Read the header.
-  if (!waveFileHeaderOk(stderr, &header)) {  // Check the header.
+  readWaveFileHeader(inputFileFp, header);  // Read the header.
+  if (!waveFileHeaderOk(stderr, header)) {  // Check the header.
     fprintf(stderr, "ERROR: Input file (%s) contains errors. Maybe not a .wav file? See proceeding messages for details.\n", inputFileName);
-    printWaveFileHeader(stderr, &header);
+    printWaveFileHeader(stderr, header);
     exit(-1);
   }
   // File contents look good if you get this far.
   // Only handle mono files for now, check for this and exit if the file is not mono.
-  if (header.numChannels > 1) {
+  if (header->numChannels > 1) {
     fprintf(stderr, "INFO: wave file contains stereo data. This program only handles monophonic data for now. Exiting...\n");
     exit(-1);
   }
   // Only handle 16-bit data for now.
-  if (header.bitsPerSample != SUPPORTED_WAVE_DATA_BIT_SIZE) {
-    fprintf(stderr, "INFO: wave file contains %d-bit data. This program can only process %d-bit data. Exiting...\n", header.bitsPerSample, SUPPORTED_WAVE_DATA_BIT_SIZE);
+  if (header->bitsPerSample != SUPPORTED_WAVE_DATA_BIT_SIZE) {
+    fprintf(stderr, "INFO: wave file contains %d-bit data. This program can only process %d-bit data. Exiting...\n", header->bitsPerSample, SUPPORTED_WAVE_DATA_BIT_SIZE);
     exit(-1);
   }
+  return inputFileFp;
+}
+
+// Reads every sample of an open .wav file into a new buffer.
+int16_t* readWaveSamples(FILE* inputFileFp, const char* inputFileName, uint32_t sampleCount) {
+  int16_t* samples = malloc(sampleCount * sizeof(int16_t));
+  if (!samples || fread(samples, sizeof(int16_t), sampleCount, inputFileFp) != sampleCount) {
+    fprintf(stderr, "ERROR: unable to read %d samples from %s.\n", sampleCount, inputFileName);
+    exit(-1);
+  }
+  return samples;
+}
+
+// Writes the name of a .wav file without its suffix, upper-cased, into idName.
+void makeAssetId(const char* inputFileName, char* idName) {
+  const char* baseName = strrchr(inputFileName, '/');  // Drop any directories.
+  baseName = baseName ? baseName + 1 : inputFileName;
+  uint32_t i;
+  for (i=0; baseName[i] != '\0' && baseName[i] != '.'; i++) {
+    idName[i] = isalnum((unsigned char)baseName[i]) ? toupper(baseName[i]) : '_';
+  }
+  idName[i] = '\0';  // Make sure to terminate the string.
+}
+
+////////// Batch conversion //////////
+// A manifest lists the sounds to pack into one blob, one directive per line:
+//   blob sounds.bin             Blob to write.
+//   ids sound_asset_ids.h       Header that numbers the sounds.
+//   sound name.wav [adpcm|pcm]  A sound, IMA-ADPCM unless pcm is given.
+// File names are relative to the manifest; # starts a comment.
+//
+// Each sound is converted into a cache file by a pool of worker processes.
+// A cache file records the size and modification time of the .wav it came
+// from, so sounds whose .wav has not changed are not converted again. Sounds
+// with identical data are stored once in the blob, and the blob and header are
+// only rewritten when their contents change, so an unchanged rebuild leaves
+// every file alone.
+
+// Reads the whole file into a new buffer, returns NULL on error.
+uint8_t* readFile(const char* fileName, uint32_t* size) {
+  FILE* fp = fopen(fileName, "rb");
+  if (!fp)
+    return NULL;
+  uint8_t* data = NULL;
+  if (!fseek(fp, 0, SEEK_END)) {
+    long length = ftell(fp);
+    rewind(fp);
+    data = length >= 0 ? malloc(length ? length : 1) : NULL;
+    if (data && fread(data, 1, length, fp) != (size_t)length) {
+      free(data);
+      data = NULL;
+    }
+    *size = length;
+  }
+  fclose(fp);
+  return data;
+}
+
+// Writes size bytes to fileName unless it already holds exactly them, so that
+// unchanged outputs keep their time stamps. Returns false on error.
+bool writeFileIfChanged(const char* fileName, const void* data, uint32_t size, bool* changed) {
+  uint32_t oldSize;
+  uint8_t* old = readFile(fileName, &oldSize);
+  *changed = !old || oldSize != size || memcmp(old, data, size);
+  free(old);
+  if (!*changed)
+    return true;
+  char tmpFileName[MAX_FILENAME_LENGTH];
+  snprintf(tmpFileName, MAX_FILENAME_LENGTH, "%s.tmp%d", fileName, (int)getpid());
+  FILE* fp = fopen(tmpFileName, "wb");
+  if (!fp || fwrite(data, 1, size, fp) != size || fclose(fp) || rename(tmpFileName, fileName)) {
+    fprintf(stderr, "Unable to open file: %s for writing.\n", fileName);
+    return false;
+  }
+  return true;
+}
+
+static uint16_t littleEndian16(const uint8_t* bytes) {
+  return bytes[0] | (bytes[1] << 8);
+}
+
+static uint32_t littleEndian32(const uint8_t* bytes) {
+  return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+// Reads a 16-bit mono PCM .wav file in one go and walks its chunks, skipping
+// any it does not need (LIST, fact, ...). On success *samples points into
+// *file, which the caller frees. Prints why and returns false on error.
+bool loadWaveFile(const char* fileName, uint8_t** file, const int16_t** samples, uint32_t* sampleCount, uint32_t* sampleRate) {
+  uint32_t size;
+  uint8_t* data = readFile(fileName, &size);
+  if (!data) {
+    fprintf(stderr, "ERROR: unable to read %s.\n", fileName);
+    return false;
+  }
+  bool haveFormat = false;
+  const char* error = NULL;
+  if (size < RIFF_HEADER_SIZE || memcmp(data, CHUNKID, 4) || memcmp(data + 8, FORMAT, 4))
+    error = "not a RIFF WAVE file";
+  for (uint32_t offset = RIFF_HEADER_SIZE; !error && offset + CHUNK_HEADER_SIZE <= size;) {
+    const uint8_t* chunk = data + offset;
+    uint32_t chunkSize = littleEndian32(chunk + 4);
+    if (chunkSize > size - offset - CHUNK_HEADER_SIZE) {
+      error = "truncated chunk";
+    } else if (!memcmp(chunk, SUBCHUNK1ID, 4) && chunkSize >= FMT_CHUNK_SIZE) {
+      haveFormat = true;
+      *sampleRate = littleEndian32(chunk + 12);
+      if (littleEndian16(chunk + 8) != PCM_AUDIO_FORMAT)
+        error = "not PCM data";
+      else if (littleEndian16(chunk + 10) != 1)
+        error = "not mono, only monophonic data is handled";
+      else if (littleEndian16(chunk + 22) != SUPPORTED_WAVE_DATA_BIT_SIZE)
+        error = "not 16-bit data";
+    } else if (!memcmp(chunk, SUBCHUNK2ID, 4)) {
+      if (!haveFormat) {
+        error = "data before the fmt chunk";
+        break;
+      }
+      *file = data;
+      *samples = (const int16_t*)(chunk + CHUNK_HEADER_SIZE);
+      *sampleCount = chunkSize / sizeof(int16_t);
+      return true;
+    }
+    offset += CHUNK_HEADER_SIZE + chunkSize + (chunkSize & 1);  // Chunks are padded to even sizes.
+  }
+  fprintf(stderr, "ERROR: %s: %s.\n", fileName, error ? error : "no data chunk");
+  free(data);
+  return false;
+}
+
+// The CODEC runs at CODEC_SAMPLE_RATE. Slower sounds are resampled while they
+// play; faster ones would alias, so they are rejected.
+bool sampleRateOk(const char* fileName, uint32_t sampleRate) {
+  if (sampleRate == 0 || sampleRate > CODEC_SAMPLE_RATE) {
+    fprintf(stderr, "ERROR: %s: sample rate %d is not supported, the CODEC runs at %d.\n", fileName, sampleRate, CODEC_SAMPLE_RATE);
+    return false;
+  }
+  if (sampleRate != CODEC_SAMPLE_RATE)
+    fprintf(stderr, "INFO: %s: %d Hz, resampled to %d Hz while playing.\n", fileName, sampleRate, CODEC_SAMPLE_RATE);
+  return true;
+}
+
+// Header of a cache file, followed by the converted data.
+typedef struct {
+  uint32_t magic;        // CACHE_MAGIC.
+  uint32_t version;      // CACHE_VERSION, bumped when the output changes.
+  uint64_t inputSize;    // Size of the .wav file.
+  int64_t inputModified; // Modification time of the .wav file, in ns.
+  uint32_t format;       // SOUND_ASSET_FORMAT_*.
+  uint32_t sampleRate;
+  uint32_t sampleCount;
+  uint32_t length;       // Bytes of data.
+} cacheHeader_t;
+
+// One sound of a manifest.
+typedef struct {
+  char fileName[MAX_FILENAME_LENGTH];  // The .wav file.
+  char cacheName[MAX_FILENAME_LENGTH]; // Its converted data.
+  uint32_t format;                     // SOUND_ASSET_FORMAT_*.
+} soundEntry_t;
+
+// Fills in the cache header fields that identify the input. Returns false if
+// the .wav file is missing.
+bool describeInput(const soundEntry_t* entry, cacheHeader_t* header) {
+  struct stat st;
+  if (stat(entry->fileName, &st)) {
+    fprintf(stderr, "ERROR: unable to find file: %s\n", entry->fileName);
+    return false;
+  }
+  memset(header, 0, sizeof(*header));
+  header->magic = CACHE_MAGIC;
+  header->version = CACHE_VERSION;
+  header->inputSize = st.st_size;
+  header->inputModified = (int64_t)st.st_mtim.tv_sec * NANOSECONDS_PER_SECOND + st.st_mtim.tv_nsec;
+  header->format = entry->format;
+  return true;
+}
+
+// Returns true if the cache file of entry was made from the current .wav.
+bool cacheFresh(const soundEntry_t* entry) {
+  cacheHeader_t expected, cached;
+  if (!describeInput(entry, &expected))
+    return false;
+  FILE* fp = fopen(entry->cacheName, "rb");
+  if (!fp)
+    return false;
+  bool fresh = fread(&cached, sizeof(cached), 1, fp) == 1 && cached.magic == expected.magic &&
+               cached.version == expected.version && cached.inputSize == expected.inputSize &&
+               cached.inputModified == expected.inputModified && cached.format == expected.format;
+  fclose(fp);
+  return fresh;
+}
+
+// Converts one .wav file into its cache file. Returns false on error.
+bool convertSound(const soundEntry_t* entry) {
+  cacheHeader_t header;
+  uint8_t* file;
+  const int16_t* samples;
+  if (!describeInput(entry, &header) ||
+      !loadWaveFile(entry->fileName, &file, &samples, &header.sampleCount, &header.sampleRate))
+    return false;
+  if (!sampleRateOk(entry->fileName, header.sampleRate)) {
+    free(file);
+    return false;
+  }
+  uint8_t* data;
+  if (entry->format == SOUND_ASSET_FORMAT_ADPCM) {
+    header.length = adpcm_encodedSize(header.sampleCount);
+    data = malloc(header.length);
+    if (data) {
+      // The samples may not be aligned inside the file.
+      int16_t* aligned = malloc(header.sampleCount * sizeof(int16_t) + 1);
+      if (aligned) {
+        memcpy(aligned, samples, header.sampleCount * sizeof(int16_t));
+        adpcm_encode(aligned, header.sampleCount, data);
+      }
+      free(aligned);
+      if (!aligned) {
+        free(data);
+        data = NULL;
+      }
+    }
+  } else {
+    // Offset-binary, the same as the PCM arrays written without -a.
+    header.length = header.sampleCount * sizeof(uint16_t);
+    uint16_t* pcm = malloc(header.length + 1);
+    for (uint32_t i = 0; pcm && i < header.sampleCount; i++) {
+      int16_t sample;
+      memcpy(&sample, &samples[i], sizeof(sample));
+      pcm[i] = sample + INT16_MAX;
+    }
+    data = (uint8_t*)pcm;
+  }
+  free(file);
+  if (!data) {
+    fprintf(stderr, "ERROR: out of memory.\n");
+    return false;
+  }
+  uint32_t size = sizeof(header) + header.length;
+  uint8_t* cache = malloc(size);
+  bool changed, ok = cache != NULL;
+  if (ok) {
+    memcpy(cache, &header, sizeof(header));
+    memcpy(cache + sizeof(header), data, header.length);
+    ok = writeFileIfChanged(entry->cacheName, cache, size, &changed);
+  }
+  free(cache);
+  free(data);
+  return ok;
+}
+
+// Converts every sound whose cache is stale, spread over jobs worker
+// processes. Returns false if any conversion failed.
+bool convertSounds(const soundEntry_t* entries, uint32_t count, uint32_t jobs, uint32_t* converted) {
+  uint32_t* stale = malloc((count + 1) * sizeof(uint32_t));
+  if (!stale) {
+    fprintf(stderr, "ERROR: out of memory.\n");
+    return false;
+  }
+  uint32_t staleCount = 0;
+  for (uint32_t i = 0; i < count; i++)
+    if (!cacheFresh(&entries[i]))
+      stale[staleCount++] = i;
+  *converted = staleCount;
+  if (jobs > staleCount)
+    jobs = staleCount;
+  bool ok = true;
+  fflush(NULL);  // Don't let the workers flush the parent's buffers.
+  for (uint32_t worker = 0; worker < jobs; worker++) {
+    pid_t pid = fork();
+    if (pid == 0) {  // Worker: every jobs'th stale sound, starting at worker.
+      bool workerOk = true;
+      for (uint32_t i = worker; i < staleCount; i += jobs)
+        workerOk &= convertSound(&entries[stale[i]]);
+      fflush(NULL);
+      _exit(workerOk ? 0 : 1);
+    }
+    if (pid < 0) {  // Could not fork, do this worker's share here.
+      for (uint32_t i = worker; i < staleCount; i += jobs)
+        ok &= convertSound(&entries[stale[i]]);
+    }
+  }
+  int status;
+  while (wait(&status) > 0)
+    ok &= WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  free(stale);
+  return ok;
+}
+
+// Reads a cache file written by convertSound(). Returns the data, NULL on error.
+uint8_t* readCache(const soundEntry_t* entry, cacheHeader_t* header) {
+  uint32_t size;
+  uint8_t* cache = readFile(entry->cacheName, &size);
+  if (!cache || size < sizeof(*header)) {
+    fprintf(stderr, "ERROR: unable to read %s.\n", entry->cacheName);
+    free(cache);
+    return NULL;
+  }
+  memcpy(header, cache, sizeof(*header));
+  if (header->length != size - sizeof(*header)) {
+    fprintf(stderr, "ERROR: %s is corrupt.\n", entry->cacheName);
+    free(cache);
+    return NULL;
+  }
+  return cache;
+}
+
+// 64-bit FNV-1a hash, used to find sounds with identical data.
+uint64_t hashData(const uint8_t* data, uint32_t length) {
+  uint64_t hash = FNV_OFFSET_BASIS;
+  for (uint32_t i = 0; i < length; i++)
+    hash = (hash ^ data[i]) * FNV_PRIME;
+  return hash;
+}
+
+// Packs the converted sounds into one blob (see sound_assets.h) and writes a
+// header that numbers them in manifest order. Returns false on error.
+bool packSounds(const char* blobFileName, const char* idFileName, const soundEntry_t* entries, uint32_t count, const char* generatedBy) {
+  uint32_t indexSize = sizeof(sound_assets_header_t) + count * sizeof(sound_asset_t);
+  uint8_t** caches = calloc(count, sizeof(uint8_t*));
+  uint64_t* hashes = calloc(count, sizeof(uint64_t));
+  sound_asset_t* index = calloc(count, sizeof(sound_asset_t));
+  bool ok = caches && hashes && index;
+  uint32_t size = indexSize, shared = 0;
+  for (uint32_t i = 0; ok && i < count; i++) {
+    cacheHeader_t header;
+    caches[i] = readCache(&entries[i], &header);
+    if (!caches[i]) {
+      ok = false;
+      break;
+    }
+    const uint8_t* data = caches[i] + sizeof(header);
+    index[i].length = header.length;
+    index[i].sample_count = header.sampleCount;
+    index[i].sample_rate = header.sampleRate;
+    index[i].format = header.format;
+    hashes[i] = hashData(data, header.length);
+    for (uint32_t j = 0; j < i; j++) {  // Same data as an earlier sound?
+      if (hashes[j] == hashes[i] && index[j].length == index[i].length &&
+          !memcmp(caches[j] + sizeof(header), data, header.length)) {
+        index[i].offset = index[j].offset;
+        shared++;
+        break;
+      }
+    }
+    if (!index[i].offset) {
+      size = (size + SOUND_ASSETS_ALIGNMENT - 1) / SOUND_ASSETS_ALIGNMENT * SOUND_ASSETS_ALIGNMENT;
+      index[i].offset = size;
+      size += header.length;
+    }
+  }
+  uint8_t* blob = ok ? calloc(size, 1) : NULL;  // Padding stays zero.
+  if (blob) {
+    sound_assets_header_t blobHeader = {SOUND_ASSETS_MAGIC, count};
+    memcpy(blob, &blobHeader, sizeof(blobHeader));
+    memcpy(blob + sizeof(blobHeader), index, count * sizeof(sound_asset_t));
+    for (uint32_t i = 0; i < count; i++)
+      memcpy(blob + index[i].offset, caches[i] + sizeof(cacheHeader_t), index[i].length);
+  } else if (ok) {
+    fprintf(stderr, "ERROR: out of memory.\n");
+    ok = false;
+  }
+
+  char ids[MAX_IDS_LENGTH];
+  int length = snprintf(ids, MAX_IDS_LENGTH, "// This file was generated by executing this statement: wav2c %s\n"
+                        "#ifndef SOUND_ASSET_IDS_H_\n#define SOUND_ASSET_IDS_H_\n\n", generatedBy);
+  for (uint32_t i = 0; i < count && length < MAX_IDS_LENGTH; i++) {
+    char idName[MAX_FILENAME_LENGTH];
+    makeAssetId(entries[i].fileName, idName);
+    length += snprintf(ids + length, MAX_IDS_LENGTH - length, "#define SOUND_ASSET_%s %d\n", idName, i);
+  }
+  if (length < MAX_IDS_LENGTH)
+    length += snprintf(ids + length, MAX_IDS_LENGTH - length, "#define SOUND_ASSET_COUNT %d\n\n#endif /* SOUND_ASSET_IDS_H_ */\n", count);
+  if (ok && length >= MAX_IDS_LENGTH) {
+    fprintf(stderr, "ERROR: too many sounds for %s.\n", idFileName);
+    ok = false;
+  }
+  bool blobChanged = false, idsChanged = false;
+  ok = ok && writeFileIfChanged(blobFileName, blob, size, &blobChanged) &&
+       writeFileIfChanged(idFileName, ids, length, &idsChanged);
+  if (ok)
+    fprintf(stderr, "%s %d sounds into %s (%d bytes, %d shared)\n", blobChanged ? "packed" : "unchanged,", count, blobFileName, size, shared);
+  for (uint32_t i = 0; caches && i < count; i++)
+    free(caches[i]);
+  free(caches);
+  free(hashes);
+  free(index);
+  free(blob);
+  return ok;
+}
+
+// Joins directory and fileName into path, unless fileName is absolute.
+void joinPath(const char* directory, const char* fileName, char* path) {
+  if (fileName[0] == '/' || directory[0] == '\0')
+    snprintf(path, MAX_FILENAME_LENGTH, "%s", fileName);
+  else
+    snprintf(path, MAX_FILENAME_LENGTH, "%s/%s", directory, fileName);
+}
+
+// Names the cache file of an entry after the .wav file and its format.
+void nameCache(const char* cacheDirectory, soundEntry_t* entry) {
+  char idName[MAX_FILENAME_LENGTH];
+  makeAssetId(entry->fileName, idName);
+  snprintf(entry->cacheName, MAX_FILENAME_LENGTH, "%s/%s.%s", cacheDirectory, idName,
+           entry->format == SOUND_ASSET_FORMAT_ADPCM ? ADPCM_FORMAT_NAME : PCM_FORMAT_NAME);
+}
+
+// Reads a manifest into entries and the blob and id file names. Returns the
+// number of sounds, -1 on error.
+int readManifest(const char* manifestFileName, soundEntry_t* entries, char* blobFileName, char* idFileName) {
+  FILE* fp = fopen(manifestFileName, "r");
+  if (!fp) {
+    fprintf(stderr, "ERROR: unable to read %s.\n", manifestFileName);
+    return -1;
+  }
+  char directory[MAX_FILENAME_LENGTH];
+  snprintf(directory, MAX_FILENAME_LENGTH, "%s", manifestFileName);
+  char* slash = strrchr(directory, '/');
+  if (slash)
+    *slash = '\0';
+  else
+    directory[0] = '\0';
+  blobFileName[0] = idFileName[0] = '\0';
+  int count = 0;
+  char line[MAX_LINE_LENGTH];
+  for (uint32_t lineNumber = 1; fgets(line, MAX_LINE_LENGTH, fp); lineNumber++) {
+    char* comment = strchr(line, '#');
+    if (comment)
+      *comment = '\0';
+    char directive[MAX_LINE_LENGTH], fileName[MAX_LINE_LENGTH], format[MAX_LINE_LENGTH];
+    int fields = sscanf(line, "%s %s %s", directive, fileName, format);
+    if (fields <= 0)
+      continue;  // Blank line.
+    if (fields >= 2 && !strcmp(directive, "blob")) {
+      joinPath(directory, fileName, blobFileName);
+    } else if (fields >= 2 && !strcmp(directive, "ids")) {
+      joinPath(directory, fileName, idFileName);
+    } else if (fields >= 2 && !strcmp(directive, "sound") && count < MAX_SOUNDS &&
+               (fields == 2 || !strcmp(format, ADPCM_FORMAT_NAME) || !strcmp(format, PCM_FORMAT_NAME))) {
+      joinPath(directory, fileName, entries[count].fileName);
+      entries[count].format = (fields == 3 && !strcmp(format, PCM_FORMAT_NAME)) ? SOUND_ASSET_FORMAT_PCM16 : SOUND_ASSET_FORMAT_ADPCM;
+      char idName[MAX_FILENAME_LENGTH], otherIdName[MAX_FILENAME_LENGTH];
+      makeAssetId(entries[count].fileName, idName);
+      for (int i=0; i<count; i++) {  // Every sound needs its own id.
+        makeAssetId(entries[i].fileName, otherIdName);
+        if (!strcmp(idName, otherIdName)) {
+          fprintf(stderr, "ERROR: %s:%d: SOUND_ASSET_%s is already used.\n", manifestFileName, lineNumber, idName);
+          fclose(fp);
+          return -1;
+        }
+      }
+      count++;
+    } else {
+      fprintf(stderr, "ERROR: %s:%d: cannot understand \"%s\".\n", manifestFileName, lineNumber, directive);
+      count = -1;
+      break;
+    }
+  }
+  fclose(fp);
+  if (count >= 0 && (!blobFileName[0] || !idFileName[0])) {
+    fprintf(stderr, "ERROR: %s needs a blob and an ids line.\n", manifestFileName);
+    count = -1;
+  }
+  return count;
+}
+
+// Converts and packs the sounds. Returns the exit status.
+int buildSounds(const char* blobFileName, const char* idFileName, soundEntry_t* entries, uint32_t count, const char* cacheDirectory, uint32_t jobs, const char* generatedBy) {
+  char defaultCache[MAX_FILENAME_LENGTH];
+  if (!cacheDirectory) {  // Next to the blob.
+    snprintf(defaultCache, MAX_FILENAME_LENGTH, "%s%s", blobFileName, CACHE_SUFFIX);
+    cacheDirectory = defaultCache;
+  }
+  if (mkdir(cacheDirectory, 0777) && errno != EEXIST) {
+    fprintf(stderr, "ERROR: unable to create %s.\n", cacheDirectory);
+    return -1;
+  }
+  for (uint32_t i = 0; i < count; i++)
+    nameCache(cacheDirectory, &entries[i]);
+  uint32_t converted;
+  if (!convertSounds(entries, count, jobs, &converted))
+    return -1;
+  fprintf(stderr, "converted %d of %d sounds with %d jobs\n", converted, count, jobs);
+  return packSounds(blobFileName, idFileName, entries, count, generatedBy) ? 0 : -1;
+}
+
+// One job per processor.
+uint32_t defaultJobs() {
+  long processors = sysconf(_SC_NPROCESSORS_ONLN);
+  return processors > 0 ? processors : 1;
+}
+
+// wav2c -m sounds.manifest [-j jobs] [-C cacheDirectory]
+int buildFromManifest(int argc, char* argv[]) {
+  const char* manifestFileName = argv[2];
+  const char* cacheDirectory = NULL;
+  uint32_t jobs = defaultJobs();
+  for (int i=3; i<argc; i+=2) {
+    if (i + 1 < argc && !strcmp(argv[i], JOBS_OPTION) && atoi(argv[i + 1]) > 0) {
+      jobs = atoi(argv[i + 1]);
+    } else if (i + 1 < argc && !strcmp(argv[i], CACHE_OPTION)) {
+      cacheDirectory = argv[i + 1];
+    } else {
+      fprintf(stderr, "Usage: wav2c %s sounds.manifest [%s jobs] [%s cacheDirectory]\n", MANIFEST_OPTION, JOBS_OPTION, CACHE_OPTION);
+      return -1;
+    }
+  }
+  static soundEntry_t entries[MAX_SOUNDS];
+  char blobFileName[MAX_FILENAME_LENGTH], idFileName[MAX_FILENAME_LENGTH];
+  int count = readManifest(manifestFileName, entries, blobFileName, idFileName);
+  if (count < 0)
+    return -1;
+  char generatedBy[MAX_FILENAME_LENGTH + 4];
+  snprintf(generatedBy, sizeof(generatedBy), "%s %s", MANIFEST_OPTION, manifestFileName);
+  return buildSounds(blobFileName, idFileName, entries, count, cacheDirectory, jobs, generatedBy);
+}
+
+int main(int argc, char* argv[]) {
+  // Pack the sounds listed in a manifest into one sound blob.
+  if (argc >= 3 && !strcmp(argv[1], MANIFEST_OPTION)) {
+    return buildFromManifest(argc, argv);
+  }
+  // Pack several files into one IMA-ADPCM sound blob.
+  if (argc >= 5 && !strcmp(argv[1], BLOB_OPTION)) {
+    uint32_t count = argc - 4;
+    soundEntry_t* entries = calloc(count, sizeof(soundEntry_t));
+    if (!entries) {
+      fprintf(stderr, "ERROR: out of memory.\n");
+      exit(-1);
+    }
+    char generatedBy[MAX_IDS_LENGTH];
+    int length = snprintf(generatedBy, MAX_IDS_LENGTH, "%s %s %s", BLOB_OPTION, argv[2], argv[3]);
+    for (uint32_t i=0; i<count; i++) {
+      snprintf(entries[i].fileName, MAX_FILENAME_LENGTH, "%s", argv[4 + i]);
+      entries[i].format = SOUND_ASSET_FORMAT_ADPCM;
+      if (length < MAX_IDS_LENGTH)
+        length += snprintf(generatedBy + length, MAX_IDS_LENGTH - length, " %s", argv[4 + i]);
+    }
+    int status = buildSounds(argv[2], argv[3], entries, count, NULL, defaultJobs(), generatedBy);
+    free(entries);
+    return status;
+  }
+  // Print a helpful error message and exit if a file-name was not provided on the command line.
+  bool adpcm = (argc == 3 && !strcmp(argv[1], ADPCM_OPTION));
+  if (argc != 2 && !adpcm) {
+    fprintf(stderr, "Usage: wav2c [%s] filename.wav\n", ADPCM_OPTION);
+    fprintf(stderr, "       wav2c %s blob.bin ids.h filename.wav...\n", BLOB_OPTION);
+    fprintf(stderr, "       wav2c %s sounds.manifest [%s jobs] [%s cacheDirectory]\n", MANIFEST_OPTION, JOBS_OPTION, CACHE_OPTION);
+    exit(-1);
+  }
+  char inputFileName[MAX_FILENAME_LENGTH];         // Create a working buffer.
+  strncpy(inputFileName, argv[argc-1], MAX_FILENAME_LENGTH);  // Copy the filename into the working buffer.
+  waveFileHeader_t header;
+  FILE* inputFileFp = openWaveFile(inputFileName, &header);
   printWaveFileHeader(stderr, &header);
   // Everything looks good. Go ahead and generate the .h and .c files. Exit with an error if either file already exists.
   // First, open the .h file and output the necessary declarations. Then, close the .h file.
@@ -204,28 +783,50 @@ int main(int argc, char* argv[]) {
   for (i=0; arrayName[i] != '\0'; i++) {
     arrayNameUpperCase[i] = toupper(arrayName[i]);
   }
-  arrayNameUpperCase[i+1] = '\0';  // Make sure to terminate the string.
+  arrayNameUpperCase[i] = '\0';  // Make sure to terminate the string.
  
+  uint32_t sampleCount = header.subchunk2Size/2;  // Wave file is counted by bytes, output file is counted in 16-bit samples.
   // .h file just needs a comment and an extern statement.
-  fprintf(hFileFp, "// This file was generated by executing this statement: wav2c %s\n", inputFileName);
-  fprintf(hFileFp, "%s uint16_t %s[];\n", EXTERN_STATEMENT, arrayName);
-  fprintf(hFileFp, "#define %s_SAMPLE_RATE %d\n", arrayNameUpperCase, header.sampleRate*10);
+  fprintf(hFileFp, "// This file was generated by executing this statement: wav2c %s%s\n", adpcm ? ADPCM_OPTION " " : "", inputFileName);
+  fprintf(hFileFp, "%s %s %s[];\n", EXTERN_STATEMENT, adpcm ? ADPCM_C_DATA_TYPE : C_DATA_TYPE, arrayName);
+  fprintf(hFileFp, "#define %s_SAMPLE_RATE %d\n", arrayNameUpperCase, header.sampleRate);
   fprintf(hFileFp, "#define %s_BITS_PER_SAMPLE %d\n", arrayNameUpperCase, header.bitsPerSample);
-  fprintf(hFileFp, "#define %s_NUMBER_OF_SAMPLES %d\n", arrayNameUpperCase, header.subchunk2Size/2);
+  fprintf(hFileFp, "#define %s_NUMBER_OF_SAMPLES %d\n", arrayNameUpperCase, sampleCount);
+  if (adpcm)
+    fprintf(hFileFp, "#define %s_ADPCM_BLOCK_SIZE %d\n", arrayNameUpperCase, ADPCM_BLOCK_SIZE);
   fclose(hFileFp);
-  // .c file will contain the data in array form as follows.
-  uint32_t arraySize = header.subchunk2Size/2;  // Wave file is counted by bytes, output file is counted in 16-bit words.
   // Write some helpful comments to the .c file.
-  fprintf(cFileFp, "// This file was generated by executing this statement: wav2c %s\n", inputFileName);
+  fprintf(cFileFp, "// This file was generated by executing this statement: wav2c %s%s\n", adpcm ? ADPCM_OPTION " " : "", inputFileName);
   fprintf(cFileFp, "\n#include <stdint.h>\n\n");
-  fprintf(cFileFp, "%s %s[%d] = {\n", C_DATA_TYPE, arrayName, arraySize);
+  if (adpcm) {
+    // Read every sample, then write the encoded blocks one byte per line.
+    int16_t* samples = readWaveSamples(inputFileFp, inputFileName, sampleCount);
+    uint32_t encodedSize = adpcm_encodedSize(sampleCount);
+    uint8_t* encoded = malloc(encodedSize);
+    if (!encoded) {
+      fprintf(stderr, "ERROR: out of memory.\n");
+      exit(-1);
+    }
+    adpcm_encode(samples, sampleCount, encoded);
+    fprintf(cFileFp, "%s %s[%d] = {\n", ADPCM_C_DATA_TYPE, arrayName, encodedSize);
+    for (i=0; i<encodedSize; i++)
+      fprintf(cFileFp, i != encodedSize-1 ? "%d,\n" : "%d", encoded[i]);
+    fprintf(cFileFp, "\n};\n");  // Close the array.
+    free(samples);
+    free(encoded);
+    fclose(cFileFp);
+    fclose(inputFileFp);
+    return 0;
+  }
+  // .c file will contain the data in array form as follows.
+  fprintf(cFileFp, "%s %s[%d] = {\n", C_DATA_TYPE, arrayName, sampleCount);
   // File pointer to the input file should be pointing at the first value after the header is read, so just start from there.
-  for (i=0; i<header.subchunk2Size/2; i++) {
+  for (i=0; i<sampleCount; i++) {
     int16_t data;  // Program only handles 16-bit PCM data for now. PCM data is signed.
     fread(&data, header.blockAlign, 1, inputFileFp);  // Read 2 bytes into a signed 16-bit variable.
     uint16_t unsignedData = data + INT16_MAX;         // Offset to unsigned for the sound CODEC.
     fprintf(cFileFp, "%d", unsignedData);             // Write the unsiged data.
-    if (i != (header.subchunk2Size/2)-1)              // Don't place the last comma.
+    if (i != sampleCount-1)                           // Don't place the last comma.
       fprintf(cFileFp, ",\n");                        // Delimited data.
   }
   fprintf(cFileFp, "\n};\n");  // Close the array.
@@ -0,0 +1,86 @@
+#include <stddef.h>
+
+#include "swtimer.h"
+
+// Current time of each clock. Only swtimer_advance() writes it, everything
+// else runs in the main loop.
+static volatile uint32_t swtimer_now_us[swtimer_clockCount_e];
+
+// Every active timer, on any clock.
+static swtimer_t *swtimer_active = NULL;
+
+// True if the clock has reached deadline_us. Differences are signed so the
+// clocks can wrap.
+static bool swtimer_expired(uint32_t now_us, uint32_t deadline_us) {
+  return (int32_t)(now_us - deadline_us) >= 0;
+}
+
+// Takes timer off the active list.
+static void swtimer_unlink(swtimer_t *timer) {
+  for (swtimer_t **link = &swtimer_active; *link; link = &(*link)->next) {
+    if (*link == timer) {
+      *link = timer->next;
+      break;
+    }
+  }
+  timer->active = false;
+}
+
+// Starts timer, or restarts it if it is running, to expire delay_us from now
+// on clock and every period_us after that. A period_us of 0 makes it a
+// one-shot.
+void swtimer_start(swtimer_t *timer, swtimer_clock_t clock, uint32_t delay_us,
+                   uint32_t period_us, swtimer_callback_t callback,
+                   void *context) {
+  if (timer->active)
+    swtimer_unlink(timer);
+  timer->callback = callback;
+  timer->context = context;
+  timer->clock = clock;
+  timer->deadline_us = swtimer_now_us[clock] + delay_us;
+  timer->period_us = period_us;
+  timer->active = true;
+  timer->next = swtimer_active;
+  swtimer_active = timer;
+}
+
+// Stops timer. Stopping a timer that is not running does nothing.
+void swtimer_stop(swtimer_t *timer) {
+  if (timer->active)
+    swtimer_unlink(timer);
+}
+
+// Returns true if timer is running.
+bool swtimer_isActive(const swtimer_t *timer) { return timer->active; }
+
+// Moves clock forward. Safe to call from an interrupt handler.
+void swtimer_advance(swtimer_clock_t clock, uint32_t elapsed_us) {
+  swtimer_now_us[clock] += elapsed_us;
+}
+
+// Returns the first timer on clock that has expired, NULL if none has.
+static swtimer_t *swtimer_findExpired(swtimer_clock_t clock, uint32_t now_us) {
+  for (swtimer_t *timer = swtimer_active; timer; timer = timer->next)
+    if (timer->clock == clock && swtimer_expired(now_us, timer->deadline_us))
+      return timer;
+  return NULL;
+}
+
+// Runs the callbacks of the timers on clock that have expired. A periodic
+// timer that fell more than a period behind runs once and skips the periods
+// it missed. Callbacks may start and stop timers.
+void swtimer_runExpired(swtimer_clock_t clock) {
+  uint32_t now_us = swtimer_now_us[clock];
+  swtimer_t *timer;
+  // Search again after every callback, which may have changed the list.
+  while ((timer = swtimer_findExpired(clock, now_us))) {
+    if (timer->period_us == 0) {
+      swtimer_unlink(timer);
+    } else {
+      timer->deadline_us += timer->period_us;
+      if (swtimer_expired(now_us, timer->deadline_us))
+        timer->deadline_us = now_us + timer->period_us;
+    }
+    timer->callback(timer->context);
+  }
+}
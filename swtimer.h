@@ -0,0 +1,58 @@
+#ifndef SWTIMER_H_
+#define SWTIMER_H_
+
+// Software timers: any number of one-shot and periodic timers on one clock.
+// A clock is a count of microseconds moved forward by swtimer_advance(),
+// which is cheap enough for an interrupt handler. Callbacks never run there;
+// they are deferred until swtimer_runExpired() is called from the main loop.
+//
+// There are two clocks. swtimer_game_e is game time: gameControl_tick()
+// advances it by each tick's elapsed time and runs its callbacks, so game
+// timers behave the same however the ticks are scheduled. swtimer_real_e is
+// wall-clock time, advanced by a periodic hardware timer interrupt.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+  swtimer_game_e, // Game time.
+  swtimer_real_e, // Wall-clock time.
+  swtimer_clockCount_e
+} swtimer_clock_t;
+
+// Called from swtimer_runExpired() with the context given to swtimer_start().
+typedef void (*swtimer_callback_t)(void *context);
+
+// One timer. The owner keeps it, usually in a static; the fields are private.
+typedef struct swtimer {
+  struct swtimer *next;        // Next active timer.
+  swtimer_callback_t callback; // Run when the timer expires.
+  void *context;               // Passed to callback.
+  uint32_t deadline_us;        // Clock time the timer expires at.
+  uint32_t period_us;          // Time between expiries, 0 for a one-shot.
+  uint8_t clock;               // swtimer_clock_t the timer runs on.
+  bool active;                 // True until a one-shot expires or is stopped.
+} swtimer_t;
+
+// Starts timer, or restarts it if it is running, to expire delay_us from now
+// on clock and every period_us after that. A period_us of 0 makes it a
+// one-shot.
+void swtimer_start(swtimer_t *timer, swtimer_clock_t clock, uint32_t delay_us,
+                   uint32_t period_us, swtimer_callback_t callback,
+                   void *context);
+
+// Stops timer. Stopping a timer that is not running does nothing.
+void swtimer_stop(swtimer_t *timer);
+
+// Returns true if timer is running.
+bool swtimer_isActive(const swtimer_t *timer);
+
+// Moves clock forward. Safe to call from an interrupt handler.
+void swtimer_advance(swtimer_clock_t clock, uint32_t elapsed_us);
+
+// Runs the callbacks of the timers on clock that have expired. A periodic
+// timer that fell more than a period behind runs once and skips the periods
+// it missed. Callbacks may start and stop timers.
+void swtimer_runExpired(swtimer_clock_t clock);
+
+#endif /* SWTIMER_H_ */
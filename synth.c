@@ -0,0 +1,147 @@
+#include <stddef.h>
+
+#include "synth.h"
+
+#define MS_PER_SECOND 1000
+#define FULL_SCALE INT16_MAX
+#define VOLUME_SHIFT 8       // volume is out of 1 << 8.
+#define NOISE_SEED 0x0001    // Any non-zero value.
+#define NOISE_TAPS 0xB400    // Maximal length 16-bit Galois LFSR.
+#define PHASE_HALF 0x80000000u
+
+// Samples in ms milliseconds.
+static uint32_t msToSamples(uint32_t ms) {
+  return ms * (SYNTH_SAMPLE_RATE / MS_PER_SECOND);
+}
+
+// Phase increment per sample that plays hz.
+static uint32_t hzToIncrement(uint16_t hz) {
+  return (uint32_t)(((uint64_t)hz << 32) / SYNTH_SAMPLE_RATE);
+}
+
+// Set up the oscillator for the note synth->note points at.
+static void startNote(synth_t *synth) {
+  const synth_note_t *note = synth->note;
+  synth->sample = 0;
+  synth->length = msToSamples(note->duration_ms);
+  synth->increment = hzToIncrement(note->start_hz);
+  int64_t change =
+      (int64_t)hzToIncrement(note->end_hz) - (int64_t)synth->increment;
+  synth->slide = synth->length ? (int32_t)(change / synth->length) : 0;
+}
+
+// Number of samples a script plays for.
+uint32_t synth_length(const synth_script_t *script) {
+  uint32_t length = 0;
+  for (uint16_t i = 0; i < script->count; i++)
+    length += msToSamples(script->notes[i].duration_ms);
+  return length;
+}
+
+// Start playing script from the beginning.
+void synth_start(synth_t *synth, const synth_script_t *script) {
+  synth->note = script->notes;
+  synth->end = script->notes + script->count;
+  synth->phase = 0;
+  synth->noise = NOISE_SEED;
+  if (synth->note != synth->end)
+    startNote(synth);
+}
+
+// Envelope level, 0 to FULL_SCALE, sample samples into the current note.
+static int32_t envelope(const synth_t *synth, uint32_t sample) {
+  const synth_note_t *note = synth->note;
+  int32_t peak = (FULL_SCALE * note->volume) >> VOLUME_SHIFT;
+  int32_t level = peak;
+  uint32_t attack = msToSamples(note->attack_ms);
+  uint32_t release = msToSamples(note->release_ms);
+  if (sample < attack) {
+    int32_t rising = (int32_t)((int64_t)peak * sample / attack);
+    level = rising < level ? rising : level;
+  }
+  if (sample + release > synth->length) {
+    int32_t falling =
+        (int32_t)((int64_t)peak * (synth->length - sample) / release);
+    level = falling < level ? falling : level;
+  }
+  return level;
+}
+
+// The sample of the current note where the envelope next changes slope: the
+// end of the attack, the start of the release or the end of the note.
+static uint32_t nextCorner(const synth_t *synth) {
+  uint32_t attack = msToSamples(synth->note->attack_ms);
+  uint32_t release = msToSamples(synth->note->release_ms);
+  uint32_t releaseStart = synth->length > release ? synth->length - release : 0;
+  uint32_t corner = synth->length;
+  if (synth->sample < attack && attack < corner)
+    corner = attack;
+  if (synth->sample < releaseStart && releaseStart < corner)
+    corner = releaseStart;
+  return corner;
+}
+
+// Render the next count samples of the current note into out, count must not
+// run past the next corner of the envelope.
+static void renderNote(synth_t *synth, uint16_t *out, uint32_t count) {
+  const synth_note_t *note = synth->note;
+  uint32_t phase = synth->phase;
+  uint32_t increment = synth->increment;
+  uint16_t noise = synth->noise;
+  // The envelope is a straight line up to the next corner, so it is enough to
+  // work it out at both ends of the run and step in between.
+  int32_t level = envelope(synth, synth->sample);
+  int32_t levelEnd = envelope(synth, synth->sample + count);
+  int32_t levelStep = count ? (levelEnd - level) * 256 / (int32_t)count : 0;
+  int32_t scaled = level * 256; // Level with 8 fraction bits.
+  for (uint32_t i = 0; i < count; i++) {
+    int32_t wave = 0; // -FULL_SCALE to FULL_SCALE.
+    switch (note->waveform) {
+    case synth_square_e:
+      wave = (phase < PHASE_HALF) ? FULL_SCALE : -FULL_SCALE;
+      break;
+    case synth_triangle_e: {
+      int32_t ramp = phase >> 16; // 0 to 65535 over a cycle.
+      wave = (ramp < 0x8000 ? ramp * 2 : (0xFFFF - ramp) * 2) - FULL_SCALE;
+      break;
+    }
+    case synth_noise_e:
+      wave = (noise & 1) ? FULL_SCALE : -FULL_SCALE;
+      break;
+    default: // synth_silence_e
+      break;
+    }
+    uint32_t next = phase + increment;
+    if (next < phase) // Wrapped, clock the noise register once per cycle.
+      noise = (noise >> 1) ^ ((noise & 1) ? NOISE_TAPS : 0);
+    phase = next;
+    increment += synth->slide;
+    out[i] = (uint16_t)(((wave * (scaled >> 8)) >> 15) + INT16_MAX);
+    scaled += levelStep;
+  }
+  synth->phase = phase;
+  synth->increment = increment;
+  synth->noise = noise;
+  synth->sample += count;
+}
+
+// Render the next count samples.  They are written offset-binary
+// (sample + INT16_MAX), the same as the PCM sound arrays; past the end of the
+// script the output is silence.
+void synth_render(synth_t *synth, uint16_t *out, uint32_t count) {
+  while (count) {
+    if (synth->note == synth->end) { // Script is over.
+      for (uint32_t i = 0; i < count; i++)
+        out[i] = INT16_MAX;
+      return;
+    }
+    uint32_t length = nextCorner(synth) - synth->sample;
+    if (length > count)
+      length = count;
+    renderNote(synth, out, length);
+    out += length;
+    count -= length;
+    if (synth->sample == synth->length && ++synth->note != synth->end)
+      startNote(synth);
+  }
+}
@@ -0,0 +1,57 @@
+#ifndef SYNTH
+#define SYNTH
+
+#include <stdint.h>
+
+// Chiptune synthesizer for sound effects.  An effect is a script of notes
+// played one after another at SYNTH_SAMPLE_RATE; each note is one oscillator
+// whose pitch slides linearly from start_hz to end_hz, shaped by a linear
+// attack and release.  A note takes 10 bytes against 96 kB per second of PCM.
+#define SYNTH_SAMPLE_RATE 48000
+
+typedef enum {
+  synth_silence_e, // No output, for rests and silence.
+  synth_square_e,  // 50% duty square wave.
+  synth_triangle_e,
+  synth_noise_e // Pseudo-random bits, clocked at the note's pitch.
+} synth_waveform_t;
+
+typedef struct {
+  uint8_t waveform;     // A synth_waveform_t.
+  uint8_t volume;       // Peak level, 255 is full scale.
+  uint16_t duration_ms; // Length of the note, including the release.
+  uint16_t start_hz;    // Pitch at the start of the note.
+  uint16_t end_hz;      // Pitch at the end of the note.
+  uint8_t attack_ms;    // Time to ramp up to volume.
+  uint8_t release_ms;   // Time to ramp down to silence at the end.
+} synth_note_t;
+
+typedef struct {
+  const synth_note_t *notes;
+  uint16_t count;
+} synth_script_t;
+
+// Playback state for one script.
+typedef struct {
+  const synth_note_t *note; // Note being played.
+  const synth_note_t *end;  // One past the last note.
+  uint32_t sample;          // Samples of the note already played.
+  uint32_t length;          // Samples in the note.
+  uint32_t phase;           // Oscillator phase, a full cycle is 2^32.
+  uint32_t increment;       // Phase added per sample.
+  int32_t slide;            // Change of increment per sample.
+  uint16_t noise;           // Noise shift register.
+} synth_t;
+
+// Number of samples a script plays for.
+uint32_t synth_length(const synth_script_t *script);
+
+// Start playing script from the beginning.
+void synth_start(synth_t *synth, const synth_script_t *script);
+
+// Render the next count samples.  They are written offset-binary
+// (sample + INT16_MAX), the same as the PCM sound arrays; past the end of the
+// script the output is silence.
+void synth_render(synth_t *synth, uint16_t *out, uint32_t count);
+
+#endif /* SYNTH */
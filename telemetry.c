@@ -0,0 +1,124 @@
+#include <stdbool.h>
+
+#include "gameControl.h"
+#include "idle.h"
+#include "plane.h"
+#include "powerup.h"
+#include "quality.h"
+#include "rate.h"
+#include "sound.h"
+#include "telemetry.h"
+#include "tick.h"
+
+#define TELEMETRY_US_PER_MS 1000
+#define TELEMETRY_VARINT_MORE 0x80 // More bytes of the varint follow.
+#define TELEMETRY_VARINT_BITS 7
+#define TELEMETRY_COBS_MAX_RUN 0xFF
+
+static uint64_t telemetry_startUs;
+static uint64_t telemetry_nextUs; // When the next frame is due.
+static uint32_t telemetry_sequence;
+static uint32_t telemetry_maxBusyUs; // Since the last frame.
+
+// Starts the clock and the sequence over.
+void telemetry_init() {
+  telemetry_startUs = idle_hal_nowUs();
+  telemetry_nextUs = telemetry_startUs + CONFIG_TELEMETRY_PERIOD_US;
+  telemetry_sequence = 0;
+  telemetry_maxBusyUs = 0;
+}
+
+// Appends value as an unsigned LEB128 varint and returns the new length.
+static uint32_t telemetry_putVarint(uint8_t *out, uint32_t length,
+                                    uint32_t value) {
+  while (value >= TELEMETRY_VARINT_MORE) {
+    out[length++] =
+        (value & (TELEMETRY_VARINT_MORE - 1)) | TELEMETRY_VARINT_MORE;
+    value >>= TELEMETRY_VARINT_BITS;
+  }
+  out[length++] = value;
+  return length;
+}
+
+// COBS-encodes length bytes of in between two zeros and returns the bytes
+// written to out. Each run of non-zero bytes is preceded by its length plus
+// one, which stands in for the zero that ended it.
+static uint32_t telemetry_cobsFrame(const uint8_t *in, uint32_t length,
+                                    uint8_t *out) {
+  uint32_t written = 0;
+  out[written++] = 0;
+  uint32_t code = written++; // Where the length of this run goes.
+  for (uint32_t i = 0; i < length; i++) {
+    if (in[i] == 0) {
+      out[code] = written - code;
+      code = written++;
+      continue;
+    }
+    out[written++] = in[i];
+    if (written - code == TELEMETRY_COBS_MAX_RUN) {
+      out[code] = written - code;
+      code = written++;
+    }
+  }
+  out[code] = written - code;
+  out[written++] = 0;
+  return written;
+}
+
+// Gathers the fields and sends them as one frame.
+static void telemetry_send(uint64_t now_us) {
+  idle_stats_t idle = idle_getStats();
+  tick_stats_t tick = tick_getStats();
+  gameControl_stats_t game = gameControl_getStats();
+
+  uint32_t fields[telemetry_fieldCount_e];
+  fields[telemetry_sequence_e] = telemetry_sequence++;
+  fields[telemetry_time_ms_e] =
+      (now_us - telemetry_startUs) / TELEMETRY_US_PER_MS;
+  fields[telemetry_period_us_e] = rate_getPeriods().game_period_us;
+  fields[telemetry_ticks_e] = tick.handled;
+  fields[telemetry_dropped_e] = tick.dropped;
+  fields[telemetry_busy_us_e] = idle.last_busy_us;
+  fields[telemetry_max_busy_us_e] = telemetry_maxBusyUs;
+  fields[telemetry_quality_level_e] = quality_getStats().level;
+  fields[telemetry_enemy_flying_e] = game.flying[MISSILE_TYPE_ENEMY];
+  fields[telemetry_enemy_exploding_e] = game.exploding[MISSILE_TYPE_ENEMY];
+  fields[telemetry_player_flying_e] = game.flying[MISSILE_TYPE_PLAYER];
+  fields[telemetry_player_exploding_e] = game.exploding[MISSILE_TYPE_PLAYER];
+  fields[telemetry_plane_flying_e] = game.flying[MISSILE_TYPE_PLANE];
+  fields[telemetry_plane_exploding_e] = game.exploding[MISSILE_TYPE_PLANE];
+  fields[telemetry_shots_e] = game.shots;
+  fields[telemetry_impacts_e] = game.impacts;
+  fields[telemetry_ufo_flying_e] = plane_isFlying();
+  fields[telemetry_powerup_moving_e] = powerup_isMoving();
+  fields[telemetry_audio_queued_e] = sound_getQueuedSamples();
+
+  uint8_t payload[TELEMETRY_PAYLOAD_MAX];
+  uint32_t length = 0;
+  payload[length++] = TELEMETRY_VERSION;
+  for (uint32_t i = 0; i < telemetry_fieldCount_e; i++)
+    length = telemetry_putVarint(payload, length, fields[i]);
+  payload[length] = telemetry_crc8(payload, length);
+  length++;
+
+  uint8_t frame[TELEMETRY_FRAME_MAX];
+  telemetry_hal_write(frame, telemetry_cobsFrame(payload, length, frame));
+  telemetry_maxBusyUs = 0;
+}
+
+// Call once per game tick, after it ran. Sends a frame when one is due.
+void telemetry_tick() {
+#if CONFIG_TELEMETRY_ENABLED
+  uint32_t busy_us = idle_getStats().last_busy_us;
+  if (busy_us > telemetry_maxBusyUs)
+    telemetry_maxBusyUs = busy_us;
+  uint64_t now_us = idle_hal_nowUs();
+  if (now_us < telemetry_nextUs)
+    return;
+  // After a long stall, carry on from now rather than sending a burst.
+  telemetry_nextUs += CONFIG_TELEMETRY_PERIOD_US;
+  if (telemetry_nextUs <= now_us)
+    telemetry_nextUs = now_us + CONFIG_TELEMETRY_PERIOD_US;
+  telemetry_send(now_us);
+#endif
+}
@@ -0,0 +1,84 @@
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+// A compact binary telemetry stream, sent over the UART alongside the console
+// text. Every CONFIG_TELEMETRY_PERIOD_US the main loop sends one frame with a
+// snapshot of the fields below; host/telemetrydecode turns a capture of the
+// UART into CSV.
+//
+// A frame is the version byte, each field as an unsigned LEB128 varint, in
+// the order of TELEMETRY_FIELDS, then a CRC-8 of everything before it. That
+// payload is COBS-encoded, so it holds no zero bytes, and a zero is sent
+// before and after it. A decoder splits the stream on zeros; the console
+// text between frames fails the CRC and is skipped.
+//
+// A frame is usually under 30 bytes, so the default period uses about 1% of
+// a 115200 baud UART.
+
+#include <stdint.h>
+
+#include "config.h"
+
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_CRC_POLYNOMIAL 0x07
+
+// X(name, comment), in the order they are sent. Add fields at the end and
+// bump TELEMETRY_VERSION.
+#define TELEMETRY_FIELDS(X)                                                    \
+  X(sequence, "Frames sent before this one")                                   \
+  X(time_ms, "Wall-clock time since telemetry_init()")                         \
+  X(period_us, "Game timer period")                                            \
+  X(ticks, "Game ticks run")                                                   \
+  X(dropped, "Timer periods that did not get a tick of their own")             \
+  X(busy_us, "Time awake during the last tick")                                \
+  X(max_busy_us, "Most time awake during one tick since the last frame")       \
+  X(quality_level, "Drawing items shed, see quality.h")                        \
+  X(enemy_flying, "Enemy missiles flying")                                     \
+  X(enemy_exploding, "Enemy missiles exploding")                               \
+  X(player_flying, "Player missiles flying")                                   \
+  X(player_exploding, "Player missiles exploding")                             \
+  X(plane_flying, "UFO missiles flying")                                       \
+  X(plane_exploding, "UFO missiles exploding")                                 \
+  X(shots, "Player missiles launched")                                         \
+  X(impacts, "Enemy missiles that reached the ground")                         \
+  X(ufo_flying, "1 while the UFO crosses the screen")                          \
+  X(powerup_moving, "1 while the powerup is on screen")                        \
+  X(audio_queued, "Mixed audio samples waiting for the FIFO")
+
+#define TELEMETRY_FIELD_ENUM(name, comment) telemetry_##name##_e,
+typedef enum {
+  TELEMETRY_FIELDS(TELEMETRY_FIELD_ENUM) telemetry_fieldCount_e
+} telemetry_field_t;
+#undef TELEMETRY_FIELD_ENUM
+
+// The most bytes a frame takes on the wire: a 5-byte varint per field, the
+// version and CRC, the COBS overhead byte and the two zeros around it.
+#define TELEMETRY_VARINT_MAX 5
+#define TELEMETRY_PAYLOAD_MAX                                                  \
+  (1 + TELEMETRY_VARINT_MAX * telemetry_fieldCount_e + 1)
+#define TELEMETRY_FRAME_MAX (TELEMETRY_PAYLOAD_MAX + 1 + 2)
+
+// Starts the clock and the sequence over. The first frame is sent
+// CONFIG_TELEMETRY_PERIOD_US later.
+void telemetry_init();
+
+// Call once per game tick, after it ran. Sends a frame when one is due.
+void telemetry_tick();
+
+// Returns the CRC-8 (polynomial 0x07) of length bytes. Inline so the host
+// decoder checks frames with the same code.
+static inline uint8_t telemetry_crc8(const uint8_t *bytes, uint32_t length) {
+  uint8_t crc = 0;
+  for (uint32_t i = 0; i < length; i++) {
+    crc ^= bytes[i];
+    for (uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc & 0x80) ? (crc << 1) ^ TELEMETRY_CRC_POLYNOMIAL : crc << 1;
+  }
+  return crc;
+}
+
+// Sends a whole frame. telemetry_xilinx.c writes it to the UART,
+// host/telemetry_host.c to a file.
+void telemetry_hal_write(const uint8_t *bytes, uint32_t length);
+
+#endif /* TELEMETRY_H_ */
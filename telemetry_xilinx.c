@@ -0,0 +1,10 @@
+#include "telemetry.h"
+#include "xparameters.h"
+#include "xuartps_hw.h"
+
+// Writes the frame to the console UART. XUartPs_SendByte() waits while the
+// transmit FIFO is full, which a frame alone never fills.
+void telemetry_hal_write(const uint8_t *bytes, uint32_t length) {
+  for (uint32_t i = 0; i < length; i++)
+    XUartPs_SendByte(STDOUT_BASEADDRESS, bytes[i]);
+}
@@ -0,0 +1,113 @@
+#include <stdio.h>
+
+#include "config.h"
+#include "idle.h"
+#include "tick.h"
+
+static uint32_t tick_periodUs;
+static tick_overrunPolicy_t tick_policy;
+
+// triggered is only written by tick_isr(), everything else by tick_run().
+static volatile tick_stats_t tick_stats;
+
+// Interrupts already run by tick_run().
+static volatile uint32_t tick_handledTriggers;
+
+// When the last TICK_STAMPS interrupts were taken, indexed by the value of
+// triggered before each one. Only written by tick_isr(), so tick_run() can
+// read the stamp of an interrupt it has not handled without racing it.
+#define TICK_STAMPS 8 // A power of two, so the index survives a wrap.
+static volatile uint64_t tick_triggerUs[TICK_STAMPS];
+
+// Set the timer period and what to do on an overrun, and clear the counters.
+void tick_init(uint32_t period_us, tick_overrunPolicy_t policy) {
+  tick_periodUs = period_us;
+  tick_policy = policy;
+  tick_stats = (tick_stats_t){0};
+  tick_handledTriggers = 0;
+}
+
+// Drop the periods that elapsed since the last tick_run() without running or
+// counting them, and clear every counter except triggered.
+void tick_resync() {
+  uint32_t triggered = tick_stats.triggered;
+  tick_handledTriggers = triggered;
+  tick_stats.handled = 0;
+  tick_stats.overruns = 0;
+  tick_stats.dropped = 0;
+  tick_stats.lateness_us = 0;
+  tick_stats.max_lateness_us = 0;
+}
+
+// Change the timer period, for a game timer that was reprogrammed.
+void tick_setPeriod(uint32_t period_us) { tick_periodUs = period_us; }
+
+// Change what to do on an overrun.
+void tick_setOverrunPolicy(tick_overrunPolicy_t policy) {
+  tick_policy = policy;
+}
+
+// Call from the game timer interrupt.
+void tick_isr() {
+  tick_triggerUs[tick_stats.triggered % TICK_STAMPS] = idle_hal_nowUs();
+  tick_stats.triggered++;
+}
+
+// Run tickFunction for the periods that elapsed since the last call,
+// according to the overrun policy. Does nothing if none did.
+void tick_run(tick_function_t tickFunction) {
+  uint32_t triggered = tick_stats.triggered;
+  uint32_t periods = triggered - tick_handledTriggers;
+  if (periods == 0)
+    return;
+  // Lateness is measured from the oldest interrupt not run yet. Its stamp is
+  // only overwritten TICK_STAMPS interrupts later, so past half of that the
+  // newest stamp is used instead, with the periods since the oldest added.
+  uint32_t lateness;
+  if (periods <= TICK_STAMPS / 2)
+    lateness = idle_hal_nowUs() -
+               tick_triggerUs[tick_handledTriggers % TICK_STAMPS];
+  else
+    lateness = idle_hal_nowUs() -
+               tick_triggerUs[(triggered - 1) % TICK_STAMPS] +
+               (periods - 1) * tick_periodUs;
+  tick_handledTriggers = triggered;
+
+  tick_stats.handled++;
+  tick_stats.lateness_us = lateness;
+  if (lateness > tick_stats.max_lateness_us)
+    tick_stats.max_lateness_us = lateness;
+  if (periods > 1)
+    tick_stats.overruns++;
+
+  uint32_t ticks = 1;
+  switch (tick_policy) {
+  case tick_skip_e:
+    tickFunction(periods * tick_periodUs);
+    break;
+  case tick_catchUp_e:
+    ticks = periods < CONFIG_TICK_MAX_CATCH_UP ? periods
+                                               : CONFIG_TICK_MAX_CATCH_UP;
+    for (uint32_t i = 0; i < ticks; i++)
+      tickFunction(tick_periodUs);
+    break;
+  case tick_slowDown_e:
+    tickFunction(tick_periodUs);
+    break;
+  }
+  tick_stats.dropped += periods - ticks;
+}
+
+// Returns the counters.
+tick_stats_t tick_getStats() { return tick_stats; }
+
+// Prints the counters.
+void tick_printStats() {
+  printf("ticks: %lu triggered, %lu run, %lu overruns, %lu periods dropped, "
+         "max lateness %lu us\n",
+         (unsigned long)tick_stats.triggered,
+         (unsigned long)tick_stats.handled,
+         (unsigned long)tick_stats.overruns,
+         (unsigned long)tick_stats.dropped,
+         (unsigned long)tick_stats.max_lateness_us);
+}
@@ -0,0 +1,62 @@
+#ifndef TICK_H_
+#define TICK_H_
+
+// Runs the game tick from the game timer and handles overruns: when a tick
+// takes longer than a timer period, for example during a blocking sound call,
+// periods pile up before the next one starts. The policy decides what to do
+// with them, and the counters show how often it happened and how late ticks
+// started.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+  tick_skip_e,    // One tick covering every elapsed period. Game time keeps
+                  // up, but things jump.
+  tick_catchUp_e, // One tick per elapsed period, up to
+                  // CONFIG_TICK_MAX_CATCH_UP, the rest are dropped. The game's
+                  // drawing is incremental, so these ticks draw as well.
+  tick_slowDown_e // One tick of one period, the others are dropped. Game time
+                  // runs slower than real time.
+} tick_overrunPolicy_t;
+
+typedef struct {
+  uint32_t triggered;       // Game timer interrupts.
+  uint32_t handled;         // Calls of tick_run() that had periods to run.
+  uint32_t overruns;        // Of those, how many found more than one period.
+  uint32_t dropped;         // Periods that did not get a tick of their own.
+  uint32_t lateness_us;     // How long after its interrupt the last tick ran.
+  uint32_t max_lateness_us; // The latest any tick ran.
+} tick_stats_t;
+
+// Called with the game time, in microseconds, a tick should advance.
+typedef void (*tick_function_t)(uint32_t elapsed_us);
+
+// Set the timer period and what to do on an overrun, and clear the counters.
+void tick_init(uint32_t period_us, tick_overrunPolicy_t policy);
+
+// Drop the periods that elapsed since the last tick_run() without running or
+// counting them, and clear every counter except triggered. Call right before
+// the main loop, so time spent blocking at startup isn't an overrun.
+void tick_resync();
+
+// Change the timer period, for a game timer that was reprogrammed.
+void tick_setPeriod(uint32_t period_us);
+
+// Change what to do on an overrun.
+void tick_setOverrunPolicy(tick_overrunPolicy_t policy);
+
+// Call from the game timer interrupt.
+void tick_isr();
+
+// Run tickFunction for the periods that elapsed since the last call,
+// according to the overrun policy. Does nothing if none did.
+void tick_run(tick_function_t tickFunction);
+
+// Returns the counters.
+tick_stats_t tick_getStats();
+
+// Prints the counters.
+void tick_printStats();
+
+#endif /* TICK_H_ */
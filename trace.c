@@ -0,0 +1,33 @@
+#include <stdio.h>
+
+#include "trace.h"
+
+#if CONFIG_TRACE_RECORDS & (CONFIG_TRACE_RECORDS - 1)
+#error "CONFIG_TRACE_RECORDS must be a power of two"
+#endif
+
+trace_record_t trace_ring[CONFIG_TRACE_RECORDS];
+uint32_t trace_written;
+
+// Prints the records in the ring, oldest first, for host/tracedecode. The
+// first line gives the counter rate and how many records were lost to the
+// ring wrapping, then one line per record:
+//   trace <timestamp> <entity> <index> <old_state> <new_state>
+// all in hex.
+void trace_dump() {
+  uint32_t written = trace_written;
+  uint32_t count =
+      written < CONFIG_TRACE_RECORDS ? written : CONFIG_TRACE_RECORDS;
+  printf("trace begin %lx %lx\n", (unsigned long)profile_hal_countsPerSecond(),
+         (unsigned long)(written - count));
+  for (uint32_t i = written - count; i != written; i++) {
+    const trace_record_t *record = &trace_ring[i & (CONFIG_TRACE_RECORDS - 1)];
+    printf("trace %08lx %x %x %x %x\n", (unsigned long)record->timestamp,
+           record->entity, record->index, record->old_state,
+           record->new_state);
+  }
+  printf("trace end\n");
+}
+
+// Empties the ring.
+void trace_clear() { trace_written = 0; }
@@ -0,0 +1,73 @@
+#ifndef TRACE_H_
+#define TRACE_H_
+
+// A ring of the latest state changes of the game's state machines, cheap
+// enough to leave in the game tick. Each record is the time, which entity
+// changed and its old and new state, written in a handful of stores; nothing
+// is formatted until the ring is dumped. trace_dump() prints the records as
+// hex for host/tracedecode to turn back into names.
+//
+// Record a change like this; with CONFIG_TRACE_ENABLED false it compiles to
+// nothing:
+//   TRACE(trace_plane_e, 0, currentState, plane_move_st);
+//
+// Only the main loop traces: an interrupt writing a record at the same time
+// could take the same slot.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "profile.h"
+
+typedef enum {
+  trace_missile_e, // A missile, index is its slot in gameControl.c.
+  trace_plane_e,   // The UFO.
+  trace_powerup_e, // The powerup.
+  trace_sound_e,   // The sound state machine.
+  trace_voice_e,   // A sound starting on a voice, index is the voice. The old
+                   // state is 1 if a playing sound was cut off, the new one
+                   // the sound_sounds_t started.
+  trace_quality_e, // The quality level, the number of items shed.
+  trace_entityCount_e
+} trace_entity_t;
+
+typedef struct {
+  uint32_t timestamp; // profile_hal_now() when the state changed.
+  uint8_t entity;     // trace_entity_t.
+  uint8_t index;      // Which one, for entities there are several of.
+  uint8_t old_state;
+  uint8_t new_state;
+} trace_record_t;
+
+// The ring and the number of records ever written; the newest is at
+// (trace_written - 1) % CONFIG_TRACE_RECORDS.
+extern trace_record_t trace_ring[CONFIG_TRACE_RECORDS];
+extern uint32_t trace_written;
+
+// Records a state change.
+static inline void trace_record(trace_entity_t entity, uint8_t index,
+                                uint8_t old_state, uint8_t new_state) {
+  trace_record_t *record =
+      &trace_ring[trace_written++ & (CONFIG_TRACE_RECORDS - 1)];
+  record->timestamp = profile_hal_now();
+  record->entity = entity;
+  record->index = index;
+  record->old_state = old_state;
+  record->new_state = new_state;
+}
+
+#if CONFIG_TRACE_ENABLED
+#define TRACE(entity, index, old_state, new_state)                             \
+  trace_record(entity, index, old_state, new_state)
+#else
+#define TRACE(entity, index, old_state, new_state) ((void)0)
+#endif
+
+// Prints the records in the ring, oldest first, for host/tracedecode.
+void trace_dump();
+
+// Empties the ring.
+void trace_clear();
+
+#endif /* TRACE_H_ */